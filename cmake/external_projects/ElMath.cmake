@@ -555,11 +555,13 @@ if(EL_HAVE_MPI_LONG_LONG AND NOT EL_DISABLE_MPFR)
   endif()
 endif()
 
-if(EL_DISABLE_PARMETIS)
+if(EL_DISABLE_METIS)
+  message(STATUS "METIS was disabled; the built-in multilevel bisection will be used for nested dissection")
+elseif(EL_DISABLE_PARMETIS)
   include(external_projects/ElMath/METIS)
 else()
   include(external_projects/ElMath/ParMETIS)
 endif()
-if(NOT EL_HAVE_METIS)
-  message(FATAL_ERROR "METIS support is required for Elemental but existing support was not detected and downloading was prevented")
+if(NOT EL_DISABLE_METIS AND NOT EL_HAVE_METIS)
+  message(WARNING "METIS support was not detected and downloading was prevented; the built-in multilevel bisection will be used for nested dissection")
 endif()
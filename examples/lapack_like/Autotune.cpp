@@ -0,0 +1,70 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Benchmarks the tunable blocksizes and crossovers on the current machine
+// and grid shape and saves them to a file which can be loaded by subsequent
+// runs via the EL_TUNING_FILE environment variable, e.g.,
+//
+//   mpirun -np 16 ./Autotune --filename cluster.tune
+//   EL_TUNING_FILE=cluster.tune mpirun -np 16 ./YourDriver
+//
+// Entries for other grid shapes are preserved when an existing file is
+// extended with --append.
+
+int
+main( int argc, char* argv[] )
+{
+    El::Environment env( argc, argv );
+
+    try
+    {
+        El::Int gridHeight =
+          El::Input("--gridHeight","process grid height",0);
+        const El::Int factorSize =
+          El::Input("--factorSize","order of the factored matrices",2000);
+        const El::Int gemmSize =
+          El::Input("--gemmSize","outer dimension of Gemm timings",500);
+        const El::Int numReps =
+          El::Input("--numReps","number of timings per candidate",2);
+        const std::string filename =
+          El::Input("--filename","tuning file",std::string("elemental.tune"));
+        const bool append =
+          El::Input("--append","extend an existing tuning file?",false);
+        const bool progress = El::Input("--progress","print progress?",true);
+        El::ProcessInput();
+        El::PrintInputReport();
+
+        const El::mpi::Comm comm = El::mpi::COMM_WORLD;
+        if( gridHeight == 0 )
+            gridHeight = El::Grid::DefaultHeight( El::mpi::Size(comm) );
+        const El::Grid grid( comm, gridHeight );
+        if( append )
+            El::LoadTuningFile( filename );
+
+        El::AutotuneCtrl ctrl;
+        ctrl.factorSize = factorSize;
+        ctrl.gemmSize = gemmSize;
+        ctrl.numReps = numReps;
+        ctrl.progress = progress;
+        El::Autotune<float>( grid, ctrl );
+        El::Autotune<double>( grid, ctrl );
+        El::Autotune<El::Complex<float>>( grid, ctrl );
+        El::Autotune<El::Complex<double>>( grid, ctrl );
+
+        if( grid.Rank() == 0 )
+        {
+            El::SaveTuningFile( filename );
+            El::Output("Wrote ",filename);
+        }
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+
+    return 0;
+}
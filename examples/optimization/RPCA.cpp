@@ -68,6 +68,8 @@ main( int argc, char* argv[] )
           El::Input("--usePivQR","use pivoted QR approx?",false);
         const El::Int numPivSteps =
           El::Input("--numPivSteps","number of steps of QR",75);
+        const bool useRandomizedSVT =
+          El::Input("--useRandomizedSVT","use randomized SVT?",false);
         const bool useALM = El::Input("--useALM","use ALM algorithm?",true);
         const bool display = El::Input("--display","display matrices",false);
         const bool print = El::Input("--print","print matrices",true);
@@ -138,6 +140,7 @@ main( int argc, char* argv[] )
         ctrl.usePivQR = usePivQR;
         ctrl.progress = print;
         ctrl.numPivSteps = numPivSteps;
+        ctrl.useRandomizedSVT = useRandomizedSVT;
         ctrl.maxIts = maxIts;
         ctrl.tau = tau;
         ctrl.beta = beta;
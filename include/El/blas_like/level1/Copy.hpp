@@ -12,6 +12,7 @@
 #include <El/blas_like/level1/Copy/internal_decl.hpp>
 #include <El/blas_like/level1/Copy/GeneralPurpose.hpp>
 #include <El/blas_like/level1/Copy/util.hpp>
+#include <El/blas_like/level1/Copy/Pending.hpp>
 
 namespace El {
 
@@ -539,6 +540,53 @@ void CopyFromNonRoot( const DistMultiVec<T>& XDist, int root )
     }
 }
 
+template<typename T>
+void StartCopy
+( const DistMatrix<T,MC,MR>& A, DistMatrix<T,STAR,MR>& B,
+  PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    copy::ColAllGather( A, B, pending );
+}
+
+template<typename T>
+void StartCopy
+( const DistMatrix<T,STAR,MR>& A, DistMatrix<T,MC,MR>& B,
+  PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( pending.active )
+          LogicError("The previous copy was not finished");
+    )
+    copy::ColFilter( A, B );
+}
+
+template<typename T>
+void StartCopy
+( const DistMatrix<T,MC,MR>& A, DistMatrix<T,VC,STAR>& B,
+  PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    copy::ColAllToAllDemote( A, B, pending );
+}
+
+template<typename T>
+void StartCopy
+( const DistMatrix<T,VC,STAR>& A, DistMatrix<T,MC,MR>& B,
+  PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    copy::ColAllToAllPromote( A, B, pending );
+}
+
+template<typename T>
+void FinishCopy( PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    pending.Finish();
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -576,7 +624,20 @@ void CopyFromNonRoot( const DistMultiVec<T>& XDist, int root )
   EL_EXTERN template void CopyFromRoot \
   ( const DistMultiVec<T>& XDist, Matrix<T>& X ); \
   EL_EXTERN template void CopyFromNonRoot \
-  ( const DistMultiVec<T>& XDist, int root );
+  ( const DistMultiVec<T>& XDist, int root ); \
+  EL_EXTERN template void StartCopy \
+  ( const DistMatrix<T,MC,MR>& A, DistMatrix<T,STAR,MR>& B, \
+    PendingCopy<T>& pending ); \
+  EL_EXTERN template void StartCopy \
+  ( const DistMatrix<T,STAR,MR>& A, DistMatrix<T,MC,MR>& B, \
+    PendingCopy<T>& pending ); \
+  EL_EXTERN template void StartCopy \
+  ( const DistMatrix<T,MC,MR>& A, DistMatrix<T,VC,STAR>& B, \
+    PendingCopy<T>& pending ); \
+  EL_EXTERN template void StartCopy \
+  ( const DistMatrix<T,VC,STAR>& A, DistMatrix<T,MC,MR>& B, \
+    PendingCopy<T>& pending ); \
+  EL_EXTERN template void FinishCopy( PendingCopy<T>& pending );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -39,7 +39,7 @@ void AllGather
             const Int maxLocalHeight = MaxLength(height,colStride);
             const Int maxLocalWidth = MaxLength(width,rowStride);
             const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
-            vector<T> buf;
+            PooledVector<T> buf;
             FastResize( buf, (distStride+1)*portionSize );
             T* sendBuf = &buf[0];
             T* recvBuf = &buf[portionSize];
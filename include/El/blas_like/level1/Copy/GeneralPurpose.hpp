@@ -12,6 +12,53 @@
 namespace El {
 namespace copy {
 
+// The general-purpose redistribution transmits only the values of the
+// entries: since the local entries of every distribution are stored in
+// increasing order of their global indices, the subset of a process's
+// entries destined for (or arriving from) any other process can be traversed
+// by both parties in the same column-major order of global indices, and so
+// each side can determine the layout of every message from the alignments and
+// strides of the two distributions alone.
+//
+// The transfer proceeds over panels of columns which are sized so that no
+// process sends or receives more than (roughly) the following number of
+// entries at once, and the nonblocking sends of each panel are overlapped with
+// the unpacking of the current panel and the packing of the next one.
+const Int generalPurposeMaxEntries = Int(1) << 20;
+
+// Map the distribution ranks of the first member of each team of redundant
+// owners to ranks within the communicator used for the redistribution
+template<typename T>
+vector<int> RedistRanks( const AbstractDistMatrix<T>& A, bool includeViewers )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const int distSize = A.DistSize();
+    vector<int> ranks(distSize);
+    for( int distRank=0; distRank<distSize; ++distRank )
+    {
+        const int vcOwner =
+          g.CoordsToVC(A.ColDist(),A.RowDist(),distRank,A.Root(),0);
+        ranks[distRank] = ( includeViewers ? g.VCToViewing(vcOwner) : vcOwner );
+    }
+    return ranks;
+}
+
+// The number of columns which can be redistributed at once while respecting
+// the above bound on the entries held by any process of either distribution
+template<typename S,typename T>
+Int RedistPanelWidth
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    const Int height = A.Height();
+    const Int maxLocalHeight =
+      Max( MaxLength(height,A.ColStride()), MaxLength(height,B.ColStride()) );
+    const int minRowStride = Min( A.RowStride(), B.RowStride() );
+    const Int panelWidth =
+      (generalPurposeMaxEntries/Max(maxLocalHeight,Int(1)))*minRowStride;
+    return Max( panelWidth, Int(1) );
+}
+
 template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
 void Helper
 ( const AbstractDistMatrix<S>& A,
@@ -25,149 +72,164 @@ void Helper
     const Int width = A.Width();
     const Grid& g = B.Grid();
     B.Resize( height, width );
-    Zero( B );
-    const bool BPartic = B.Participating();
-    const int BRoot = B.Root();
-
     const bool includeViewers = (A.Grid() != B.Grid());
 
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
+    mpi::Comm comm;
+    if( includeViewers )
+    {
+        comm = g.ViewingComm();
+    }
+    else
+    {
+        if( !g.InGrid() )
+            return;
+        comm = g.VCComm();
+    }
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const vector<int> ranksA = RedistRanks( A, includeViewers );
+    const vector<int> ranksB = RedistRanks( B, includeViewers );
+
+    // Only the first member of each team of redundant owners of A sends,
+    // and only the first member of each team of redundant owners of B
+    // receives (and then broadcasts to the remainder of its team)
+    const bool sending = A.Participating() && A.RedundantRank() == 0;
+    const bool receiving = B.Participating() && B.RedundantRank() == 0;
+
     auto& ALoc = A.LockedMatrix();
     auto& BLoc = B.Matrix();
 
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
-    vector<int> distOwners;
-    if( A.RedundantRank() == 0 )
+    // Precompute the owners in B of the local rows and columns of A
+    // (as well as their local indices in B in case the owner is this process)
+    const Int localHeightA = ( sending ? A.LocalHeight() : 0 );
+    const Int localWidthA = ( sending ? A.LocalWidth() : 0 );
+    vector<int> destRowPieces(localHeightA), destColPieces(localWidthA);
+    vector<Int> localRowsB(localHeightA), localColsB(localWidthA);
+    for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
     {
-        const bool noRedundant = B.RedundantSize() == 1;
-        const int colStride = B.ColStride();
-        const int rowRank = B.RowRank();
-        const int colRank = B.ColRank();
-
-        vector<Int> globalRows(localHeight), localRows(localHeight);
-        vector<int> ownerRows(localHeight);
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = A.GlobalRow(iLoc);
-            const int ownerRow = B.RowOwner(i);
-            globalRows[iLoc] = i;
-            ownerRows[iLoc] = ownerRow;
-            localRows[iLoc] = B.LocalRow(i,ownerRow);
-        }
-
-        remoteEntries.reserve( localHeight*localWidth );
-        distOwners.reserve( localHeight*localWidth );
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const int ownerCol = B.ColOwner(j);
-            const Int localCol = B.LocalCol(j,ownerCol);
-            const bool isLocalCol = ( BPartic && ownerCol == rowRank );
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const int ownerRow = ownerRows[iLoc];
-                const Int localRow = localRows[iLoc];
-                const bool isLocalRow = ( BPartic && ownerRow == colRank );
-                const S& alpha = ALoc(iLoc,jLoc);
-                if( noRedundant && isLocalRow && isLocalCol )
-                {
-                    BLoc(localRow,localCol) = Caster<S,T>::Cast(alpha);
-                }
-                else
-                {
-                    remoteEntries.push_back
-                    ( Entry<S>{localRow,localCol,alpha} );
-                    distOwners.push_back( ownerRow + colStride*ownerCol );
-                }
-            }
-        }
+        const Int i = A.GlobalRow(iLoc);
+        const int ownerRow = B.RowOwner(i);
+        destRowPieces[iLoc] = ownerRow;
+        localRowsB[iLoc] = B.LocalRow(i,ownerRow);
+    }
+    for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const int ownerCol = B.ColOwner(j);
+        destColPieces[jLoc] = B.ColStride()*ownerCol;
+        localColsB[jLoc] = B.LocalCol(j,ownerCol);
     }
 
-    // We will first push to redundant rank 0 of B
-    const int redundantRootB = 0;
+    // Precompute the owners in A of the local rows and columns of B
+    const Int localHeightB = ( receiving ? B.LocalHeight() : 0 );
+    const Int localWidthB = ( receiving ? B.LocalWidth() : 0 );
+    vector<int> sourceRowPieces(localHeightB), sourceColPieces(localWidthB);
+    for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+        sourceRowPieces[iLoc] = A.RowOwner(B.GlobalRow(iLoc));
+    for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
+        sourceColPieces[jLoc] = A.ColStride()*A.ColOwner(B.GlobalCol(jLoc));
 
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
-    if( includeViewers )
+    const Int panelWidth = RedistPanelWidth( A, B );
+    vector<int> sendCounts, recvCounts, sendOffs, recvOffs, offs;
+    PooledVector<S> sendBufs[2], recvBuf;
+    vector<mpi::Request<S>> sendRequests[2], recvRequests;
+    sendRequests[0].reserve( commSize );
+    sendRequests[1].reserve( commSize );
+    recvRequests.reserve( commSize );
+    Int jLocA=0, jLocB=0;
+    for( Int panel=0, j0=0; j0<width; ++panel, j0+=panelWidth )
     {
-        comm = g.ViewingComm();
-        const int viewingSize = mpi::Size( g.ViewingComm() );
-        const int distBSize = mpi::Size( B.DistComm() );
+        const Int j1 = Min( j0+panelWidth, width );
+        Int jLocAEnd = jLocA;
+        while( jLocAEnd < localWidthA && A.GlobalCol(jLocAEnd) < j1 )
+            ++jLocAEnd;
+        Int jLocBEnd = jLocB;
+        while( jLocBEnd < localWidthB && B.GlobalCol(jLocBEnd) < j1 )
+            ++jLocBEnd;
 
-        vector<int> distBToViewing(distBSize);
-        for( int distBRank=0; distBRank<distBSize; ++distBRank )
+        // Post the receives for this panel
+        // --------------------------------
+        recvCounts.assign( commSize, 0 );
+        for( Int jLoc=jLocB; jLoc<jLocBEnd; ++jLoc )
+            for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+                ++recvCounts[ranksA[sourceRowPieces[iLoc]+
+                                    sourceColPieces[jLoc]]];
+        recvCounts[commRank] = 0;
+        const int totalRecv = Scan( recvCounts, recvOffs );
+        FastResize( recvBuf, totalRecv );
+        recvRequests.resize( 0 );
+        for( int q=0; q<commSize; ++q )
         {
-            const int vcOwner =
-              g.CoordsToVC
-              (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
-            distBToViewing[distBRank] = g.VCToViewing(vcOwner);
+            if( recvCounts[q] == 0 )
+                continue;
+            recvRequests.emplace_back();
+            mpi::IRecv
+            ( recvBuf.data()+recvOffs[q], recvCounts[q], q, comm,
+              recvRequests.back() );
         }
 
-        sendCounts.resize(viewingSize,0);
-        for( Int k=0; k<totalSend; ++k )
+        // Pack and send the data for this panel while the sends from two
+        // panels ago (which used the same buffer) are retired
+        // ---------------------------------------------------------------
+        auto& sendBuf = sendBufs[panel%2];
+        auto& requests = sendRequests[panel%2];
+        mpi::WaitAll( requests.size(), requests.data() );
+        requests.resize( 0 );
+        sendCounts.assign( commSize, 0 );
+        for( Int jLoc=jLocA; jLoc<jLocAEnd; ++jLoc )
+            for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
+                ++sendCounts[ranksB[destRowPieces[iLoc]+destColPieces[jLoc]]];
+        sendCounts[commRank] = 0;
+        const int totalSend = Scan( sendCounts, sendOffs );
+        FastResize( sendBuf, totalSend );
+        offs = sendOffs;
+        for( Int jLoc=jLocA; jLoc<jLocAEnd; ++jLoc )
         {
-            owners[k] = distBToViewing[distOwners[k]];
-            ++sendCounts[owners[k]];
+            const Int localColB = localColsB[jLoc];
+            for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
+            {
+                const int q =
+                  ranksB[destRowPieces[iLoc]+destColPieces[jLoc]];
+                if( q == commRank )
+                    BLoc(localRowsB[iLoc],localColB) =
+                      Caster<S,T>::Cast(ALoc(iLoc,jLoc));
+                else
+                    sendBuf[offs[q]++] = ALoc(iLoc,jLoc);
+            }
         }
-    }
-    else
-    {
-        if( !g.InGrid() )
-            return;
-        comm = g.VCComm();
-
-        const int distBSize = mpi::Size( B.DistComm() );
-        vector<int> distBToVC(distBSize);
-        for( int distBRank=0; distBRank<distBSize; ++distBRank )
+        for( int q=0; q<commSize; ++q )
         {
-            distBToVC[distBRank] =
-              g.CoordsToVC
-              (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
+            if( sendCounts[q] == 0 )
+                continue;
+            requests.emplace_back();
+            mpi::ISend
+            ( sendBuf.data()+sendOffs[q], sendCounts[q], q, comm,
+              requests.back() );
         }
 
-        const int vcSize = mpi::Size( g.VCComm() );
-        sendCounts.resize(vcSize,0);
-        for( Int k=0; k<totalSend; ++k )
+        // Unpack the data for this panel
+        // ------------------------------
+        mpi::WaitAll( recvRequests.size(), recvRequests.data() );
+        offs = recvOffs;
+        for( Int jLoc=jLocB; jLoc<jLocBEnd; ++jLoc )
         {
-            owners[k] = distBToVC[distOwners[k]];
-            ++sendCounts[owners[k]];
-        }
-    }
-    SwapClear( distOwners );
-
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan( sendCounts, sendOffs );
-    vector<Entry<S>> sendBuf;
-    FastResize( sendBuf, totalSend );
-    auto offs = sendOffs;
-    for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear( remoteEntries );
-    SwapClear( owners );
-
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    if( BPartic )
-    {
-        if( B.RedundantRank() == redundantRootB )
-        {
-            Int recvBufSize = recvBuf.size();
-            for( Int k=0; k<recvBufSize; ++k )
+            for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
             {
-                const auto& entry = recvBuf[k];
-                BLoc(entry.i,entry.j) = Caster<S,T>::Cast(entry.value);
+                const int q =
+                  ranksA[sourceRowPieces[iLoc]+sourceColPieces[jLoc]];
+                if( q != commRank )
+                    BLoc(iLoc,jLoc) = Caster<S,T>::Cast(recvBuf[offs[q]++]);
             }
         }
-        El::Broadcast( B, B.RedundantComm(), redundantRootB );
+
+        jLocA = jLocAEnd;
+        jLocB = jLocBEnd;
     }
+    for( Int k=0; k<2; ++k )
+        mpi::WaitAll( sendRequests[k].size(), sendRequests[k].data() );
+
+    if( B.Participating() )
+        El::Broadcast( B, B.RedundantComm(), 0 );
 }
 
 template<typename S,typename T,typename>
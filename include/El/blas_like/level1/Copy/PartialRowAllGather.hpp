@@ -53,7 +53,7 @@ void PartialRowAllGather
         }
         else
         {
-            vector<T> buffer;
+            PooledVector<T> buffer;
             FastResize( buffer, (rowStrideUnion+1)*portionSize );
             T* firstBuf = &buffer[0];
             T* secondBuf = &buffer[portionSize];
@@ -85,7 +85,7 @@ void PartialRowAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialRowAllGather" << endl;
 #endif
-        vector<T> buffer;
+        PooledVector<T> buffer;
         FastResize( buffer, (rowStrideUnion+1)*portionSize );
         T* firstBuf = &buffer[0];
         T* secondBuf = &buffer[portionSize];
@@ -0,0 +1,421 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_PENDING_HPP
+#define EL_BLAS_COPY_PENDING_HPP
+
+namespace El {
+namespace copy {
+
+// A redistribution whose communication has been started but which has not
+// yet been unpacked into its target. The source is packed before the
+// communication is started and may be modified immediately, but the target
+// must not be accessed until Finish has been called.
+template<typename T>
+struct PendingCopy
+{
+    mpi::Request<T> request;
+    PooledVector<T> buffer;
+    function<void()> unpack;
+    bool active=false;
+
+    PendingCopy() { }
+    PendingCopy( const PendingCopy<T>& ) = delete;
+    const PendingCopy<T>& operator=( const PendingCopy<T>& ) = delete;
+    ~PendingCopy() { Finish(); }
+
+    void Finish()
+    {
+        EL_DEBUG_CSE
+        if( !active )
+            return;
+        mpi::Wait( request );
+        unpack();
+        unpack = nullptr;
+        buffer.clear();
+        active = false;
+    }
+};
+
+// Start an AllGather of portionSize entries from each member of comm into
+// the second through last portions of pending.buffer, whose first portion
+// has already been packed
+template<typename T>
+void StartPendingAllGather
+( Int portionSize, mpi::Comm comm, PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    T* sendBuf = &pending.buffer[0];
+    T* recvBuf = &pending.buffer[portionSize];
+    mpi::IAllGather
+    ( sendBuf, portionSize, recvBuf, portionSize, comm, pending.request );
+    pending.active = true;
+}
+
+// Start an AllToAll of portionSize entries between each pair of members of
+// comm from the first half of pending.buffer, which has already been packed,
+// into its second half
+template<typename T>
+void StartPendingAllToAll
+( Int portionSize, mpi::Comm comm, PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    const Int commSize = mpi::Size( comm );
+    T* sendBuf = &pending.buffer[0];
+    T* recvBuf = &pending.buffer[commSize*portionSize];
+    mpi::IAllToAll
+    ( sendBuf, portionSize, recvBuf, portionSize, comm, pending.request );
+    pending.active = true;
+}
+
+// Split-phase versions of the AllGather and AllToAll redistributions: only
+// the communication of the aligned case is left in flight on return, and the
+// remaining cases fall back to a blocking Copy.
+
+// (U,V) |-> (Collect(U),V)
+template<typename T>
+void ColAllGather
+( const ElementalMatrix<T>& A,
+        ElementalMatrix<T>& B,
+        PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.ColDist() != Collect(A.ColDist()) ||
+          B.RowDist() != A.RowDist() )
+          LogicError("Incompatible distributions");
+      if( pending.active )
+          LogicError("The previous copy was not finished");
+    )
+    AssertSameGrids( A, B );
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
+    if( !A.Participating() )
+        return;
+    if( !EL_HAVE_NONBLOCKING || B.RowAlign() != A.RowAlign() ||
+        A.ColStride() == 1 || height == 1 )
+    {
+        Copy( A, B );
+        return;
+    }
+
+    const Int colStride = A.ColStride();
+    const Int localWidth = A.LocalWidth();
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
+    FastResize( pending.buffer, (colStride+1)*portionSize );
+
+    util::InterleaveMatrix
+    ( A.LocalHeight(), localWidth,
+      A.LockedBuffer(), 1, A.LDim(),
+      pending.buffer.data(), 1, A.LocalHeight() );
+    StartPendingAllGather( portionSize, A.ColComm(), pending );
+
+    const Int colAlign = A.ColAlign();
+    pending.unpack = [&B,&pending,height,localWidth,colAlign,colStride,
+                      portionSize]()
+      {
+          util::ColStridedUnpack
+          ( height, localWidth, colAlign, colStride,
+            &pending.buffer[portionSize], portionSize,
+            B.Buffer(), B.LDim() );
+      };
+}
+
+// (Partial(U),PartialUnionRow(U,V)) |-> (U,V), e.g., [MC,MR] -> [VC,* ]
+template<typename T>
+void ColAllToAllDemote
+( const ElementalMatrix<T>& A,
+        ElementalMatrix<T>& B,
+        PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.ColDist() != Partial(B.ColDist()) ||
+          A.RowDist() != PartialUnionRow(B.ColDist(),B.RowDist()) )
+          LogicError("Incompatible distributions");
+      if( pending.active )
+          LogicError("The previous copy was not finished");
+    )
+    AssertSameGrids( A, B );
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( !B.Participating() )
+        return;
+    const Int colAlign = B.ColAlign();
+    const Int colStride = B.ColStride();
+    const Int colStridePart = B.PartialColStride();
+    const Int colStrideUnion = B.PartialUnionColStride();
+    if( !EL_HAVE_NONBLOCKING ||
+        Mod(colAlign,colStridePart) != A.ColAlign() ||
+        colStrideUnion == 1 )
+    {
+        Copy( A, B );
+        return;
+    }
+
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int maxLocalWidth = MaxLength(width,colStrideUnion);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    FastResize( pending.buffer, 2*colStrideUnion*portionSize );
+
+    util::PartialColStridedPack
+    ( height, A.LocalWidth(),
+      colAlign, colStride,
+      colStrideUnion, colStridePart, B.PartialColRank(),
+      A.ColShift(),
+      A.LockedBuffer(), A.LDim(),
+      pending.buffer.data(), portionSize );
+    StartPendingAllToAll( portionSize, B.PartialUnionColComm(), pending );
+
+    const Int localHeight = B.LocalHeight();
+    const Int rowAlignA = A.RowAlign();
+    pending.unpack = [&B,&pending,localHeight,width,rowAlignA,colStrideUnion,
+                      portionSize]()
+      {
+          util::RowStridedUnpack
+          ( localHeight, width,
+            rowAlignA, colStrideUnion,
+            &pending.buffer[colStrideUnion*portionSize], portionSize,
+            B.Buffer(), B.LDim() );
+      };
+}
+
+// (U,V) |-> (Partial(U),PartialUnionRow(U,V)), e.g., [VC,* ] -> [MC,MR]
+template<typename T>
+void ColAllToAllPromote
+( const ElementalMatrix<T>& A,
+        ElementalMatrix<T>& B,
+        PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.ColDist() != Partial(A.ColDist()) ||
+          B.RowDist() != PartialUnionRow(A.ColDist(),A.RowDist()) )
+          LogicError("Incompatible distributions");
+      if( pending.active )
+          LogicError("The previous copy was not finished");
+    )
+    AssertSameGrids( A, B );
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize
+    ( Mod(A.ColAlign(),B.ColStride()), height, width, false, false );
+    if( !B.Participating() )
+        return;
+    const Int colStride = A.ColStride();
+    const Int colStridePart = A.PartialColStride();
+    const Int colStrideUnion = A.PartialUnionColStride();
+    if( !EL_HAVE_NONBLOCKING ||
+        B.ColAlign() != Mod(A.ColAlign(),colStridePart) ||
+        colStrideUnion == 1 )
+    {
+        Copy( A, B );
+        return;
+    }
+
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int maxLocalWidth = MaxLength(width,colStrideUnion);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    FastResize( pending.buffer, 2*colStrideUnion*portionSize );
+
+    util::RowStridedPack
+    ( A.LocalHeight(), width,
+      B.RowAlign(), colStrideUnion,
+      A.LockedBuffer(), A.LDim(),
+      pending.buffer.data(), portionSize );
+    StartPendingAllToAll( portionSize, A.PartialUnionColComm(), pending );
+
+    const Int colAlign = A.ColAlign();
+    const Int colRankPart = A.PartialColRank();
+    pending.unpack = [&B,&pending,height,colAlign,colStride,colStrideUnion,
+                      colStridePart,colRankPart,portionSize]()
+      {
+          util::PartialColStridedUnpack
+          ( height, B.LocalWidth(),
+            colAlign, colStride,
+            colStrideUnion, colStridePart, colRankPart,
+            B.ColShift(),
+            &pending.buffer[colStrideUnion*portionSize], portionSize,
+            B.Buffer(), B.LDim() );
+      };
+}
+
+// (U,V) |-> (U,Collect(V))
+template<typename T>
+void RowAllGather
+( const ElementalMatrix<T>& A,
+        ElementalMatrix<T>& B,
+        PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.ColDist() != B.ColDist() ||
+          Collect(A.RowDist()) != B.RowDist() )
+          LogicError("Incompatible distributions");
+      if( pending.active )
+          LogicError("The previous copy was not finished");
+    )
+    AssertSameGrids( A, B );
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( !A.Participating() )
+        return;
+    if( !EL_HAVE_NONBLOCKING || B.ColAlign() != A.ColAlign() ||
+        A.RowStride() == 1 )
+    {
+        Copy( A, B );
+        return;
+    }
+
+    const Int rowStride = A.RowStride();
+    const Int localHeight = A.LocalHeight();
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
+    FastResize( pending.buffer, (rowStride+1)*portionSize );
+
+    util::InterleaveMatrix
+    ( localHeight, A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      pending.buffer.data(), 1, localHeight );
+    StartPendingAllGather( portionSize, A.RowComm(), pending );
+
+    const Int rowAlign = A.RowAlign();
+    pending.unpack = [&B,&pending,localHeight,width,rowAlign,rowStride,
+                      portionSize]()
+      {
+          util::RowStridedUnpack
+          ( localHeight, width, rowAlign, rowStride,
+            &pending.buffer[portionSize], portionSize,
+            B.Buffer(), B.LDim() );
+      };
+}
+
+// (U,V) |-> (Partial(U),V)
+template<typename T>
+void PartialColAllGather
+( const ElementalMatrix<T>& A,
+        ElementalMatrix<T>& B,
+        PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.ColDist() != Partial(A.ColDist()) ||
+          B.RowDist() != A.RowDist() )
+          LogicError("Incompatible distributions");
+      if( pending.active )
+          LogicError("The previous copy was not finished");
+    )
+    AssertSameGrids( A, B );
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize
+    ( Mod(A.ColAlign(),B.ColStride()), height, width, false, false );
+    if( !A.Participating() )
+        return;
+    const Int colStrideUnion = A.PartialUnionColStride();
+    const Int colStridePart = A.PartialColStride();
+    if( !EL_HAVE_NONBLOCKING ||
+        B.ColAlign() != Mod(A.ColAlign(),colStridePart) ||
+        colStrideUnion == 1 )
+    {
+        Copy( A, B );
+        return;
+    }
+
+    const Int maxLocalHeight = MaxLength(height,A.ColStride());
+    const Int portionSize = mpi::Pad( maxLocalHeight*width );
+    FastResize( pending.buffer, (colStrideUnion+1)*portionSize );
+
+    util::InterleaveMatrix
+    ( A.LocalHeight(), width,
+      A.LockedBuffer(), 1, A.LDim(),
+      pending.buffer.data(), 1, A.LocalHeight() );
+    StartPendingAllGather( portionSize, A.PartialUnionColComm(), pending );
+
+    const Int colAlign = A.ColAlign();
+    const Int colStride = A.ColStride();
+    const Int colRankPart = A.PartialColRank();
+    pending.unpack = [&B,&pending,height,width,colAlign,colStride,
+                      colStrideUnion,colStridePart,colRankPart,portionSize]()
+      {
+          util::PartialColStridedUnpack
+          ( height, width,
+            colAlign, colStride,
+            colStrideUnion, colStridePart, colRankPart,
+            B.ColShift(),
+            &pending.buffer[portionSize], portionSize,
+            B.Buffer(), B.LDim() );
+      };
+}
+
+// (U,V) |-> (U,Partial(V))
+template<typename T>
+void PartialRowAllGather
+( const ElementalMatrix<T>& A,
+        ElementalMatrix<T>& B,
+        PendingCopy<T>& pending )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( B.ColDist() != A.ColDist() ||
+          B.RowDist() != Partial(A.RowDist()) )
+          LogicError("Incompatible distributions");
+      if( pending.active )
+          LogicError("The previous copy was not finished");
+    )
+    AssertSameGrids( A, B );
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize
+    ( Mod(A.RowAlign(),B.RowStride()), height, width, false, false );
+    if( !A.Participating() )
+        return;
+    const Int rowStrideUnion = A.PartialUnionRowStride();
+    const Int rowStridePart = A.PartialRowStride();
+    if( !EL_HAVE_NONBLOCKING ||
+        B.RowAlign() != Mod(A.RowAlign(),rowStridePart) ||
+        rowStrideUnion == 1 )
+    {
+        Copy( A, B );
+        return;
+    }
+
+    const Int rowStride = A.RowStride();
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( height*maxLocalWidth );
+    FastResize( pending.buffer, (rowStrideUnion+1)*portionSize );
+
+    util::InterleaveMatrix
+    ( height, A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      pending.buffer.data(), 1, height );
+    StartPendingAllGather( portionSize, A.PartialUnionRowComm(), pending );
+
+    const Int rowAlign = A.RowAlign();
+    const Int rowRankPart = A.PartialRowRank();
+    pending.unpack = [&B,&pending,height,width,rowAlign,rowStride,
+                      rowStrideUnion,rowStridePart,rowRankPart,portionSize]()
+      {
+          util::PartialRowStridedUnpack
+          ( height, width,
+            rowAlign, rowStride,
+            rowStrideUnion, rowStridePart, rowRankPart,
+            B.RowShift(),
+            &pending.buffer[portionSize], portionSize,
+            B.Buffer(), B.LDim() );
+      };
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_PENDING_HPP
@@ -50,7 +50,7 @@ void Scatter
         return;
     }
 
-    vector<T> buffer;
+    PooledVector<T> buffer;
     T* recvBuf=0; // some compilers (falsely) warn otherwise
     if( A.CrossRank() == root )
     {
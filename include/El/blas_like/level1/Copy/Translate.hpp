@@ -60,7 +60,7 @@ void Translate
         const Int maxHeight = MaxLength( height, colStride );
         const Int maxWidth  = MaxLength( width,  rowStride );
         const Int pkgSize = mpi::Pad( maxHeight*maxWidth );
-        vector<T> buffer;
+        PooledVector<T> buffer;
         if( crossRank == root || crossRank == B.Root() )
             FastResize( buffer, pkgSize );
 
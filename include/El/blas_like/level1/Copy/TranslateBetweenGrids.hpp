@@ -107,7 +107,7 @@ void TranslateBetweenGrids
         requiredMemory += maxSendSize;
     if( inBGrid )
         requiredMemory += maxSendSize;
-    vector<T> auxBuf;
+    PooledVector<T> auxBuf;
     FastResize( auxBuf, requiredMemory );
     Int offset = 0;
     T* sendBuf = &auxBuf[offset];
@@ -290,7 +290,7 @@ void TranslateBetweenGrids
         requiredMemory += height*width;
     if( B.Participating() )
         requiredMemory += height*width;
-    vector<T> buffer;
+    PooledVector<T> buffer;
     FastResize( buffer, requiredMemory );
     Int offset = 0;
     T* sendBuf = &buffer[offset];
@@ -571,6 +571,37 @@ void CopyFromRoot( const DistMultiVec<T>& XDist, Matrix<T>& X );
 template<typename T>
 void CopyFromNonRoot( const DistMultiVec<T>& XDist, int root=0 );
 
+// Split-phase redistributions
+// ---------------------------
+// StartCopy packs A and starts the communication of its redistribution into
+// B so that local computation can proceed while it is in flight. A may be
+// modified as soon as StartCopy returns, but B must not be accessed until
+// FinishCopy has been called on the same PendingCopy (which its destructor
+// otherwise does). Unaligned redistributions, those which require no
+// communication, and builds without non-blocking collectives complete within
+// StartCopy.
+namespace copy { template<typename T> struct PendingCopy; }
+using copy::PendingCopy;
+
+template<typename T>
+void StartCopy
+( const DistMatrix<T,MC,MR>& A, DistMatrix<T,STAR,MR>& B,
+  PendingCopy<T>& pending );
+template<typename T>
+void StartCopy
+( const DistMatrix<T,STAR,MR>& A, DistMatrix<T,MC,MR>& B,
+  PendingCopy<T>& pending );
+template<typename T>
+void StartCopy
+( const DistMatrix<T,MC,MR>& A, DistMatrix<T,VC,STAR>& B,
+  PendingCopy<T>& pending );
+template<typename T>
+void StartCopy
+( const DistMatrix<T,VC,STAR>& A, DistMatrix<T,MC,MR>& B,
+  PendingCopy<T>& pending );
+template<typename T>
+void FinishCopy( PendingCopy<T>& pending );
+
 namespace copy {
 namespace util {
 
@@ -11,6 +11,8 @@
 
 namespace El {
 
+// Unless explicitly set, the local blocksize is the tuned "LocalSymv"
+// blocksize for a 1 x 1 grid (see SetTunedBlocksize), or 64 if there is none
 template<typename T> void SetLocalSymvBlocksize( Int blocksize );
 template<typename T> Int LocalSymvBlocksize();
 
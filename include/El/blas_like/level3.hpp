@@ -11,6 +11,8 @@
 
 namespace El {
 
+// Unless explicitly set, the local blocksizes are the tuned "LocalTrrk" and
+// "LocalTrr2k" blocksizes for a 1 x 1 grid (see SetTunedBlocksize), or 64
 template<typename T> void SetLocalTrrkBlocksize( Int blocksize );
 template<typename T> Int LocalTrrkBlocksize();
 
@@ -26,7 +28,8 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_OZAKI
 };
 }
 using namespace GemmAlgorithmNS;
@@ -66,6 +69,35 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// OzakiGemm
+// =========
+// Emulates a Gemm in the precision of T by splitting the operands into
+// integer-valued double-precision slices (with per-row and per-column
+// power-of-two scalings) whose products are exact when formed with the
+// native (and, in the distributed case, SUMMA-based) double-precision Gemm.
+// The products are then summed in the precision of T. This is primarily
+// useful for the extended-precision types, and all entries must lie within
+// the exponent range of double precision.
+struct OzakiGemmCtrl
+{
+    // The number of slices of each operand; if zero, the number is chosen so
+    // that the result is accurate to the working precision of T
+    Int numSlices=0;
+};
+
+template<typename F>
+void OzakiGemm
+( Orientation orientA, Orientation orientB,
+  F alpha, const Matrix<F>& A, const Matrix<F>& B, F beta, Matrix<F>& C,
+  const OzakiGemmCtrl& ctrl=OzakiGemmCtrl() );
+
+template<typename F>
+void OzakiGemm
+( Orientation orientA, Orientation orientB,
+  F alpha, const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& B,
+  F beta,        AbstractDistMatrix<F>& C,
+  const OzakiGemmCtrl& ctrl=OzakiGemmCtrl() );
+
 // Hemm
 // ====
 template<typename T>
@@ -344,6 +376,8 @@ void Syrk
   T alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C,
   bool conjugate=false );
 
+// The sparse variants always store an explicit (possibly zero) diagonal in
+// C, even where the product is structurally zero
 template<typename T>
 void Syrk
 ( UpperOrLower uplo, Orientation orientation,
@@ -366,6 +400,136 @@ void Syrk
   T alpha, const DistSparseMatrix<T>& A,
                  DistSparseMatrix<T>& C, bool conjugate=false );
 
+// Sparse products with reusable patterns
+// ======================================
+// A Gustavson-style (row-by-row) engine for sparse-sparse products which
+// splits the formation of C := alpha A B, or of (a triangle of)
+// C := alpha A diag(d) A^T (or A^H), into a symbolic phase, which computes
+// the sparsity pattern of C (and, in the distributed case, the communication
+// pattern needed to form it) once, and a numeric phase, which overwrites the
+// values of C in place and can be repeated for any values of A, B, and d
+// with the same sparsity patterns. The patterns of the Syrk variants always
+// include the diagonal of C so that it may be shifted in place.
+//
+// Both phases process each row of C with a dense marker (or accumulator) of
+// length Width(C) per thread.
+//
+// NOTE: C must not be modified between the symbolic and numeric phases other
+//       than through its values. The numeric phase compares hashes of the
+//       (local) patterns of A, B, and C against those of the symbolic phase
+//       and throws if they differ.
+
+template<typename T>
+class SparseProduct
+{
+public:
+    // C := A B
+    void Initialize
+    ( const SparseMatrix<T>& A, const SparseMatrix<T>& B, SparseMatrix<T>& C );
+    // C := A diag(d) A^T (or A^H)
+    void InitializeSyrk
+    ( const SparseMatrix<T>& A, SparseMatrix<T>& C, bool conjugate=false );
+    // The 'uplo' triangle of C := A diag(d) A^T (or A^H)
+    void InitializeSyrk
+    ( UpperOrLower uplo, const SparseMatrix<T>& A, SparseMatrix<T>& C,
+      bool conjugate=false );
+
+    void Multiply
+    ( T alpha, const SparseMatrix<T>& A, const SparseMatrix<T>& B,
+      SparseMatrix<T>& C );
+    void Syrk
+    ( T alpha, const SparseMatrix<T>& A, const Matrix<T>& d,
+      SparseMatrix<T>& C );
+
+    bool Initialized() const EL_NO_EXCEPT { return initialized_; }
+
+private:
+    bool initialized_=false, syrk_=false, conjugate_=false,
+         triangular_=false;
+    UpperOrLower uplo_=LOWER;
+    // Hashes of the sparsity patterns analyzed by the symbolic phase
+    std::uint64_t patternHashA_=0, patternHashB_=0, patternHashC_=0;
+
+    // The pattern of A^T, and the entry of A corresponding to each of its
+    // entries, for the Syrk variants
+    vector<Int> transOffsets_, transTargets_, transSources_;
+    vector<T> transValues_;
+
+    void AnalyzeSyrk
+    ( bool triangular, UpperOrLower uplo,
+      const SparseMatrix<T>& A, SparseMatrix<T>& C, bool conjugate );
+    void CheckPatterns
+    ( const SparseMatrix<T>& A, std::uint64_t patternHashB,
+      const SparseMatrix<T>& C, bool syrk ) const;
+};
+
+template<typename T>
+class DistSparseProduct
+{
+public:
+    // C := A B
+    void Initialize
+    ( const DistSparseMatrix<T>& A,
+      const DistSparseMatrix<T>& B,
+            DistSparseMatrix<T>& C );
+    // C := A diag(d) A^T (or A^H)
+    void InitializeSyrk
+    ( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& C,
+      bool conjugate=false );
+    // The 'uplo' triangle of C := A diag(d) A^T (or A^H)
+    void InitializeSyrk
+    ( UpperOrLower uplo, const DistSparseMatrix<T>& A, DistSparseMatrix<T>& C,
+      bool conjugate=false );
+
+    void Multiply
+    ( T alpha, const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B,
+      DistSparseMatrix<T>& C );
+    // d must be distributed like the rows of A^T
+    void Syrk
+    ( T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& d,
+      DistSparseMatrix<T>& C );
+
+    bool Initialized() const EL_NO_EXCEPT { return initialized_; }
+
+private:
+    bool initialized_=false, syrk_=false, conjugate_=false,
+         triangular_=false;
+    UpperOrLower uplo_=LOWER;
+    // Hashes of the (local) sparsity patterns analyzed by the symbolic phase
+    std::uint64_t patternHashA_=0, patternHashB_=0, patternHashC_=0;
+
+    // The redistribution of the entries of A into the local rows of A^T
+    // (for the Syrk variants)
+    vector<Int> transSendPositions_, transRecvPositions_;
+    vector<int> transSendCounts_, transSendOffs_,
+                transRecvCounts_, transRecvOffs_;
+    vector<Int> transOffsets_, transTargets_;
+    vector<T> transSendValues_, transRecvValues_, transValues_;
+
+    // The rows of B (or A^T) needed by our rows of A: which of our local rows
+    // we send to each process, the pattern of the rows we receive, and the
+    // received row corresponding to each local entry of A
+    vector<Int> fetchSendRows_;
+    vector<int> fetchSendCounts_, fetchSendOffs_,
+                fetchRecvCounts_, fetchRecvOffs_;
+    vector<Int> fetchOffsets_, fetchTargets_, fetchRowOfEntry_;
+    vector<T> fetchSendValues_, fetchValues_;
+
+    void AnalyzeSyrk
+    ( bool triangular, UpperOrLower uplo,
+      const DistSparseMatrix<T>& A, DistSparseMatrix<T>& C, bool conjugate );
+    void AnalyzeFetch
+    ( const DistSparseMatrix<T>& A, const DistMultiVec<T>& layoutB,
+      const Int* offsetsB, const Int* targetsB );
+    void FetchValues
+    ( const Int* offsetsB, const T* valuesB, mpi::Comm comm );
+    void FormProduct
+    ( T alpha, const DistSparseMatrix<T>& A, DistSparseMatrix<T>& C );
+    void CheckPatterns
+    ( const DistSparseMatrix<T>& A, std::uint64_t patternHashB,
+      const DistSparseMatrix<T>& C, bool syrk ) const;
+};
+
 // Syr2k
 // =====
 template<typename T>
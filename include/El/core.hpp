@@ -17,6 +17,7 @@
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -41,6 +42,12 @@
 # define EL_RELEASE_ONLY(cmd)
 #endif
 
+#ifdef EL_PROFILE
+# define EL_PROFILE_ONLY(cmd) cmd;
+#else
+# define EL_PROFILE_ONLY(cmd)
+#endif
+
 #ifdef EL_HAVE_NO_EXCEPT
 # define EL_NO_EXCEPT noexcept
 #else
@@ -253,6 +260,7 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/imports/choice.hpp>
 #include <El/core/imports/mpi_choice.hpp>
 #include <El/core/environment/decl.hpp>
+#include <El/core/Profile.hpp>
 
 #include <El/core/Timer.hpp>
 #include <El/core/indexing/decl.hpp>
@@ -311,6 +319,7 @@ class DistMatrix;
 
 // TODO: Sequential map
 //#include <El/core/Map.hpp>
+#include <El/core/Graph/assemble.hpp>
 #include <El/core/SparseMatrix/impl.hpp>
 
 #include <El/core/DistMap.hpp>
@@ -31,6 +31,11 @@ struct DistGraphMultMeta
     vector<int> sendSizes, sendOffs,
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
+    // Maximal runs of local rows, stored as [begin,end) pairs, which only
+    // touch our own portion of X (the interior) or also touch portions owned
+    // by other processes (the boundary), so that the interior can be
+    // multiplied while the boundary data is in flight
+    vector<Int> interiorRuns, boundaryRuns;
 
     DistGraphMultMeta() : ready(false), numRecvInds(0) { }
 
@@ -44,6 +49,8 @@ struct DistGraphMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( interiorRuns );
+        SwapClear( boundaryRuns );
     }
 
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
@@ -56,6 +63,8 @@ struct DistGraphMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        interiorRuns = meta.interiorRuns;
+        boundaryRuns = meta.boundaryRuns;
         return *this;
     }
 };
@@ -186,8 +186,6 @@ private:
 
     void InitializeLocalData();
 
-    static bool CompareEntries( const Entry<Ring>& a, const Entry<Ring>& b );
-
     template<typename U> friend class SparseMatrix;
 };
 
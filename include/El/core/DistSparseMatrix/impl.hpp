@@ -332,64 +332,10 @@ void DistSparseMatrix<Ring>::ProcessLocalQueues()
     EL_DEBUG_CSE
     if( distGraph_.locallyConsistent_ )
         return;
-
-    Int numRemoved = 0;
-    const Int numLocalEntries = vals_.size();
-    vector<Entry<Ring>> entries( numLocalEntries );
-    if( distGraph_.markedForRemoval_.size() != 0 )
-    {
-        for( Int s=0; s<numLocalEntries; ++s )
-        {
-            pair<Int,Int> candidate(distGraph_.sources_[s],
-                                    distGraph_.targets_[s]);
-            if( distGraph_.markedForRemoval_.find(candidate) ==
-                distGraph_.markedForRemoval_.end() )
-            {
-                entries[s-numRemoved].i = distGraph_.sources_[s];
-                entries[s-numRemoved].j = distGraph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
-            }
-        }
-        SwapClear( distGraph_.markedForRemoval_ );
-        entries.resize( numLocalEntries-numRemoved );
-    }
-    else
-    {
-        for( Int s=0; s<numLocalEntries; ++s )
-            entries[s] = Entry<Ring>{distGraph_.sources_[s],
-                                  distGraph_.targets_[s],vals_[s]};
-    }
-    std::sort( entries.begin(), entries.end(), CompareEntries );
-    const Int numSorted = entries.size();
-
-    // Combine duplicates
-    // ------------------
-    Int lastUnique=0;
-    for( Int s=1; s<numSorted; ++s )
-    {
-        if( entries[s].i != entries[lastUnique].i ||
-            entries[s].j != entries[lastUnique].j )
-            entries[++lastUnique] = entries[s];
-        else
-            entries[lastUnique].value += entries[s].value;
-    }
-    const Int numUnique = lastUnique+1;
-
-    entries.resize( numUnique );
-    distGraph_.sources_.resize( numUnique );
-    distGraph_.targets_.resize( numUnique );
-    vals_.resize( numUnique );
-    for( Int s=0; s<numUnique; ++s )
-    {
-        distGraph_.sources_[s] = entries[s].i;
-        distGraph_.targets_[s] = entries[s].j;
-        vals_[s] = entries[s].value;
-    }
-    distGraph_.ComputeSourceOffsets();
+    AssembleQueues
+    ( distGraph_.FirstLocalSource(), distGraph_.numLocalSources_,
+      distGraph_.sources_, distGraph_.targets_, &vals_,
+      distGraph_.markedForRemoval_, distGraph_.localSourceOffsets_ );
     distGraph_.locallyConsistent_ = true;
 }
 
@@ -810,11 +756,6 @@ void DistSparseMatrix<Ring>::MappedTargets
         Output("Target translation: ",timer.Stop()," secs");
 }
 
-template<typename Ring>
-bool DistSparseMatrix<Ring>::CompareEntries
-( const Entry<Ring>& a, const Entry<Ring>& b )
-{ return a.i < b.i || (a.i == b.i && a.j < b.j); }
-
 #ifdef EL_INSTANTIATE_CORE
 # define EL_EXTERN
 #else
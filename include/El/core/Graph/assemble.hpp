@@ -0,0 +1,330 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_GRAPH_ASSEMBLE_HPP
+#define EL_CORE_GRAPH_ASSEMBLE_HPP
+
+namespace El {
+
+namespace assemble {
+
+// Buckets shorter than this are sorted with an insertion sort
+const Int insertionSortCutoff = 32;
+
+// Stably sort a bucket of targets (and their values, if 'values' is non-null)
+template<typename Ring>
+void SortBucket( Int* targets, Ring* values, Int length )
+{
+    bool sorted = true;
+    for( Int e=1; e<length; ++e )
+    {
+        if( targets[e] < targets[e-1] )
+        {
+            sorted = false;
+            break;
+        }
+    }
+    if( sorted )
+        return;
+
+    if( length <= insertionSortCutoff )
+    {
+        for( Int e=1; e<length; ++e )
+        {
+            const Int target = targets[e];
+            Int f = e;
+            if( values == nullptr )
+            {
+                for( ; f>0 && targets[f-1] > target; --f )
+                    targets[f] = targets[f-1];
+                targets[f] = target;
+            }
+            else
+            {
+                const Ring value = values[e];
+                for( ; f>0 && targets[f-1] > target; --f )
+                {
+                    targets[f] = targets[f-1];
+                    values[f] = values[f-1];
+                }
+                targets[f] = target;
+                values[f] = value;
+            }
+        }
+        return;
+    }
+
+    // Sort (target,position) pairs, which keeps the sort stable, and then
+    // apply the permutation
+    vector<pair<Int,Int>> keys( length );
+    for( Int e=0; e<length; ++e )
+        keys[e] = pair<Int,Int>(targets[e],e);
+    std::sort( keys.begin(), keys.end() );
+    if( values != nullptr )
+    {
+        vector<Ring> sortedValues( length );
+        for( Int e=0; e<length; ++e )
+            sortedValues[e] = values[keys[e].second];
+        for( Int e=0; e<length; ++e )
+            values[e] = sortedValues[e];
+    }
+    for( Int e=0; e<length; ++e )
+        targets[e] = keys[e].first;
+}
+
+// Queues with fewer entries than this are bucketed by a single thread
+const Int minThreadedEntries = 10000;
+
+// Stably scatter the targets (and values, if 'values' is non-null) of a
+// queue into buckets by source and set 'offsets' to the bucket offsets.
+//
+// In the threaded case, the queue is split into one contiguous chunk per
+// thread, each of which builds a histogram of its sources. An exclusive scan
+// of each source's counts over the chunks, followed by a prefix sum over the
+// sources, yields the first position of every (chunk,source) pair, so that
+// the chunks can then be scattered concurrently without changing the order of
+// the entries within a bucket.
+template<typename Ring>
+void BucketBySource
+( Int firstSource,
+  Int numSources,
+  const vector<Int>& sources,
+  const vector<Int>& targets,
+  const vector<Ring>* values,
+  vector<Int>& offsets,
+  vector<Int>& bucketTargets,
+  vector<Ring>& bucketValues )
+{
+    EL_DEBUG_CSE
+    const Int numEntries = sources.size();
+    offsets.assign( numSources+1, 0 );
+    bucketTargets.resize( numEntries );
+    if( values != nullptr )
+        bucketValues.resize( numEntries );
+
+    // Scatter entries [begin,end) given the next position of each bucket
+    auto scatter = [&]( Int begin, Int end, Int* positions )
+    {
+        if( values != nullptr )
+        {
+            for( Int e=begin; e<end; ++e )
+            {
+                const Int pos = positions[sources[e]-firstSource]++;
+                bucketTargets[pos] = targets[e];
+                bucketValues[pos] = (*values)[e];
+            }
+        }
+        else
+        {
+            for( Int e=begin; e<end; ++e )
+                bucketTargets[positions[sources[e]-firstSource]++] = targets[e];
+        }
+    };
+
+#ifdef EL_HYBRID
+    const Int numChunks = omp_get_max_threads();
+    if( numEntries >= minThreadedEntries && numChunks > 1 )
+    {
+        // The counts, and then the first positions, of each chunk's sources
+        vector<Int> histograms( numChunks*numSources, 0 );
+        Int* offsetBuf = offsets.data();
+        #pragma omp parallel
+        {
+            #pragma omp for schedule(static)
+            for( Int chunk=0; chunk<numChunks; ++chunk )
+            {
+                const Int begin = (numEntries*chunk) / numChunks;
+                const Int end = (numEntries*(chunk+1)) / numChunks;
+                Int* histogram = &histograms[chunk*numSources];
+                for( Int e=begin; e<end; ++e )
+                    ++histogram[sources[e]-firstSource];
+            }
+
+            #pragma omp for schedule(static)
+            for( Int s=0; s<numSources; ++s )
+            {
+                Int count = 0;
+                for( Int chunk=0; chunk<numChunks; ++chunk )
+                {
+                    const Int chunkCount = histograms[chunk*numSources+s];
+                    histograms[chunk*numSources+s] = count;
+                    count += chunkCount;
+                }
+                offsetBuf[s+1] = count;
+            }
+
+            #pragma omp single
+            {
+                for( Int s=0; s<numSources; ++s )
+                    offsetBuf[s+1] += offsetBuf[s];
+            }
+
+            #pragma omp for schedule(static)
+            for( Int s=0; s<numSources; ++s )
+                for( Int chunk=0; chunk<numChunks; ++chunk )
+                    histograms[chunk*numSources+s] += offsetBuf[s];
+
+            #pragma omp for schedule(static)
+            for( Int chunk=0; chunk<numChunks; ++chunk )
+            {
+                const Int begin = (numEntries*chunk) / numChunks;
+                const Int end = (numEntries*(chunk+1)) / numChunks;
+                scatter( begin, end, &histograms[chunk*numSources] );
+            }
+        }
+        return;
+    }
+#endif
+
+    for( Int e=0; e<numEntries; ++e )
+        ++offsets[sources[e]-firstSource+1];
+    for( Int s=0; s<numSources; ++s )
+        offsets[s+1] += offsets[s];
+    vector<Int> positions( offsets );
+    scatter( 0, numEntries, positions.data() );
+}
+
+} // namespace assemble
+
+// Convert the queue of (source,target) pairs of a (local portion of a) graph,
+// and their values if 'values' is non-null, into compressed sparse row form:
+// the pairs are sorted by source and then target, the values of duplicate
+// pairs are summed, the pairs in 'markedForRemoval' are dropped (and the set
+// is cleared), and 'offsets' is set to the offsets of the numSources sources
+// beginning at firstSource.
+//
+// Rather than a comparison sort of the entire queue, the pairs are bucketed
+// by source with a (stable, and for large queues threaded) counting sort and
+// the buckets are then sorted by target in parallel. Queues which are already
+// in order, e.g., due to assembling the rows one after another, are detected
+// in linear time and are not sorted at all.
+template<typename Ring>
+void AssembleQueues
+( Int firstSource,
+  Int numSources,
+  vector<Int>& sources,
+  vector<Int>& targets,
+  vector<Ring>* values,
+  set<pair<Int,Int>>& markedForRemoval,
+  vector<Int>& offsets )
+{
+    EL_DEBUG_CSE
+    const Int numEntries = sources.size();
+    EL_DEBUG_ONLY(
+      if( Int(targets.size()) != numEntries ||
+          (values != nullptr && Int(values->size()) != numEntries) )
+          LogicError("Inconsistent queue sizes");
+      for( Int e=0; e<numEntries; ++e )
+          if( sources[e] < firstSource ||
+              sources[e] >= firstSource+numSources )
+              LogicError
+              ("Source ",sources[e]," was not in [",firstSource,",",
+               firstSource+numSources,")");
+    )
+
+    bool ordered = true;
+    for( Int e=1; e<numEntries; ++e )
+    {
+        if( sources[e] < sources[e-1] ||
+            (sources[e] == sources[e-1] && targets[e] < targets[e-1]) )
+        {
+            ordered = false;
+            break;
+        }
+    }
+
+    if( !ordered )
+    {
+        // Bucket the queue by source
+        vector<Int> bucketTargets;
+        vector<Ring> bucketValues;
+        assemble::BucketBySource
+        ( firstSource, numSources, sources, targets, values, offsets,
+          bucketTargets, bucketValues );
+
+        // Sort each bucket by target
+        Int* targetBuf = bucketTargets.data();
+        Ring* valueBuf = ( values==nullptr ? nullptr : bucketValues.data() );
+        const Int* offsetBuf = offsets.data();
+        Int* sourceBuf = sources.data();
+        EL_PARALLEL_FOR
+        for( Int s=0; s<numSources; ++s )
+        {
+            const Int off = offsetBuf[s];
+            const Int length = offsetBuf[s+1] - off;
+            assemble::SortBucket
+            ( &targetBuf[off],
+              valueBuf==nullptr ? nullptr : &valueBuf[off], length );
+            for( Int e=off; e<off+length; ++e )
+                sourceBuf[e] = firstSource + s;
+        }
+        targets.swap( bucketTargets );
+        if( values != nullptr )
+            values->swap( bucketValues );
+    }
+
+    // Combine duplicates and drop removals by merging against the (sorted) set
+    auto removal = markedForRemoval.begin();
+    const auto removalEnd = markedForRemoval.end();
+    Int numKept = 0;
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int source = sources[e];
+        const Int target = targets[e];
+        if( removal != removalEnd )
+        {
+            const pair<Int,Int> key(source,target);
+            while( removal != removalEnd && *removal < key )
+                ++removal;
+            if( removal != removalEnd && *removal == key )
+                continue;
+        }
+        if( numKept > 0 && sources[numKept-1] == source &&
+            targets[numKept-1] == target )
+        {
+            if( values != nullptr )
+                (*values)[numKept-1] += (*values)[e];
+            continue;
+        }
+        sources[numKept] = source;
+        targets[numKept] = target;
+        if( values != nullptr )
+            (*values)[numKept] = (*values)[e];
+        ++numKept;
+    }
+    sources.resize( numKept );
+    targets.resize( numKept );
+    if( values != nullptr )
+        values->resize( numKept );
+    SwapClear( markedForRemoval );
+
+    offsets.assign( numSources+1, 0 );
+    for( Int e=0; e<numKept; ++e )
+        ++offsets[sources[e]-firstSource+1];
+    for( Int s=0; s<numSources; ++s )
+        offsets[s+1] += offsets[s];
+}
+
+// The pattern-only analogue for graphs
+inline void AssembleQueues
+( Int firstSource,
+  Int numSources,
+  vector<Int>& sources,
+  vector<Int>& targets,
+  set<pair<Int,Int>>& markedForRemoval,
+  vector<Int>& offsets )
+{
+    vector<Int>* noValues = nullptr;
+    AssembleQueues
+    ( firstSource, numSources, sources, targets, noValues, markedForRemoval,
+      offsets );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_GRAPH_ASSEMBLE_HPP
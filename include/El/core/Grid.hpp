@@ -184,6 +184,16 @@ inline bool GridCompare
     return true;
 }
 
+// Tuned parameters for routines distributed over the given grid
+template<typename T>
+Int TunedBlocksize( const string& routine, const Grid& grid )
+{ return TunedBlocksize<T>( routine, grid.Height(), grid.Width() ); }
+template<typename T>
+double TunedParameter
+( const string& name, const Grid& grid, double defaultValue )
+{ return TunedParameter<T>
+  ( name, grid.Height(), grid.Width(), defaultValue ); }
+
 } // namespace El
 
 #endif // ifndef EL_GRID_HPP
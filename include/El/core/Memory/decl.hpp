@@ -11,6 +11,77 @@
 
 namespace El {
 
+// Pooled allocation
+// =================
+// Every buffer handed out by the pool is aligned to memoryAlignment bytes.
+// Freed buffers are kept in per-thread free lists indexed by size class
+// (sizes are rounded up to within 25% of the request) so that the workspaces
+// of repeated redistributions and blocked factorizations are recycled rather
+// than returned to, and re-requested from, the system. A buffer is cached by
+// the thread which frees it.
+const size_t memoryAlignment = 64;
+
+struct MemoryCtrl
+{
+    // Whether freed buffers should be kept for reuse
+    bool pool=true;
+    // The maximum number of bytes held in the free lists of each thread
+    size_t maxPooledBytes=size_t(1)<<26;
+    // Buffers of at least this many bytes are backed by transparent huge
+    // pages where supported (zero disables)
+    size_t hugePageThreshold=0;
+    // New buffers of at least this many bytes are first touched by all of
+    // the OpenMP threads so that their pages are spread over the NUMA
+    // domains of the threads which will use them (zero disables)
+    size_t firstTouchThreshold=0;
+};
+
+struct MemoryStats
+{
+    size_t bytesInUse=0;
+    size_t peakBytesInUse=0;
+    size_t bytesPooled=0;
+    size_t numAllocations=0;
+    size_t numPoolHits=0;
+};
+
+void SetMemoryCtrl( const MemoryCtrl& ctrl );
+MemoryCtrl GetMemoryCtrl();
+MemoryStats GetMemoryStats();
+void ResetPeakMemoryUsage();
+// Return all buffers held in the free lists of every thread to the system
+void ReleasePooledMemory();
+
+// Returns uninitialized, aligned storage for at least 'numBytes' bytes
+void* PooledAllocate( size_t numBytes );
+// 'numBytes' must match the corresponding PooledAllocate request
+void PooledDeallocate( void* ptr, size_t numBytes ) EL_NO_EXCEPT;
+
+// A standard allocator drawing from the pool, e.g., for communication buffers
+template<typename T>
+struct PoolAllocator
+{
+    typedef T value_type;
+
+    PoolAllocator() EL_NO_EXCEPT { }
+    template<typename S>
+    PoolAllocator( const PoolAllocator<S>& ) EL_NO_EXCEPT { }
+
+    T* allocate( size_t n )
+    { return static_cast<T*>(PooledAllocate(n*sizeof(T))); }
+    void deallocate( T* ptr, size_t n ) EL_NO_EXCEPT
+    { PooledDeallocate( ptr, n*sizeof(T) ); }
+};
+template<typename S,typename T>
+bool operator==( const PoolAllocator<S>&, const PoolAllocator<T>& )
+{ return true; }
+template<typename S,typename T>
+bool operator!=( const PoolAllocator<S>&, const PoolAllocator<T>& )
+{ return false; }
+
+template<typename T>
+using PooledVector = vector<T,PoolAllocator<T>>;
+
 template<typename G>
 class Memory
 {
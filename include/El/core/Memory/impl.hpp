@@ -11,14 +11,33 @@ namespace El {
 
 namespace {
 
-template<typename G>
+// Packed datatypes are drawn from the aligned memory pool, whereas types
+// which require construction are still allocated with new[]
+template<typename G,
+         typename=EnableIf<IsPacked<G>>>
+static G* New( size_t size )
+{
+    return static_cast<G*>(PooledAllocate( size*sizeof(G) ));
+}
+template<typename G,
+         typename=DisableIf<IsPacked<G>>,
+         typename=void>
 static G* New( size_t size )
 {
     return new G[size];
 }
 
-template<typename G>
-static void Delete( G*& ptr )
+template<typename G,
+         typename=EnableIf<IsPacked<G>>>
+static void Delete( G*& ptr, size_t size )
+{
+    PooledDeallocate( ptr, size*sizeof(G) );
+    ptr = nullptr;
+}
+template<typename G,
+         typename=DisableIf<IsPacked<G>>,
+         typename=void>
+static void Delete( G*& ptr, size_t size )
 {
     delete[] ptr;
     ptr = nullptr;
@@ -56,7 +75,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
 }
 
 template<typename G>
@@ -70,13 +89,12 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_ );
 
 #ifndef EL_RELEASE
         try {
 #endif
 
-            // TODO: Optionally overallocate to force alignment of buffer_
             rawBuffer_ = New<G>( size );
             buffer_ = rawBuffer_;
 
@@ -110,7 +128,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
     buffer_ = nullptr;
     size_ = 0;
 }
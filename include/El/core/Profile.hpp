@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROFILE_HPP
+#define EL_PROFILE_HPP
+
+namespace El {
+namespace profile {
+
+// When Elemental is configured with EL_PROFILE, each EL_DEBUG_CSE call site
+// (including those of release builds) opens a profiling region. While
+// profiling is disabled, which is the default, a region costs a single load
+// and branch. While it is enabled, the wall time of each region is recorded
+// on the master thread, along with the flops reported through AddFlops
+// (which the sequential level-3 BLAS wrappers do automatically) and the MPI
+// traffic issued by the mpi wrappers, broken down by communicator.
+//
+// Profiling can also be driven by the environment: if EL_PROFILE_TRACE is
+// set to a filename prefix during Initialize, profiling is enabled and, at
+// Finalize, each rank writes a trace to '<prefix>-<rank>.json' and the
+// aggregated summary is printed from the root of COMM_WORLD.
+
+extern bool profilingEnabled;
+inline bool Enabled() EL_NO_EXCEPT { return profilingEnabled; }
+
+void Enable();
+void Disable();
+
+// Discard all of the recorded regions, events and traffic
+void Reset();
+
+// Regions nested more than 'maxDepth' deep are aggregated in the summary but
+// are not written to the trace, and at most 'maxEvents' trace events are kept
+// per rank (the defaults are 8 and 10^6).
+void SetMaxTraceDepth( Int maxDepth );
+void SetMaxTraceEvents( Int maxEvents );
+
+void Begin( const char* name );
+void End();
+
+// Attribute 'flops' (real) floating-point operations to the current region
+void AddFlops( double flops );
+
+// Attribute one message of 'numBytes' bytes over 'comm' to the innermost
+// region outside of the mpi wrappers
+void CountComm( mpi::Comm comm, size_t numBytes );
+
+// Communicators are reported by name, e.g., "MC" for those of a Grid, and
+// otherwise by their size
+void NameComm( mpi::Comm comm, const string& name );
+void ForgetComm( mpi::Comm comm );
+
+// Write the events of this rank to '<basename>-<rank>.json' in the Chrome
+// trace event format (which is also understood by Perfetto)
+void WriteTrace( const string& basename );
+
+// Print the per-region and per-communicator totals, aggregated over 'comm',
+// from its root. This routine is collective over 'comm'.
+void PrintSummary
+( mpi::Comm comm=mpi::COMM_WORLD, ostream& os=cout, Int maxRows=50 );
+
+// Called by Initialize and Finalize to support EL_PROFILE_TRACE
+void Initialize();
+void Finalize();
+
+class Region
+{
+public:
+    explicit Region( const char* name )
+    : active_(profilingEnabled)
+    { if( active_ ) Begin( name ); }
+
+    ~Region() { if( active_ ) End(); }
+private:
+    bool active_;
+};
+
+} // namespace profile
+} // namespace El
+
+#endif // ifndef EL_PROFILE_HPP
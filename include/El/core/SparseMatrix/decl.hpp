@@ -141,12 +141,6 @@ private:
     El::Graph graph_;
     vector<Ring> vals_;
 
-    struct CompareEntriesFunctor
-    {
-        bool operator()(const Entry<Ring>& a, const Entry<Ring>& b )
-        { return a.i < b.i || (a.i == b.i && a.j < b.j); }
-    };
-
     template<typename U> friend class DistSparseMatrix;
     template<typename U>
     friend void CopyFromRoot
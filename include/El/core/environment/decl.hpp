@@ -93,6 +93,47 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// For tuned, per-routine blocksizes and algorithmic crossover parameters.
+// Entries are keyed on the routine (or parameter) name, the scalar type name,
+// and the process grid shape (1 x 1 for sequential routines). A lookup first
+// searches for an exact match, then for an entry with a 0 x 0 (i.e., any)
+// grid shape, and then falls back to Blocksize() (or the provided default).
+// A blocksize which was explicitly set, or pushed onto the blocksize stack
+// after Initialize(), takes precedence over tuned blocksizes.
+Int TunedBlocksize
+( const string& routine, const string& typeName,
+  int gridHeight=1, int gridWidth=1 );
+void SetTunedBlocksize
+( const string& routine, const string& typeName,
+  int gridHeight, int gridWidth, Int blocksize );
+double TunedParameter
+( const string& name, const string& typeName,
+  int gridHeight, int gridWidth, double defaultValue );
+void SetTunedParameter
+( const string& name, const string& typeName,
+  int gridHeight, int gridWidth, double value );
+void ClearTuning();
+// Changes whenever a tuned value is set or cleared, so that frequently
+// consulted entries can be cached between changes
+Int TuningGeneration();
+
+// Tuning files consist of lines of the form
+//   blocksize <routine> <type> <gridHeight> <gridWidth> <value>
+//   parameter <name> <type> <gridHeight> <gridWidth> <value>
+// with '#' beginning a comment. If the environment variable EL_TUNING_FILE
+// is set, the named file is loaded by Initialize().
+void LoadTuningFile( const string& filename );
+void SaveTuningFile( const string& filename );
+
+template<typename T>
+Int TunedBlocksize( const string& routine, int gridHeight=1, int gridWidth=1 )
+{ return TunedBlocksize( routine, TypeName<T>(), gridHeight, gridWidth ); }
+template<typename T>
+double TunedParameter
+( const string& name, int gridHeight, int gridWidth, double defaultValue )
+{ return TunedParameter
+  ( name, TypeName<T>(), gridHeight, gridWidth, defaultValue ); }
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -168,13 +209,13 @@ void SwapClear( T& x );
 
 // Reserve memory in a vector without zero-initializing the variables unless
 // valgrind is currently running or the datatype *requires* construction.
-template<typename T,
+template<typename T,typename Alloc,
          typename=EnableIf<IsPacked<T>>>
-void FastResize( vector<T>& v, Int numEntries );
-template<typename T,
+void FastResize( vector<T,Alloc>& v, Int numEntries );
+template<typename T,typename Alloc,
          typename=DisableIf<IsPacked<T>>,
          typename=void>
-void FastResize( vector<T>& v, Int numEntries );
+void FastResize( vector<T,Alloc>& v, Int numEntries );
 
 inline void BuildStream( ostringstream& ) { }
 
@@ -399,7 +440,9 @@ Int Find( const vector<Int>& sortedInds, Int index );
  El::LogicError(EL_FUNCTION," in ",__FILE__,"@",__LINE__,": ",__VA_ARGS__);
 #define EL_RUNTIME_ERROR(...) \
  El::RuntimeError(EL_FUNCTION," in ",__FILE__,"@",__LINE__,": ",__VA_ARGS__);
-#define EL_DEBUG_CSE EL_DEBUG_ONLY(El::CSE cse(EL_FUNCTION))
+#define EL_DEBUG_CSE \
+ EL_DEBUG_ONLY(El::CSE cse(EL_FUNCTION)) \
+ EL_PROFILE_ONLY(El::profile::Region profileRegion(EL_FUNCTION))
 
 } // namespace El
 
@@ -140,9 +140,9 @@ void MemZero( T* buffer, size_t numEntries )
 template<typename T>
 void SwapClear( T& x ) { T().swap( x ); }
 
-template<typename T,
+template<typename T,typename Alloc,
          typename/*=EnableIf<IsPacked<T>>*/>
-void FastResize( vector<T>& v, Int numEntries )
+void FastResize( vector<T,Alloc>& v, Int numEntries )
 {
 #ifdef EL_ZERO_INIT
     v.resize( numEntries );
@@ -155,10 +155,10 @@ void FastResize( vector<T>& v, Int numEntries )
     v.reserve( numEntries );
 #endif
 }
-template<typename T,
+template<typename T,typename Alloc,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
-void FastResize( vector<T>& v, Int numEntries )
+void FastResize( vector<T,Alloc>& v, Int numEntries )
 { v.resize( numEntries ); }
 
 template<typename T,typename... ArgPack>
@@ -22,6 +22,7 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -76,9 +77,16 @@ inline bool operator==( const Op& a, const Op& b ) EL_NO_EXCEPT
 inline bool operator!=( const Op& a, const Op& b ) EL_NO_EXCEPT
 { return a.op != b.op; }
 
+struct File
+{
+    MPI_File file;
+    File( MPI_File mpiFile=MPI_FILE_NULL ) EL_NO_EXCEPT : file(mpiFile) { }
+};
+
 // Datatype definitions
 // TODO(poulson): Convert these to structs/classes
 typedef MPI_Aint Aint;
+typedef MPI_Offset Offset;
 typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
 typedef MPI_Status Status;
@@ -95,6 +103,10 @@ struct Request
     bool receivingPacked=false;
     int recvCount;
     T* unpackedRecvBuf;
+
+    // If set, the request was created by a persistent-collective *Init
+    // routine and Start reissues the communication through this function
+    function<void(Request<T>&)> restart;
 };
 
 // Standard constants
@@ -131,6 +143,9 @@ const Op LOGICAL_XOR = MPI_LXOR;
 const Op BINARY_AND = MPI_BAND;
 const Op BINARY_OR = MPI_BOR;
 const Op BINARY_XOR = MPI_BXOR;
+const int MODE_RDONLY = MPI_MODE_RDONLY;
+const int MODE_WRONLY = MPI_MODE_WRONLY;
+const int MODE_CREATE = MPI_MODE_CREATE;
 
 template<typename T>
 struct Types
@@ -228,6 +243,23 @@ void Create( UserFunction* func, bool commutes, Op& op ) EL_NO_RELEASE_EXCEPT;
 void Free( Op& op ) EL_NO_RELEASE_EXCEPT;
 void Free( Datatype& type ) EL_NO_RELEASE_EXCEPT;
 
+// Derived datatypes
+void Commit( Datatype& type ) EL_NO_RELEASE_EXCEPT;
+void CreateContiguous
+( int count, Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void CreateVector
+( int count, int blockLength, int stride,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void CreateIndexed
+( int count, const int* blockLengths, const int* displs,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void CreateHIndexed
+( int count, const int* blockLengths, const Aint* displs,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+void CreateResized
+( Datatype oldType, Aint lowerBound, Aint extent,
+  Datatype& newType ) EL_NO_RELEASE_EXCEPT;
+
 // Communicator manipulation
 int Rank( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
 int Size( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
@@ -235,6 +267,9 @@ void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split 'comm' into the subcommunicators of processes which can share memory
+// (i.e., which run on the same node)
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
@@ -317,6 +352,27 @@ bool IProbe
 template<typename T>
 int GetCount( Status& status ) EL_NO_RELEASE_EXCEPT;
 
+// Parallel I/O
+// NOTE: Failing to open a file is reported even in Release builds
+void FileOpen
+( Comm comm, const std::string& filename, int mode, File& file );
+void FileClose( File& file ) EL_NO_RELEASE_EXCEPT;
+Offset FileGetSize( File file ) EL_NO_RELEASE_EXCEPT;
+void FileSetSize( File file, Offset size ) EL_NO_RELEASE_EXCEPT;
+void FileSetView
+( File file, Offset disp, Datatype etype, Datatype fileType )
+EL_NO_RELEASE_EXCEPT;
+void FileReadAtAll
+( File file, Offset offset, void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT;
+void FileWriteAtAll
+( File file, Offset offset, const void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT;
+void FileReadAll( File file, void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT;
+void FileWriteAll( File file, const void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT;
+
 template<typename T>
 void SetUserReduceFunc
 ( function<T(const T&,const T&)> func, bool commutative=true )
@@ -728,6 +784,30 @@ void AllGather
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllGather
+// ----------------------
+// NOTE: The send and receive buffers must not be modified until the request
+//       has been waited on
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real,
@@ -834,6 +914,30 @@ void AllToAll
         T* rbuf, const int* rcs, const int* rds, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllToAll
+// ---------------------
+// NOTE: The send and receive buffers must not be modified until the request
+//       has been waited on
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
 template<typename T>
 vector<T> AllToAll
 ( const vector<T>& sendBuf,
@@ -1022,6 +1126,30 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllReduce
+// ----------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request );
+
 // ReduceScatter
 // -------------
 template<typename Real,
@@ -1128,6 +1256,31 @@ template<typename T>
 void ReduceScatter( const T* sbuf, T* rbuf, const int* rcs, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking ReduceScatter
+// --------------------------
+// The send buffer holds rc entries destined for each process in comm
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, Comm comm,
+  Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // Scan
 // ----
 template<typename Real,
@@ -1217,6 +1370,63 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void Scan( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Persistent communication
+// ------------------------
+// Each *Init routine fixes the buffers and arguments of a communication
+// without starting it. The request is activated by Start, completed with
+// Wait or Test, and may then be restarted any number of times before being
+// released with Free. Point-to-point requests of packed datatypes map onto
+// MPI's persistent requests; the remaining requests, including all of the
+// collectives, reissue the corresponding non-blocking routine on each Start.
+template<typename T>
+void Start( Request<T>& request );
+template<typename T>
+void StartAll( int numRequests, Request<T>* requests );
+template<typename T>
+void Free( Request<T>& request );
+
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void SendInit
+( const Real* buf, int count, int to, Comm comm, Request<Real>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void SendInit
+( const T* buf, int count, int to, Comm comm, Request<T>& request );
+
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void RecvInit
+( Real* buf, int count, int from, Comm comm, Request<Real>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void RecvInit
+( T* buf, int count, int from, Comm comm, Request<T>& request );
+
+template<typename T>
+void BroadcastInit
+( T* buf, int count, int root, Comm comm, Request<T>& request );
+template<typename T>
+void AllGatherInit
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+template<typename T>
+void AllToAllInit
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+template<typename T>
+void AllReduceInit
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request );
+template<typename T>
+void ReduceScatterInit
+( const T* sbuf, T* rbuf, int rc, Op op, Comm comm,
+  Request<T>& request );
+
 template<typename T>
 void SparseAllToAll
 ( const vector<T>& sendBuffer,
@@ -99,6 +99,46 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random number generation
+// ======================================
+// Rather than advancing a sequential generator, the Philox4x32-10 generator
+// of Salmon et al. maps a 64-bit key and a 128-bit counter to 128 random bits.
+// Drawing the sample for entry (i,j) of a matrix from the counter (i,j) of a
+// fresh stream therefore allows the entries to be generated independently, in
+// parallel, and identically for every distribution and process grid.
+
+struct RandomKey
+{
+    std::uint32_t word[2];
+};
+
+// Returns the key of a fresh stream. The seed of the streams does not depend
+// upon the process rank, but the index of the stream is local to each
+// process, so distributed fills draw the key on a single process and
+// broadcast it.
+RandomKey NewRandomStream();
+
+// Restart the sequence of streams from the given seed.
+void SetRandomStreamSeed( unsigned long long seed );
+
+// Overwrite the counter with the corresponding 128 random bits.
+void Philox( const RandomKey& key, std::uint32_t counter[4] );
+
+// A sample from the uniform distribution over [0,1) (for float and double).
+template<typename Real>
+Real CounterSampleUniform( const RandomKey& key, Int i, Int j );
+
+// Counter-based analogues of SampleNormal and SampleBall for (possibly
+// complex) float and double.
+template<typename F>
+F CounterSampleNormal
+( const RandomKey& key, Int i, Int j,
+  const F& mean=F(0), const Base<F>& stddev=Base<F>(1) );
+template<typename F>
+F CounterSampleBall
+( const RandomKey& key, Int i, Int j,
+  const F& center=F(0), const Base<F>& radius=Base<F>(1) );
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
@@ -223,6 +223,104 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(center-radius,center+radius); }
 
+inline void Philox( const RandomKey& key, std::uint32_t counter[4] )
+{
+    const std::uint32_t multiplier0=0xD2511F53, multiplier1=0xCD9E8D57;
+    const std::uint32_t weyl0=0x9E3779B9, weyl1=0xBB67AE85;
+    std::uint32_t key0=key.word[0], key1=key.word[1];
+    for( Int round=0; round<10; ++round )
+    {
+        const std::uint64_t product0 = std::uint64_t(multiplier0)*counter[0];
+        const std::uint64_t product1 = std::uint64_t(multiplier1)*counter[2];
+        const std::uint32_t newCounter0 =
+          std::uint32_t(product1 >> 32) ^ counter[1] ^ key0;
+        const std::uint32_t newCounter2 =
+          std::uint32_t(product0 >> 32) ^ counter[3] ^ key1;
+        counter[0] = newCounter0;
+        counter[1] = std::uint32_t(product1);
+        counter[2] = newCounter2;
+        counter[3] = std::uint32_t(product0);
+        key0 += weyl0;
+        key1 += weyl1;
+    }
+}
+
+// Map 64 random bits to [0,1) using as many of them as the precision allows
+template<typename Real>
+inline Real UnitIntervalFromBits( std::uint32_t high, std::uint32_t low )
+{
+    if( sizeof(Real) <= sizeof(float) )
+        return Real(high >> 8)*Real(1.f/16777216.f);
+    const std::uint64_t bits = ((std::uint64_t(high) << 32) | low) >> 11;
+    return Real(double(bits)*(1./9007199254740992.));
+}
+
+inline void PhiloxEntry
+( const RandomKey& key, Int i, Int j, std::uint32_t counter[4] )
+{
+    counter[0] = std::uint32_t(i);
+    counter[1] = std::uint32_t(std::uint64_t(i) >> 32);
+    counter[2] = std::uint32_t(j);
+    counter[3] = std::uint32_t(std::uint64_t(j) >> 32);
+    Philox( key, counter );
+}
+
+template<typename Real>
+inline Real CounterSampleUniform( const RandomKey& key, Int i, Int j )
+{
+    std::uint32_t counter[4];
+    PhiloxEntry( key, i, j, counter );
+    return UnitIntervalFromBits<Real>( counter[0], counter[1] );
+}
+
+// The Box-Muller transform of the two uniform samples associated with (i,j)
+template<typename F>
+inline F CounterSampleNormal
+( const RandomKey& key, Int i, Int j, const F& mean, const Base<F>& stddev )
+{
+    typedef Base<F> Real;
+    std::uint32_t counter[4];
+    PhiloxEntry( key, i, j, counter );
+    const Real u0 = UnitIntervalFromBits<Real>( counter[0], counter[1] );
+    const Real u1 = UnitIntervalFromBits<Real>( counter[2], counter[3] );
+    const Real radius = std::sqrt( -2*std::log(1-u0) );
+    const Real angle = 2*Pi<Real>()*u1;
+    F sample = mean;
+    if( IsComplex<F>::value )
+    {
+        const Real stddevAdj = stddev / std::sqrt(Real(2));
+        SetRealPart( sample, RealPart(mean)+stddevAdj*radius*std::cos(angle) );
+        SetImagPart( sample, ImagPart(mean)+stddevAdj*radius*std::sin(angle) );
+    }
+    else
+        SetRealPart( sample, RealPart(mean)+stddev*radius*std::cos(angle) );
+    return sample;
+}
+
+// Mirrors SampleBall: a uniform sample from [center-radius,center+radius]
+// for real fields and a sample with uniform radius and angle for complex ones
+template<typename F>
+inline F CounterSampleBall
+( const RandomKey& key, Int i, Int j, const F& center, const Base<F>& radius )
+{
+    typedef Base<F> Real;
+    std::uint32_t counter[4];
+    PhiloxEntry( key, i, j, counter );
+    const Real u0 = UnitIntervalFromBits<Real>( counter[0], counter[1] );
+    const Real u1 = UnitIntervalFromBits<Real>( counter[2], counter[3] );
+    F sample = center;
+    if( IsComplex<F>::value )
+    {
+        const Real r = radius*u0;
+        const Real angle = 2*Pi<Real>()*u1;
+        SetRealPart( sample, RealPart(center)+r*std::cos(angle) );
+        SetImagPart( sample, ImagPart(center)+r*std::sin(angle) );
+    }
+    else
+        SetRealPart( sample, RealPart(center)-radius+2*radius*u0 );
+    return sample;
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
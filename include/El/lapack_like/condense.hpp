@@ -107,6 +107,13 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+
+    // Reduce first to a band of width 'bandwidth' with level-3 updates and
+    // then chase the band down to tridiagonal form (see
+    // herm_tridiag::TwoStage). This is currently only supported for
+    // sequential matrices.
+    bool twoStage=false;
+    Int bandwidth=32;
 };
 
 template<typename Field>
@@ -141,6 +148,54 @@ void ApplyQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Two-stage reduction to tridiagonal form
+// ---------------------------------------
+// A = Q T Q^H is first reduced to a band of the given width (with block
+// reflectors whose application is dominated by Gemm), and the band is then
+// reduced to tridiagonal form by bulge chasing. Only the triangle of A
+// specified by 'uplo' is referenced on entry, and A is overwritten. The
+// real diagonal and the subdiagonal of T are returned in 'd' and 'dSub'.
+
+// The (implicit) unitary Q from a two-stage reduction
+template<typename Field>
+struct TwoStageQ
+{
+    Int bandwidth=0;
+
+    // The offset of, the unit-lower-trapezoidal V of, and the
+    // upper-triangular T of each block reflector, I - V T V^H, of the first
+    // stage
+    vector<Int> panelOffsets;
+    vector<Matrix<Field>> panelReflectors, panelFactors;
+
+    // The offset and scalar of each reflector, I - tau u u^H, of the second
+    // stage, with each u stored (with its unit first entry) in a column of
+    // height 'bandwidth' of 'chaseReflectors'
+    vector<Int> chaseOffsets;
+    vector<Field> chaseScalars;
+    vector<Field> chaseReflectors;
+};
+
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  Matrix<Base<Field>>& d,
+  Matrix<Field>& dSub,
+  TwoStageQ<Field>& Q,
+  Int bandwidth=32 );
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  Matrix<Base<Field>>& d,
+  Matrix<Field>& dSub,
+  Int bandwidth=32 );
+
+// B := Q B
+template<typename Field>
+void ApplyQ( const TwoStageQ<Field>& Q, Matrix<Field>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -18,12 +18,25 @@ namespace El {
 
 // Cholesky
 // ========
+struct CholeskyCtrl
+{
+    bool scalapack=false;
+
+    // Pipeline the panels of the blocked [MC,MR] factorization: the next
+    // panel is updated, factored, and its redistribution started before the
+    // bulk of the current trailing update, which then overlaps with it
+    bool lookahead=false;
+};
+
 template<typename Field>
 void Cholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A, bool scalapack=false );
 template<typename Field>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<Field>& A, const CholeskyCtrl& ctrl );
+template<typename Field>
 void Cholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR>& A );
 
 template<typename Field>
@@ -347,16 +360,20 @@ Int SolveAfter
 // LU
 // ==
 
-// NOTE: This is not yet made use of, but the fully-pivoted version of LU
-//       should (soon?) accept it as an argument and potentially return one or
-//       more of the permutation matrices as the identity
+// NOTE: The partially-pivoted LU accepts LU_PARTIAL and LU_TOURNAMENT; the
+//       fully-pivoted version of LU should (soon?) accept it as an argument
+//       and potentially return one or more of the permutation matrices as
+//       the identity
 namespace LUPivotTypeNS {
 enum LUPivotType
 {
     LU_PARTIAL,
     LU_FULL,
     LU_ROOK, /* not yet supported */
-    LU_WITHOUT_PIVOTING
+    LU_WITHOUT_PIVOTING,
+    // Communication-avoiding (CALU) tournament pivoting: all of the pivots of
+    // a panel are chosen with a reduction tree over the process column
+    LU_TOURNAMENT
 };
 }
 using namespace LUPivotTypeNS;
@@ -377,6 +394,30 @@ void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
 
+// LU with a choice of row-pivoting strategy
+// -----------------------------------------
+template<typename Field>
+void LU( Matrix<Field>& A, Permutation& P, LUPivotType pivotType );
+template<typename Field>
+void LU
+( AbstractDistMatrix<Field>& A, DistPermutation& P, LUPivotType pivotType );
+
+// LU with a control structure
+// ---------------------------
+struct LUCtrl
+{
+    // Either LU_PARTIAL or LU_TOURNAMENT
+    LUPivotType pivotType=LU_PARTIAL;
+
+    // Update the columns of the next panel first so that its gather to
+    // [MC,STAR] overlaps with the bulk of the current trailing update
+    bool lookahead=false;
+};
+
+template<typename Field>
+void LU
+( AbstractDistMatrix<Field>& A, DistPermutation& P, const LUCtrl& ctrl );
+
 // LU with full pivoting
 // ---------------------
 // P A Q^T = L U
@@ -562,6 +603,16 @@ struct QRCtrl
     // instead, as it is often the case that one may desire a custom pivoting
     // rule.
     bool smallestFirst=false;
+
+    // Factor the panels of distributed, unpivoted QR with TSQR (i.e., use
+    // CAQR) so that each panel requires O(log r) rather than O(nb log r)
+    // messages on an r x c process grid
+    bool caqr=false;
+
+    // Update and factor the next panel of distributed, unpivoted Householder
+    // QR before the bulk of the trailing update, which then overlaps with the
+    // gather of the new Householder vectors (ignored when caqr is set)
+    bool lookahead=false;
 };
 
 // Return an implicit representation of Q and R such that A = Q R
@@ -576,6 +627,12 @@ void QR
 ( AbstractDistMatrix<Field>& A,
   AbstractDistMatrix<Field>& householderScalars,
   AbstractDistMatrix<Base<Field>>& signature );
+template<typename Field>
+void QR
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Base<Field>>& signature,
+  const QRCtrl<Base<Field>>& ctrl );
 
 // Return an implicit representation of (Q,R,Omega) such that A Omega^T ~= Q R
 // ---------------------------------------------------------------------------
@@ -724,6 +781,13 @@ struct TreeData
     vector<Matrix<Field>> householderScalarsList;
     vector<Matrix<Base<Field>>> signatureList;
 
+    // The first stage of the reduction tree combines the triangles of each
+    // group of 'flatWidth' consecutive processes with a single (flat) QR,
+    // and the remaining stages form a binary tree over the groups. If it is
+    // not positive, ts::Reduce sets it to the number of processes per node
+    // when the nodes hold contiguous ranges of ranks (and one otherwise).
+    Int flatWidth=0;
+
     TreeData( Int numStages=0 )
     : QRList(numStages),
       householderScalarsList(numStages),
@@ -736,7 +800,8 @@ struct TreeData
       signature0(move(treeData.signature0)),
       QRList(move(treeData.QRList)),
       householderScalarsList(move(treeData.householderScalarsList)),
-      signatureList(move(treeData.signatureList))
+      signatureList(move(treeData.signatureList)),
+      flatWidth(treeData.flatWidth)
     { }
 
     TreeData<Field>& operator=( TreeData<Field>&& treeData )
@@ -747,17 +812,21 @@ struct TreeData
         QRList = move(treeData.QRList);
         householderScalarsList = move(treeData.householderScalarsList);
         signatureList = move(treeData.signatureList);
+        flatWidth = treeData.flatWidth;
         return *this;
     }
 };
 
 // Return an implicit tall-skinny QR factorization
 template<typename Field>
-TreeData<Field> TS( const AbstractDistMatrix<Field>& A );
+TreeData<Field> TS( const AbstractDistMatrix<Field>& A, Int flatWidth=0 );
 
 // Return an explicit tall-skinny QR factorization
 template<typename Field>
-void ExplicitTS( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+void ExplicitTS
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& R,
+  Int flatWidth=0 );
 
 namespace ts {
 
@@ -312,6 +312,7 @@ struct Front
     Int NumEntries() const;
     Int NumTopLeftEntries() const;
     Int NumBottomLeftEntries() const;
+    // If the sparse leaves are not yet factored, their fill-in is ignored
     double FactorGFlops() const;
     double SolveGFlops( Int numRHS=1 ) const;
 };
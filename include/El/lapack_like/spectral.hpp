@@ -1488,6 +1488,74 @@ Base<Field> LanczosDecomp
         DistMultiVec<Field>& v,
         Int basisSize=15 );
 
+// Thick-restart Lanczos
+// =====================
+// Compute a few eigenpairs of a sparse Hermitian matrix using a (block)
+// Lanczos process with full reorthogonalization which is restarted in the
+// Krylov-Schur manner: the Ritz vectors of the wanted eigenvalues are kept,
+// converged Ritz pairs are locked, and the remainder of the basis is
+// discarded.
+//
+// Eigenvalues near a shift are computed by running the iteration upon
+// (A - shift I)^{-1}, which is applied using a sparse LDL^H factorization.
+
+namespace LanczosTargetNS {
+enum LanczosTarget
+{
+  LANCZOS_SMALLEST,     // the algebraically smallest eigenvalues
+  LANCZOS_LARGEST,      // the algebraically largest eigenvalues
+  LANCZOS_NEAREST_SHIFT // the eigenvalues nearest to the shift (shift-invert)
+};
+}
+using namespace LanczosTargetNS;
+
+template<typename Real>
+struct ThickRestartLanczosCtrl
+{
+    // The number of desired eigenpairs
+    Int numEigs=6;
+
+    // The number of vectors generated (and orthogonalized) per step
+    Int blockSize=1;
+
+    // The maximum dimension of the Krylov basis. If zero, the maximum of
+    // 2*numEigs+blockSize and 20 (rounded up to a multiple of the block size)
+    // is used.
+    Int basisSize=0;
+
+    Int maxRestarts=1000;
+
+    // A Ritz pair is accepted (and locked) once its residual norm is at most
+    // tol times an estimate of the two-norm of the operator the Lanczos
+    // process is applied to (the largest magnitude of its Ritz values).
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    LanczosTarget target=LANCZOS_SMALLEST;
+    Real shift=Real(0);
+
+    bool progress=false;
+};
+
+// Returns the number of converged eigenpairs. The eigenvalues in 'w' are in
+// the order of preference of the target (e.g., ascending for
+// LANCZOS_SMALLEST), and the columns of 'X' are the corresponding
+// eigenvectors. All numEigs of the best approximations are returned even if
+// some did not converge within the maximum number of restarts.
+template<typename Field>
+Int ThickRestartLanczos
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const ThickRestartLanczosCtrl<Base<Field>>& ctrl=
+        ThickRestartLanczosCtrl<Base<Field>>() );
+template<typename Field>
+Int ThickRestartLanczos
+( const DistSparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const ThickRestartLanczosCtrl<Base<Field>>& ctrl=
+        ThickRestartLanczosCtrl<Base<Field>>() );
+
 // Product Lanczos
 // ===============
 // Form the product Lanczos decomposition
@@ -1609,6 +1677,16 @@ struct PseudospecCtrl
     // Whether or not to print progress information at each iteration
     bool progress=false;
 
+    // If shiftChunkSize is positive, the two-norm iterations are run on
+    // independent chunks of (at most) this many shifts, which are spread over
+    // the OpenMP threads or, for distributed matrices, over 'numShiftTeams'
+    // teams of processes (each of which forms its own copy of the matrix).
+    // If set, 'chunkCallback' is passed the offset of each chunk and its
+    // estimates and iteration counts as soon as they are available.
+    Int shiftChunkSize=0;
+    Int numShiftTeams=1;
+    function<void(Int,const Matrix<Real>&,const Matrix<Int>&)> chunkCallback;
+
     SnapshotCtrl snapCtrl;
 
     mutable Complex<Real> center = Complex<Real>(0);
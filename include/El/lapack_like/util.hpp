@@ -21,12 +21,69 @@ struct BisectCtrl
     Int cutoff;
     bool storeFactRecvInds;
 
+    // If false, or if METIS is not available, the built-in multilevel
+    // separator engine is used instead of (Par)METIS. Its distributed
+    // bisections never gather more than the coarsest graph, regardless of
+    // 'sequential'.
+    bool useMETIS;
+
+    // Parameters of the built-in multilevel separator engine
+    // ------------------------------------------------------
+    // Coarsening stops once the graph has at most this many vertices...
+    Int coarsenTarget;
+    // ...or when a level fails to shrink the number of vertices by this ratio
+    double coarsenRatio;
+    // The number of greedy growths to attempt on the coarsest graph
+    Int numGrowTrials;
+    // The maximum number of passes of each refinement
+    Int maxRefinePasses;
+    // The relative imbalance tolerated between the two halves (this is also
+    // passed to ParMETIS)
+    double maxImbalance;
+    // The seed of the randomized matchings and growths, which are otherwise
+    // reproducible
+    unsigned seed;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false),
+#ifdef EL_HAVE_METIS
+      useMETIS(true),
+#else
+      useMETIS(false),
+#endif
+      coarsenTarget(100), coarsenRatio(0.85), numGrowTrials(4),
+      maxRefinePasses(8), maxImbalance(1.1), seed(17)
     { }
 };
 
+// Computes a vertex separator of the symmetric graph (free of
+// self-connections) with the given compressed adjacency structure using a
+// built-in multilevel engine. On exit, 'part' holds 0 or 1 for the vertices
+// in the two halves and 2 for those in the separator. The best of
+// 'ctrl.numSeqSeps' independent attempts is returned.
+void MultilevelSeparator
+( const vector<Int>& offsets,
+  const vector<Int>& targets,
+        vector<Int>& part,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// The distributed analogue, where each process owns the contiguous set of
+// vertices beginning at 'firstLocalSource' (with adjacencies in terms of
+// global indices). The graph is coarsened by matching vertices owned by the
+// same process until it is no larger than the average local portion of the
+// original graph, only then gathered onto the root process to be split with
+// the sequential engine, and the separator is refined in parallel as it is
+// projected back. On exit, 'localPart' describes the local vertices.
+void MultilevelSeparator
+( const vector<Int>& localOffsets,
+  const vector<Int>& localTargets,
+        Int firstLocalSource,
+        Int numSources,
+        vector<Int>& localPart,
+        mpi::Comm comm,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 Int Bisect
 ( const Graph& graph,
         Graph& leftChild,
@@ -146,6 +203,31 @@ void MergeSortingPermutation
 ( Int n0, Int n1, const Matrix<Real>& x, Permutation& sortPerm,
   SortType sort=ASCENDING );
 
+// Autotuning
+// ==========
+struct AutotuneCtrl
+{
+    // The order of the matrices used to time the factorizations
+    Int factorSize=2000;
+    vector<Int> blocksizes{32,48,64,96,128,192,256};
+
+    // Gemm crossovers are timed using products of m x k and k x n matrices
+    // with m = n = gemmSize and k a multiple of gemmSize
+    Int gemmSize=500;
+    vector<double> gemmWeights{1,2,4,8,16,32};
+
+    Int numReps=2;
+    bool progress=false;
+};
+
+// Times candidate blocksizes for Cholesky, LU, and QR, as well as the
+// crossover weights used by Gemm to select between its stationary variants,
+// and records the fastest choices for the scalar type and the shape of the
+// given grid (see SetTunedBlocksize and SetTunedParameter). The results can
+// then be persisted with SaveTuningFile.
+template<typename Field>
+void Autotune( const Grid& grid, const AutotuneCtrl& ctrl=AutotuneCtrl() );
+
 } // namespace El
 
 #endif // ifndef EL_UTIL_HPP
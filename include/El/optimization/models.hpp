@@ -476,6 +476,12 @@ struct RPCACtrl
     bool usePivQR=false;
     bool progress=true;
 
+    // Threshold with svt::Randomized, warm-started from the singular
+    // subspace of the previous iteration, rather than with a full SVD
+    // (this takes precedence over usePivQR)
+    bool useRandomizedSVT=false;
+    svt::RandomizedCtrl randomizedSVTCtrl;
+
     Int numPivSteps=75;
     Int maxIts=1000;
 
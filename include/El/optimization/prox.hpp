@@ -158,6 +158,39 @@ Int TSQR
   const Base<Field>& rho,
   bool relative=false );
 
+// Randomized SVT
+// --------------
+// Thresholds the SVD of the projection of A onto a randomized sketch of its
+// range, which costs O(m n k) rather than O(m n min(m,n)) work for a result
+// of rank k. The sketch is warm-started from Q: if Q has the height of A on
+// entry, its columns are taken as an estimate of the dominant left singular
+// subspace (e.g., from the previous iteration of an ADMM method), and on
+// exit Q holds the left singular vectors which survived the threshold.
+struct RandomizedCtrl
+{
+    // The sketch width of a cold start, before oversampling
+    Int initialRank=10;
+    // The number of Gaussian columns added to the sketch
+    Int oversample=10;
+    // The number of subspace (power) iterations applied to the sketch
+    Int numPowerIts=1;
+};
+
+template<typename Field>
+Int Randomized
+( Matrix<Field>& A,
+  const Base<Field>& rho,
+  Matrix<Field>& Q,
+  const RandomizedCtrl& ctrl=RandomizedCtrl(),
+  bool relative=false );
+template<typename Field>
+Int Randomized
+( AbstractDistMatrix<Field>& A,
+  const Base<Field>& rho,
+  AbstractDistMatrix<Field>& Q,
+  const RandomizedCtrl& ctrl=RandomizedCtrl(),
+  bool relative=false );
+
 } // namespace svt
 
 // Soft-thresholding
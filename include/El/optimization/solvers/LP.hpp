@@ -255,6 +255,15 @@ void LP
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
   const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
+// Solve one of a sequence of LPs whose constraint matrices share a sparsity
+// pattern while reusing the analysis, equilibration, and solution of the
+// previous solves (see SparseIPMSession)
+template<typename Real>
+void LP
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        SparseIPMSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
 template<typename Real>
 void LP
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
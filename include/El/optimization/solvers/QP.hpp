@@ -132,6 +132,20 @@ void QP
         Matrix<Real>& y,
         Matrix<Real>& z,
   const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
+// Solve one of a sequence of QPs whose matrices share a sparsity pattern
+// while reusing the analysis, equilibration, and solution of the previous
+// solves (see SparseIPMSession)
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        SparseIPMSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
 template<typename Real>
 void QP
 ( const DistSparseMatrix<Real>& Q,
@@ -161,6 +161,100 @@ struct MehrotraCtrl
     // replace the default, (muAff/mu)^3
 };
 
+// State carried between the Interior Point solutions of a sequence of
+// sparse (sequential) LPs or QPs which share the sparsity pattern of their
+// constraint (and quadratic) matrices, e.g., when only the costs and the
+// right-hand sides change from one problem to the next. The nested dissection
+// and symbolic analysis of the KKT system are then only computed once, the
+// outer Ruiz equilibration is reused for as long as the matrices are
+// unchanged, and each solve is warm-started from the previous solution.
+//
+// Sessions are only supported by the sequential sparse solvers; the
+// distributed (DistSparseMatrix) solvers do not yet accept one.
+template<typename Real>
+struct SparseIPMSession
+{
+    // Reuse the reordering and symbolic analysis of the KKT system when the
+    // sparsity patterns match those of the previous solve?
+    bool reuseAnalysis=true;
+
+    // Reuse the outer equilibration when the matrices are unchanged?
+    bool reuseEquilibration=true;
+
+    // Initialize each solve from the solution of the previous one? This is
+    // ignored if the control structure marks the variables as user-initialized.
+    bool warmStart=true;
+
+    // The warm start is the combination
+    //
+    //   weight (x,y,z)_prev + (1-weight) (x,y,z)_cold
+    //
+    // of the previous solution and the standard (cold) initial point, which
+    // keeps x and z strictly interior and roughly as well-centered as the
+    // cold start while retaining most of the progress of the previous solve.
+    Real warmStartWeight=Real(0.99);
+
+    // Statistics
+    // ----------
+    Int numSolves=0;
+    Int numAnalyses=0, numAnalysisReuses=0;
+    Int numEquilibrations=0, numEquilibrationReuses=0;
+    Int numWarmStarts=0;
+    // The number of Interior Point iterations of the latest solve
+    Int numIterations=0;
+    double analysisTime=0, equilibrationTime=0;
+    // An estimate of the time saved by reuse, based upon the average costs of
+    // the analyses and equilibrations which were performed
+    double timeSaved=0;
+
+    // Cached state (maintained by the solvers)
+    // ----------------------------------------
+    KKTSystem system=AUGMENTED_KKT;
+    bool analyzed=false, equilibrated=false, haveSolution=false;
+    // Whether the current solve was initialized with the previous solution
+    bool warmStarted=false;
+    SparseLDLFactorization<Real> sparseLDLFact;
+    SparseMatrix<Real> QOrig, AOrig, QEquil, AEquil;
+    Matrix<Real> rowScale, colScale;
+    Matrix<Real> x, y, z;
+
+    // Invalidate the cached state (but not the statistics).
+    void Clear();
+
+    // Invalidate whichever cached state does not apply to a solve of a problem
+    // with the given quadratic and constraint matrices (Q is empty for LPs).
+    void Prepare
+    ( const SparseMatrix<Real>& Q,
+      const SparseMatrix<Real>& A,
+            KKTSystem newSystem );
+
+    // Either initialize 'sparseLDLFact' with a reordering and symbolic
+    // analysis of J or, if a compatible analysis is cached, only update its
+    // nonzero values.
+    void Analyze( const SparseMatrix<Real>& J );
+
+    // Overwrite the primal and dual variables with the previous solution and
+    // return true if warm-starting is enabled and a solution of the same
+    // dimensions is available.
+    bool WarmStart( Matrix<Real>& xInit, Matrix<Real>& yInit,
+                    Matrix<Real>& zInit );
+
+    // Overwrite the cold initial point, (x,y,z), with its combination with
+    // the (equilibrated) previous solution (see 'warmStartWeight').
+    void BlendWarmStart
+    ( const Matrix<Real>& xPrev, const Matrix<Real>& yPrev,
+      const Matrix<Real>& zPrev,
+            Matrix<Real>& xInit, Matrix<Real>& yInit,
+            Matrix<Real>& zInit ) const;
+
+    // Record the solution of the latest solve.
+    void Finish
+    ( const Matrix<Real>& xSol, const Matrix<Real>& ySol,
+      const Matrix<Real>& zSol );
+
+    void PrintStats() const;
+};
+
 // Alternating Direction Method of Multipliers
 // ===========================================
 template<typename Real>
@@ -8,27 +8,86 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
+#include <map>
 #include <stack>
+#include <tuple>
 
 namespace {
 using namespace El;
 
 std::stack<Int> blocksizeStack;
+// Whether SetBlocksize has been called since the stack was last emptied
+bool setBlocksize = false;
+
+// (name, type, grid height, grid width)
+typedef std::tuple<string,string,int,int> TuningKey;
+std::map<TuningKey,Int> tunedBlocksizes;
+std::map<TuningKey,double> tunedParameters;
+
+template<typename T>
+bool LookupTuned
+( const std::map<TuningKey,T>& table,
+  const string& name, const string& typeName,
+  int gridHeight, int gridWidth, T& value )
+{
+    auto it = table.find( TuningKey(name,typeName,gridHeight,gridWidth) );
+    if( it == table.end() )
+        it = table.find( TuningKey(name,typeName,0,0) );
+    if( it == table.end() )
+        return false;
+    value = it->second;
+    return true;
+}
+
+// Incremented whenever a tuned value changes so that lookups can be cached
+Int tuningGeneration = 0;
+
+// The local blocksizes default to the tuned entries for the 1 x 1 grid (or
+// 64 if there are none) unless they were explicitly set
+const Int defaultLocalBlocksize = 64;
+
+struct LocalBlocksizeEntry
+{
+    bool set=false;
+    Int value=defaultLocalBlocksize;
+    Int generation=-1;
+};
 
 template<typename T>
-struct LocalSymvBlocksizeHelper { static Int value; };
+struct LocalSymvBlocksizeHelper { static LocalBlocksizeEntry entry; };
 template<typename T>
-Int LocalSymvBlocksizeHelper<T>::value = 64;
+LocalBlocksizeEntry LocalSymvBlocksizeHelper<T>::entry;
 
 template<typename T>
-struct LocalTrrkBlocksizeHelper { static Int value; };
+struct LocalTrrkBlocksizeHelper { static LocalBlocksizeEntry entry; };
 template<typename T>
-Int LocalTrrkBlocksizeHelper<T>::value = 64;
+LocalBlocksizeEntry LocalTrrkBlocksizeHelper<T>::entry;
 
 template<typename T>
-struct LocalTrr2kBlocksizeHelper { static Int value; };
+struct LocalTrr2kBlocksizeHelper { static LocalBlocksizeEntry entry; };
+template<typename T>
+LocalBlocksizeEntry LocalTrr2kBlocksizeHelper<T>::entry;
+
+void SetLocalBlocksize( LocalBlocksizeEntry& entry, Int blocksize )
+{
+    entry.set = true;
+    entry.value = blocksize;
+}
+
+// Since the local kernels recurse on their blocksize, the registry is only
+// consulted again after the tuned values change
 template<typename T>
-Int LocalTrr2kBlocksizeHelper<T>::value = 64;
+Int LocalBlocksize( const string& routine, LocalBlocksizeEntry& entry )
+{
+    if( !entry.set && entry.generation != tuningGeneration )
+    {
+        entry.value = defaultLocalBlocksize;
+        LookupTuned
+        ( tunedBlocksizes, routine, TypeName<T>(), 1, 1, entry.value );
+        entry.generation = tuningGeneration;
+    }
+    return entry.value;
+}
 
 }
 
@@ -50,6 +109,7 @@ void SetBlocksize( Int blocksize )
           LogicError("Attempted to set blocksize at top of empty stack");
     )
     ::blocksizeStack.top() = blocksize;
+    ::setBlocksize = true;
 }
 
 void PushBlocksizeStack( Int blocksize )
@@ -68,31 +128,150 @@ void EmptyBlocksizeStack()
 {
     while( ! ::blocksizeStack.empty() )
         ::blocksizeStack.pop();
+    ::setBlocksize = false;
+}
+
+Int TunedBlocksize
+( const string& routine, const string& typeName,
+  int gridHeight, int gridWidth )
+{
+    Int blocksize = Blocksize();
+    if( ::blocksizeStack.size() == 1 && !::setBlocksize )
+        LookupTuned
+        ( ::tunedBlocksizes, routine, typeName, gridHeight, gridWidth,
+          blocksize );
+    return blocksize;
+}
+
+void SetTunedBlocksize
+( const string& routine, const string& typeName,
+  int gridHeight, int gridWidth, Int blocksize )
+{
+    EL_DEBUG_CSE
+    if( blocksize <= 0 )
+        LogicError("Tuned blocksizes must be positive");
+    ::tunedBlocksizes[TuningKey(routine,typeName,gridHeight,gridWidth)] =
+      blocksize;
+    ++::tuningGeneration;
+}
+
+double TunedParameter
+( const string& name, const string& typeName,
+  int gridHeight, int gridWidth, double defaultValue )
+{
+    double value = defaultValue;
+    LookupTuned
+    ( ::tunedParameters, name, typeName, gridHeight, gridWidth, value );
+    return value;
+}
+
+void SetTunedParameter
+( const string& name, const string& typeName,
+  int gridHeight, int gridWidth, double value )
+{
+    ::tunedParameters[TuningKey(name,typeName,gridHeight,gridWidth)] = value;
+    ++::tuningGeneration;
+}
+
+void ClearTuning()
+{
+    ::tunedBlocksizes.clear();
+    ::tunedParameters.clear();
+    ++::tuningGeneration;
+}
+
+Int TuningGeneration() { return ::tuningGeneration; }
+
+void LoadTuningFile( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    string line;
+    Int lineNumber = 0;
+    while( std::getline( file, line ) )
+    {
+        ++lineNumber;
+        line = line.substr( 0, line.find('#') );
+        std::istringstream lineStream( line );
+        string kind, name, typeName;
+        if( !(lineStream >> kind) )
+            continue;
+        int gridHeight, gridWidth;
+        if( !(lineStream >> name >> typeName >> gridHeight >> gridWidth) )
+            RuntimeError("Malformed line ",lineNumber," of ",filename);
+        if( kind == "blocksize" )
+        {
+            Int blocksize;
+            if( !(lineStream >> blocksize) )
+                RuntimeError("Malformed line ",lineNumber," of ",filename);
+            SetTunedBlocksize
+            ( name, typeName, gridHeight, gridWidth, blocksize );
+        }
+        else if( kind == "parameter" )
+        {
+            double value;
+            if( !(lineStream >> value) )
+                RuntimeError("Malformed line ",lineNumber," of ",filename);
+            SetTunedParameter( name, typeName, gridHeight, gridWidth, value );
+        }
+        else
+            RuntimeError
+            ("Unknown entry kind ",kind," on line ",lineNumber," of ",filename);
+    }
+}
+
+void SaveTuningFile( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    file << "# kind name type gridHeight gridWidth value\n";
+    for( const auto& entry : ::tunedBlocksizes )
+        file << "blocksize "
+             << std::get<0>(entry.first) << " "
+             << std::get<1>(entry.first) << " "
+             << std::get<2>(entry.first) << " "
+             << std::get<3>(entry.first) << " "
+             << entry.second << "\n";
+    file.precision( 17 );
+    for( const auto& entry : ::tunedParameters )
+        file << "parameter "
+             << std::get<0>(entry.first) << " "
+             << std::get<1>(entry.first) << " "
+             << std::get<2>(entry.first) << " "
+             << std::get<3>(entry.first) << " "
+             << entry.second << "\n";
 }
 
 template<typename T>
 void SetLocalSymvBlocksize( Int blocksize )
-{ LocalSymvBlocksizeHelper<T>::value = blocksize; }
+{ SetLocalBlocksize( LocalSymvBlocksizeHelper<T>::entry, blocksize ); }
 
 template<typename T>
 Int LocalSymvBlocksize()
-{ return LocalSymvBlocksizeHelper<T>::value; }
+{ return LocalBlocksize<T>( "LocalSymv", LocalSymvBlocksizeHelper<T>::entry ); }
 
 template<typename T>
 void SetLocalTrrkBlocksize( Int blocksize )
-{ LocalTrrkBlocksizeHelper<T>::value = blocksize; }
+{ SetLocalBlocksize( LocalTrrkBlocksizeHelper<T>::entry, blocksize ); }
 
 template<typename T>
 Int LocalTrrkBlocksize()
-{ return LocalTrrkBlocksizeHelper<T>::value; }
+{ return LocalBlocksize<T>( "LocalTrrk", LocalTrrkBlocksizeHelper<T>::entry ); }
 
 template<typename T>
 void SetLocalTrr2kBlocksize( Int blocksize )
-{ LocalTrr2kBlocksizeHelper<T>::value = blocksize; }
+{ SetLocalBlocksize( LocalTrr2kBlocksizeHelper<T>::entry, blocksize ); }
 
 template<typename T>
 Int LocalTrr2kBlocksize()
-{ return LocalTrr2kBlocksizeHelper<T>::value; }
+{ return LocalBlocksize<T>
+  ( "LocalTrr2k", LocalTrr2kBlocksizeHelper<T>::entry ); }
 
 #define PROTO(T) \
   template void SetLocalSymvBlocksize<T>( Int blocksize ); \
@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Gemm/Tuning.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
@@ -59,6 +60,8 @@ void Gemm
     const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
     if( k != 0 )
     {
+        if( profile::Enabled() )
+            profile::AddFlops( (IsComplex<T>::value ? 8. : 2.)*m*n*k );
         blas::Gemm
         ( transA, transB, m, n, k,
           alpha, A.LockedBuffer(), A.LDim(),
@@ -86,6 +89,26 @@ void Gemm
     Gemm( orientA, orientB, alpha, A, B, T(0), C );
 }
 
+namespace gemm {
+
+template<typename F,typename=EnableIf<IsField<F>>>
+void Ozaki
+( Orientation orientA, Orientation orientB,
+  F alpha, const AbstractDistMatrix<F>& A,
+           const AbstractDistMatrix<F>& B,
+  F beta,        AbstractDistMatrix<F>& C )
+{ OzakiGemm( orientA, orientB, alpha, A, B, beta, C ); }
+
+template<typename T,typename=DisableIf<IsField<T>>,typename=void>
+void Ozaki
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C )
+{ LogicError("GEMM_OZAKI requires a field"); }
+
+} // namespace gemm
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -95,6 +118,11 @@ void Gemm
   GemmAlgorithm alg )
 {
     EL_DEBUG_CSE
+    if( alg == GEMM_OZAKI )
+    {
+        gemm::Ozaki( orientA, orientB, alpha, A, B, beta, C );
+        return;
+    }
     C *= beta;
     if( orientA == NORMAL && orientB == NORMAL )
     {
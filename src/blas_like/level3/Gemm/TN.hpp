@@ -222,11 +222,10 @@ void SUMMA_TN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const SUMMATuning& tuning = TunedSUMMA<T>( C.Grid() );
+    const double weightTowardsC = tuning.weightTowardsC;
+    const double weightAwayFromDot = tuning.weightAwayFromDot;
+    const Int blockSizeDot = tuning.blockSizeDot;
 
     switch( alg )
     {
@@ -0,0 +1,56 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_TUNING_HPP
+#define EL_GEMM_TUNING_HPP
+
+namespace El {
+namespace gemm {
+
+// The crossovers used to select a stationary SUMMA variant
+struct SUMMATuning
+{
+    double weightTowardsC;
+    double weightAwayFromDot;
+    Int blockSizeDot;
+};
+
+// Since every distributed Gemm consults the crossovers, the registry lookups
+// are cached (per thread) until the grid shape or the tuned values change
+template<typename T>
+const SUMMATuning& TunedSUMMA( const Grid& g )
+{
+    struct Cache
+    {
+        Int generation=-1;
+        int gridHeight=0, gridWidth=0;
+        SUMMATuning tuning;
+    };
+    static thread_local Cache cache;
+
+    const Int generation = TuningGeneration();
+    if( cache.generation != generation ||
+        cache.gridHeight != g.Height() || cache.gridWidth != g.Width() )
+    {
+        cache.tuning.weightTowardsC =
+          TunedParameter<T>("GemmWeightTowardsC",g,2.);
+        cache.tuning.weightAwayFromDot =
+          TunedParameter<T>("GemmWeightAwayFromDot",g,10.);
+        cache.tuning.blockSizeDot =
+          TunedParameter<T>("GemmBlocksizeDot",g,2000.);
+        cache.generation = generation;
+        cache.gridHeight = g.Height();
+        cache.gridWidth = g.Width();
+    }
+    return cache.tuning;
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_TUNING_HPP
@@ -14,508 +14,433 @@
 namespace El {
 
 namespace {
-/**
- * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
- */
-template<typename T>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
-  T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   x,
-  T beta,
-        T*   y )
+
+// Local sparse products with fewer nonzeros than this are not threaded
+const Int minThreadedNonzeros = 10000;
+
+// The first row of block t of the partition of the rows of a CSR matrix into
+// 'numBlocks' contiguous blocks with roughly the same number of rows plus
+// nonzeros, so that matrices with irregular row lengths are still balanced
+inline Int RowBlockStart( Int m, const Int* rowOffsets, Int t, Int numBlocks )
+{
+    const Int totalWork = (rowOffsets[m]-rowOffsets[0]) + m;
+    const Int target = (totalWork*t) / numBlocks;
+    Int lo=0, hi=m;
+    while( lo < hi )
+    {
+        const Int mid = lo + (hi-lo)/2;
+        if( (rowOffsets[mid]-rowOffsets[0]) + mid < target )
+            lo = mid+1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// Apply 'kernel(iBeg,iEnd)' over a partition of the rows of a CSR matrix.
+// When threading, each thread receives one of the blocks of RowBlockStart.
+template<typename RowKernel>
+void ForEachRowBlock( Int m, const Int* rowOffsets, const RowKernel& kernel )
 {
     EL_DEBUG_CSE
-    if( orientation == NORMAL )
+#ifdef EL_HYBRID
+    const Int numNonzeros = rowOffsets[m] - rowOffsets[0];
+    if( numNonzeros >= minThreadedNonzeros && omp_get_max_threads() > 1 )
     {
-        for( Int i=0; i<m; ++i )
+        #pragma omp parallel
         {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
+            const Int numThreads = omp_get_num_threads();
+            const Int thread = omp_get_thread_num();
+            kernel
+            ( RowBlockStart( m, rowOffsets, thread, numThreads ),
+              RowBlockStart( m, rowOffsets, thread+1, numThreads ) );
         }
+        return;
     }
-    else
-    {
-        for( Int j=0; j<n; ++j ){
-            y[j] *= beta;
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*x[i];
-            }
-	}
-    }
+#endif
+    kernel( 0, m );
 }
 
-template<typename T,typename=DisableIf<IsBlasScalar<T>>>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
+// Rows [iBeg,iEnd) of Y := alpha A X + beta Y, where entry (j,k) of X lives
+// at X[j*xRowStride+k*xColStride] (and likewise for Y), so that both
+// column-major and interleaved multivectors are supported. The right-hand
+// sides are processed four at a time so that each pass over a row of A
+// updates several columns of Y. If 'unitValues' is true, the values of A are
+// treated as ones (i.e., A is a Graph).
+template<bool unitValues,typename T>
+void NormalRows
+( Int iBeg, Int iEnd, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   x,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   y )
+        T*   Y, Int yRowStride, Int yColStride )
 {
-    EL_DEBUG_CSE
-    if( orientation == NORMAL )
+    Int k=0;
+    for( ; k+4<=numRHS; k+=4 )
     {
-        for( Int i=0; i<m; ++i )
+        const T* X0 = &X[(k  )*xColStride];
+        const T* X1 = &X[(k+1)*xColStride];
+        const T* X2 = &X[(k+2)*xColStride];
+        const T* X3 = &X[(k+3)*xColStride];
+        for( Int i=iBeg; i<iEnd; ++i )
         {
-            T sum = 0;
+            T sum0=0, sum1=0, sum2=0, sum3=0;
             const Int eStart = rowOffsets[i];
             const Int eStop = rowOffsets[i+1];
             for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
             {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];
+                const Int jOff = colIndices[e]*xRowStride;
+                if( unitValues )
+                {
+                    sum0 += X0[jOff];
+                    sum1 += X1[jOff];
+                    sum2 += X2[jOff];
+                    sum3 += X3[jOff];
+                }
+                else
+                {
+                    const T value = values[e];
+                    sum0 += value*X0[jOff];
+                    sum1 += value*X1[jOff];
+                    sum2 += value*X2[jOff];
+                    sum3 += value*X3[jOff];
+                }
             }
+            T* y = &Y[i*yRowStride+k*yColStride];
+            y[0] = alpha*sum0 + beta*y[0];
+            y[yColStride] = alpha*sum1 + beta*y[yColStride];
+            y[2*yColStride] = alpha*sum2 + beta*y[2*yColStride];
+            y[3*yColStride] = alpha*sum3 + beta*y[3*yColStride];
         }
-        else
+    }
+    for( ; k<numRHS; ++k )
+    {
+        const T* x = &X[k*xColStride];
+        for( Int i=iBeg; i<iEnd; ++i )
         {
-            for( Int i=0; i<m; ++i )
+            T sum = 0;
+            const Int eStart = rowOffsets[i];
+            const Int eStop = rowOffsets[i+1];
+            for( Int e=eStart; e<eStop; ++e )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];
+                if( unitValues )
+                    sum += x[colIndices[e]*xRowStride];
+                else
+                    sum += values[e]*x[colIndices[e]*xRowStride];
             }
+            T& y = Y[i*yRowStride+k*yColStride];
+            y = alpha*sum + beta*y;
         }
     }
 }
 
-template<typename T,typename=EnableIf<IsBlasScalar<T>>,typename=void>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
+// Y(jOff+j,:) += alpha A(iBeg:iEnd-1,j)^T X(iBeg:iEnd-1,:) (or with A^H),
+// with the same storage conventions as NormalRows, where 'jOff' allows Y to
+// only hold the range of columns of A referenced by the rows. Each row of A
+// is applied to four right-hand sides at a time.
+template<bool unitValues,typename T>
+void AdjointRowBlock
+( bool conjugate,
+  Int iBeg, Int iEnd, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   x,
-  T beta,
-        T*   y )
+  const T*   X, Int xRowStride, Int xColStride,
+        T*   Y, Int yRowStride, Int yColStride, Int jOff )
 {
-    EL_DEBUG_CSE
-#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
-    char matDescrA[6];
-    matDescrA[0] = 'G';
-    matDescrA[3] = 'C';
-    mkl::csrmv
-    ( orientation, m, n, alpha, matDescrA,
-      values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
-#else
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
+    for( Int i=iBeg; i<iEnd; ++i )
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];
-            }
-        }
-        else
+        const T* x = &X[i*xRowStride];
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        for( Int e=eStart; e<eStop; ++e )
         {
-            for( Int i=0; i<m; ++i )
+            T prod = alpha;
+            if( !unitValues )
+                prod *= ( conjugate ? Conj(values[e]) : values[e] );
+            T* y = &Y[(colIndices[e]-jOff)*yRowStride];
+            Int k=0;
+            for( ; k+4<=numRHS; k+=4 )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];
+                y[(k  )*yColStride] += prod*x[(k  )*xColStride];
+                y[(k+1)*yColStride] += prod*x[(k+1)*xColStride];
+                y[(k+2)*yColStride] += prod*x[(k+2)*xColStride];
+                y[(k+3)*yColStride] += prod*x[(k+3)*xColStride];
             }
+            for( ; k<numRHS; ++k )
+                y[k*yColStride] += prod*x[k*xColStride];
         }
     }
-#endif
 }
 
-template<typename T>
-void MultiplyCSR
-( Orientation orientation,
+// Y := alpha A^T X + beta Y or Y := alpha A^H X + beta Y, with the same
+// storage conventions as NormalRows. Since the rows of A scatter into Y,
+// each thread accumulates the contributions of its block of rows into a
+// private buffer spanning only the columns which they reference, and the
+// buffers are then summed into Y with each thread owning a range of rows
+// of Y.
+template<bool unitValues,typename T>
+void AdjointRows
+( bool conjugate,
   Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X, Int ldX,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   Y, Int ldY )
+        T*   Y, Int yRowStride, Int yColStride )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
+    // Y is left untouched outside of the columns of A when beta is one so
+    // that the distributed multiply can accumulate into a buffer which is
+    // partially in flight
+    if( beta != T(1) )
         for( Int k=0; k<numRHS; ++k )
             for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
+                Y[j*yRowStride+k*yColStride] *= beta;
+#ifdef EL_HYBRID
+    const Int numNonzeros = rowOffsets[m] - rowOffsets[0];
+    const Int maxThreads = omp_get_max_threads();
+    if( numNonzeros >= minThreadedNonzeros && maxThreads > 1 &&
+        !omp_in_parallel() )
+    {
+        vector<vector<T>> accumulators( maxThreads );
+        vector<Int> colBegs( maxThreads, 0 ), colEnds( maxThreads, 0 );
+        #pragma omp parallel
         {
-            for( Int i=0; i<m; ++i )
+            const Int numThreads = omp_get_num_threads();
+            const Int thread = omp_get_thread_num();
+            const Int iBeg = RowBlockStart( m, rowOffsets, thread, numThreads );
+            const Int iEnd =
+              RowBlockStart( m, rowOffsets, thread+1, numThreads );
+
+            // Accumulate over the referenced columns of our rows
+            const Int eBeg = rowOffsets[iBeg];
+            const Int eEnd = rowOffsets[iEnd];
+            if( eBeg < eEnd )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
+                Int colBeg=n, colEnd=0;
+                for( Int e=eBeg; e<eEnd; ++e )
                 {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];
+                    colBeg = Min( colBeg, colIndices[e] );
+                    colEnd = Max( colEnd, colIndices[e]+1 );
                 }
+                auto& accumulator = accumulators[thread];
+                accumulator.assign( (colEnd-colBeg)*numRHS, T(0) );
+                AdjointRowBlock<unitValues>
+                ( conjugate, iBeg, iEnd, numRHS,
+                  alpha, rowOffsets, colIndices, values,
+                  X, xRowStride, xColStride,
+                  accumulator.data(), numRHS, 1, colBeg );
+                colBegs[thread] = colBeg;
+                colEnds[thread] = colEnd;
             }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
+            #pragma omp barrier
+
+            // Sum the accumulators into our range of rows of Y
+            const Int jBeg = (n*thread) / numThreads;
+            const Int jEnd = (n*(thread+1)) / numThreads;
+            for( Int t=0; t<numThreads; ++t )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
+                const Int jFirst = Max( jBeg, colBegs[t] );
+                const Int jLast = Min( jEnd, colEnds[t] );
+                const T* accumulator = accumulators[t].data();
+                for( Int j=jFirst; j<jLast; ++j )
                 {
-                    T prod = alpha*values[e];
+                    const T* a = &accumulator[(j-colBegs[t])*numRHS];
+                    T* y = &Y[j*yRowStride];
                     for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];
+                        y[k*yColStride] += a[k];
                 }
             }
         }
+        return;
     }
+#endif
+    AdjointRowBlock<unitValues>
+    ( conjugate, 0, m, numRHS,
+      alpha, rowOffsets, colIndices, values,
+      X, xRowStride, xColStride,
+      Y, yRowStride, yColStride, 0 );
 }
 
-template<typename T>
-void MultiplyCSR
+template<bool unitValues,typename T>
+void MultiplyCSRStrided
 ( Orientation orientation,
   Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const T*   X, Int ldX,
+  const T*   values,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   Y, Int ldY )
+        T*   Y, Int yRowStride, Int yColStride )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, X, beta, Y );
-        return;
-    }
-
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
+        ForEachRowBlock
+        ( m, rowOffsets,
+          [&]( Int iBeg, Int iEnd )
+          {
+              NormalRows<unitValues>
+              ( iBeg, iEnd, numRHS,
+                alpha, rowOffsets, colIndices, values,
+                       X, xRowStride, xColStride,
+                beta,  Y, yRowStride, yColStride );
+          } );
     }
     else
     {
-        for( Int k=0; k<numRHS; ++k )
-	{
-            for( Int j=0; j<n; ++j )
-	    {
-                Y[j+k*ldY] *= beta;
-            	for( Int i=0; i<m; ++i )
-            	{
-            	    const Int eStart = rowOffsets[i];
-            	    const Int eStop = rowOffsets[i+1];
-            	    for( Int e=eStart; e<eStop; ++e )
-            	        for( Int k=0; k<numRHS; ++k )
-            	            Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX];
-            	}
-            }
-        }
+        AdjointRows<unitValues>
+        ( orientation == ADJOINT, m, n, numRHS,
+          alpha, rowOffsets, colIndices, values,
+                 X, xRowStride, xColStride,
+          beta,  Y, yRowStride, yColStride );
     }
 }
 
+// Returns true if the product was handled by a vendor sparse BLAS
+template<typename T,typename=DisableIf<IsBlasScalar<T>>>
+bool VendorMultiplyCSR
+( Orientation orientation,
+  Int m, Int n,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   x,
+  T beta,
+        T*   y )
+{ return false; }
+
+template<typename T,typename=EnableIf<IsBlasScalar<T>>,typename=void>
+bool VendorMultiplyCSR
+( Orientation orientation,
+  Int m, Int n,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   values,
+  const T*   x,
+  T beta,
+        T*   y )
+{
+    EL_DEBUG_CSE
+#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
+    char matDescrA[6];
+    matDescrA[0] = 'G';
+    matDescrA[3] = 'C';
+    mkl::csrmv
+    ( orientation, m, n, alpha, matDescrA,
+      values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
+    return true;
+#else
+    return false;
+#endif
+}
+
 template<typename T>
-void MultiplyCSRInterX
+void MultiplyCSR
 ( Orientation orientation,
   Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X,
+  const T*   X, Int ldX,
   T beta,
         T*   Y, Int ldY )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
+    if( numRHS == 1 &&
+        VendorMultiplyCSR
         ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
+          rowOffsets, colIndices, values, X, beta, Y ) )
         return;
-    }
+    MultiplyCSRStrided<false>
+    ( orientation, m, n, numRHS,
+      alpha, rowOffsets, colIndices, values,
+             X, 1, ldX,
+      beta,  Y, 1, ldY );
+}
 
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-    }
+// MultiplyCSR specialization where the CSR matrix happens to have all
+// nonzeros equal to one
+template<typename T>
+void MultiplyCSR
+( Orientation orientation,
+  Int m, Int n, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const T*   X, Int ldX,
+  T beta,
+        T*   Y, Int ldY )
+{
+    EL_DEBUG_CSE
+    MultiplyCSRStrided<true>
+    ( orientation, m, n, numRHS,
+      alpha, rowOffsets, colIndices, static_cast<const T*>(nullptr),
+             X, 1, ldX,
+      beta,  Y, 1, ldY );
 }
 
+// X is stored with the right-hand sides interleaved
 template<typename T>
-void MultiplyCSRInterY
+void MultiplyCSRInterX
 ( Orientation orientation,
   Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X, Int ldX,
+  const T*   X,
   T beta,
-        T*   Y )
+        T*   Y, Int ldY )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
+    if( numRHS == 1 &&
+        VendorMultiplyCSR
         ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
+          rowOffsets, colIndices, values, X, beta, Y ) )
         return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];
-                }
-            }
-        }
-    }
+    MultiplyCSRStrided<false>
+    ( orientation, m, n, numRHS,
+      alpha, rowOffsets, colIndices, values,
+             X, numRHS, 1,
+      beta,  Y, 1, ldY );
 }
 
+// Y is stored with the right-hand sides interleaved
 template<typename T>
-void MultiplyCSRInter
+void MultiplyCSRInterY
 ( Orientation orientation,
   Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X,
+  const T*   X, Int ldX,
   T beta,
         T*   Y )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
+    if( numRHS == 1 &&
+        VendorMultiplyCSR
         ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
+          rowOffsets, colIndices, values, X, beta, Y ) )
         return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-    }
+    MultiplyCSRStrided<false>
+    ( orientation, m, n, numRHS,
+      alpha, rowOffsets, colIndices, values,
+             X, 1, ldX,
+      beta,  Y, numRHS, 1 );
 }
 
 } // anonymous namespace
@@ -581,9 +506,9 @@ void Multiply
     const bool time = false;
 
     const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
     const int commSize = grid.Size();
     const int commRank = grid.Rank();
-    // TODO(poulson): Use sequential implementation if commSize = 1?
 
     Timer totalTimer, timer;
     if( time && commRank == 0 )
@@ -594,19 +519,20 @@ void Multiply
 
     A.InitializeMultMeta();
     const auto& meta = A.LockedDistGraph().multMeta;
-    // Convert the sizes and offsets to be compatible with the current width
     const Int b = X.Width();
-    vector<int> recvSizes=meta.recvSizes,
-                recvOffs=meta.recvOffs,
-                sendSizes=meta.sendSizes,
-                sendOffs=meta.sendOffs;
-    for( int q=0; q<commSize; ++q )
-    {
-        recvSizes[q] *= b;
-        recvOffs[q] *= b;
-        sendSizes[q] *= b;
-        sendOffs[q] *= b;
-    }
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* colOffBuf = meta.colOffs.data();
+    const T* valueBuf = A.LockedValueBuffer();
+
+    // Our own portion of the exchange is copied directly, and messages are
+    // only exchanged with the processes that we share entries with
+    const Int selfSendOff = meta.sendOffs[commRank];
+    const Int selfRecvOff = meta.recvOffs[commRank];
+    const Int numSelfInds = meta.recvSizes[commRank];
+    EL_DEBUG_ONLY(
+      if( meta.sendSizes[commRank] != numSelfInds )
+          LogicError("Inconsistent local portion of the multiply metadata");
+    )
 
     if( orientation == NORMAL )
     {
@@ -630,24 +556,69 @@ void Multiply
                 sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
         }
 
-        // Now send them
-        vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), grid.Comm() );
+        // Start exchanging the boundary values
+        vector<T> recvVals;
+        FastResize( recvVals, meta.numRecvInds*b );
+        vector<mpi::Request<T>> requests;
+        requests.reserve( 2*(commSize-1) );
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == commRank || meta.recvSizes[q] == 0 )
+                continue;
+            requests.emplace_back();
+            mpi::IRecv
+            ( &recvVals[meta.recvOffs[q]*b], meta.recvSizes[q]*b, q, comm,
+              requests.back() );
+        }
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == commRank || meta.sendSizes[q] == 0 )
+                continue;
+            requests.emplace_back();
+            mpi::ISend
+            ( &sendVals[meta.sendOffs[q]*b], meta.sendSizes[q]*b, q, comm,
+              requests.back() );
+        }
+        std::copy
+        ( &sendVals[selfSendOff*b], &sendVals[(selfSendOff+numSelfInds)*b],
+          &recvVals[selfRecvOff*b] );
+
+        // While the messages are in flight, perform the local
+        // multiply-accumulate, y := alpha A x + y, over the interior rows,
+        // which only depend upon our own portion of x
+        if( time && commRank == 0 )
+            timer.Start();
+        T* YBuffer = Y.Matrix().Buffer();
+        const Int ldY = Y.Matrix().LDim();
+        auto multiplyRuns = [&]( const vector<Int>& runs )
+        {
+            const Int numRuns = runs.size() / 2;
+            for( Int r=0; r<numRuns; ++r )
+            {
+                const Int iBeg = runs[2*r];
+                const Int iEnd = runs[2*r+1];
+                MultiplyCSRInterX
+                ( NORMAL, iEnd-iBeg, meta.numRecvInds, b,
+                  alpha, &offsetBuf[iBeg], colOffBuf, valueBuf,
+                         recvVals.data(),
+                  T(1),  &YBuffer[iBeg], ldY );
+            }
+        };
+        multiplyRuns( meta.interiorRuns );
+        if( time && commRank == 0 )
+            Output("  Interior MultiplyCSRInterX time: ",timer.Stop());
 
-        // Perform the local multiply-accumulate, y := alpha A x + y
+        // Finish the exchange and then the boundary rows
+        if( time && commRank == 0 )
+            timer.Start();
+        mpi::WaitAll( requests.size(), requests.data() );
+        if( time && commRank == 0 )
+            Output("  Exchange wait time: ",timer.Stop());
         if( time && commRank == 0 )
             timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 recvVals.data(),
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
+        multiplyRuns( meta.boundaryRuns );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+            Output("  Boundary MultiplyCSRInterX time: ",timer.Stop());
     }
     else
     {
@@ -656,29 +627,74 @@ void Multiply
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
 
-        // Form and pack the updates to Y
+        const T* XBuffer = X.LockedMatrix().LockedBuffer();
+        const Int ldX = X.LockedMatrix().LDim();
+        vector<T> sendVals( meta.numRecvInds*b, 0 );
+        auto multiplyRuns = [&]( const vector<Int>& runs )
+        {
+            const Int numRuns = runs.size() / 2;
+            for( Int r=0; r<numRuns; ++r )
+            {
+                const Int iBeg = runs[2*r];
+                const Int iEnd = runs[2*r+1];
+                MultiplyCSRInterY
+                ( orientation, iEnd-iBeg, meta.numRecvInds, b,
+                  alpha, &offsetBuf[iBeg], colOffBuf, valueBuf,
+                         &XBuffer[iBeg], ldX,
+                  T(1),  sendVals.data() );
+            }
+        };
+
+        // Form the updates from the boundary rows, which are the only rows
+        // that update entries of Y owned by other processes
         if( time && commRank == 0 )
             timer.Start();
-        vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
-        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
+        multiplyRuns( meta.boundaryRuns );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
+            Output("  Boundary MultiplyCSRInterY time: ",timer.Stop());
 
-        // Inject the updates to Y into the network
+        // Start injecting the updates to Y into the network
         const Int numRecvInds = meta.sendInds.size();
         vector<T> recvVals;
         FastResize( recvVals, numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), grid.Comm() );
+        vector<mpi::Request<T>> requests;
+        requests.reserve( 2*(commSize-1) );
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == commRank || meta.sendSizes[q] == 0 )
+                continue;
+            requests.emplace_back();
+            mpi::IRecv
+            ( &recvVals[meta.sendOffs[q]*b], meta.sendSizes[q]*b, q, comm,
+              requests.back() );
+        }
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == commRank || meta.recvSizes[q] == 0 )
+                continue;
+            requests.emplace_back();
+            mpi::ISend
+            ( &sendVals[meta.recvOffs[q]*b], meta.recvSizes[q]*b, q, comm,
+              requests.back() );
+        }
+
+        // While the messages are in flight, form the updates from the
+        // interior rows (which only update our own entries of Y)
+        if( time && commRank == 0 )
+            timer.Start();
+        multiplyRuns( meta.interiorRuns );
+        if( time && commRank == 0 )
+            Output("  Interior MultiplyCSRInterY time: ",timer.Stop());
+        std::copy
+        ( &sendVals[selfRecvOff*b], &sendVals[(selfRecvOff+numSelfInds)*b],
+          &recvVals[selfSendOff*b] );
 
         // Accumulate the received indices onto Y
+        if( time && commRank == 0 )
+            timer.Start();
+        mpi::WaitAll( requests.size(), requests.data() );
+        if( time && commRank == 0 )
+            Output("  Exchange wait time: ",timer.Stop());
         const Int firstLocalRow = Y.FirstLocalRow();
         T* YBuffer = Y.Matrix().Buffer();
         const Int ldY = Y.Matrix().LDim();
@@ -0,0 +1,427 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace ozaki {
+
+// The local entry (iLoc,jLoc) corresponds to the global entry
+// (colShift+iLoc*colStride,rowShift+jLoc*rowStride)
+struct IndexMap
+{
+    Int colShift=0, colStride=1, rowShift=0, rowStride=1;
+
+    IndexMap() { }
+
+    template<typename T>
+    IndexMap( const DistMatrix<T>& A )
+    : colShift(A.ColShift()), colStride(A.ColStride()),
+      rowShift(A.RowShift()), rowStride(A.RowStride())
+    { }
+
+    Int Row( Int iLoc ) const { return colShift + iLoc*colStride; }
+    Int Col( Int jLoc ) const { return rowShift + jLoc*rowStride; }
+};
+
+// The number of bits per slice, which is chosen so that inner products of
+// length k between integer-valued slices are exact in double precision
+inline Int SliceBits( Int k )
+{
+    Int logK = 0;
+    while( (Int(1)<<logK) < k )
+        ++logK;
+    return Max( (std::numeric_limits<double>::digits-logK)/2, Int(1) );
+}
+
+// Enough slices so that the discarded products, and the remainders of the
+// operands beyond the last slice, are below the working precision
+template<typename Real>
+Int NumSlices( Int k, Int sliceBits, const OzakiGemmCtrl& ctrl )
+{
+    if( ctrl.numSlices > 0 )
+        return ctrl.numSlices;
+    Int logK = 0;
+    while( (Int(1)<<logK) < k )
+        ++logK;
+    const Int bits = NumMantissaBits<Real>() + logK + 3;
+    return (bits+sliceBits-1) / sliceBits;
+}
+
+// Update the running maximum magnitude of each row (if 'byRow') or column of
+// the local matrix A (indexed globally)
+template<typename Real>
+void MaxAbs
+( const Matrix<Real>& A, const IndexMap& map, bool byRow,
+  vector<double>& maxAbs )
+{
+    EL_DEBUG_CSE
+    const Int mLoc = A.Height();
+    const Int nLoc = A.Width();
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+    {
+        const Int j = map.Col(jLoc);
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        {
+            const Int index = ( byRow ? map.Row(iLoc) : j );
+            maxAbs[index] =
+              Max( maxAbs[index], double(Abs(A.CRef(iLoc,jLoc))) );
+        }
+    }
+}
+
+// The exponents e such that each magnitude is below 2^e
+inline void Exponents( const vector<double>& maxAbs, vector<Int>& exps )
+{
+    const Int n = maxAbs.size();
+    exps.resize( n );
+    for( Int i=0; i<n; ++i )
+        exps[i] = ( maxAbs[i] == 0 ? 0 : std::ilogb(maxAbs[i])+1 );
+}
+
+// Peel the next slice off of the remainder R, where entry (i,j) of the slice
+// is the integer nearest R(i,j) 2^(shift-e), with e equal to exps[i] if
+// 'byRow' and exps[j] otherwise. The slice is subtracted from R.
+template<typename Real>
+void NextSlice
+( Matrix<Real>& R, const IndexMap& map, const vector<Int>& exps, bool byRow,
+  Int shift, Matrix<double>& slice )
+{
+    EL_DEBUG_CSE
+    const Int mLoc = R.Height();
+    const Int nLoc = R.Width();
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+    {
+        const Int j = map.Col(jLoc);
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        {
+            const Int e = ( byRow ? exps[map.Row(iLoc)] : exps[j] );
+            const Real scale = Real(std::ldexp(1.,shift-e));
+            const Real unit = Real(std::ldexp(1.,e-shift));
+            Real& rho = R.Ref(iLoc,jLoc);
+            const Real q = Round( rho*scale );
+            slice(iLoc,jLoc) = double(q);
+            rho -= q*unit;
+        }
+    }
+}
+
+// P += 2^(rowExps[i]+colExps[j]-shift) Prod
+template<typename Real>
+void Accumulate
+( const Matrix<double>& Prod, const IndexMap& map,
+  const vector<Int>& rowExps, const vector<Int>& colExps, Int shift,
+  Matrix<Real>& P )
+{
+    EL_DEBUG_CSE
+    const Int mLoc = P.Height();
+    const Int nLoc = P.Width();
+    vector<double> rowUnits( mLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        rowUnits[iLoc] = std::ldexp( 1., rowExps[map.Row(iLoc)]-shift );
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+    {
+        const Real colUnit = Real(std::ldexp(1.,colExps[map.Col(jLoc)]));
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            P(iLoc,jLoc) +=
+              Real(Prod.CRef(iLoc,jLoc)*rowUnits[iLoc])*colUnit;
+    }
+}
+
+// P := op(A) op(B) for real A and B
+template<typename Real>
+void Product
+( Orientation orientA, Orientation orientB,
+  const Matrix<Real>& A, const Matrix<Real>& B, Matrix<Real>& P,
+  const OzakiGemmCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int m = ( normalA ? A.Height() : A.Width() );
+    const Int n = ( normalB ? B.Width() : B.Height() );
+    const Int k = ( normalA ? A.Width() : A.Height() );
+    P.Resize( m, n );
+    Zero( P );
+    if( m == 0 || n == 0 || k == 0 )
+        return;
+    const Int sliceBits = SliceBits( k );
+    const Int numSlices = NumSlices<Real>( k, sliceBits, ctrl );
+
+    const IndexMap map;
+    vector<double> maxAbs( m, 0. );
+    vector<Int> rowExps, colExps;
+    MaxAbs( A, map, normalA, maxAbs );
+    Exponents( maxAbs, rowExps );
+    maxAbs.assign( n, 0. );
+    MaxAbs( B, map, !normalB, maxAbs );
+    Exponents( maxAbs, colExps );
+
+    vector<Matrix<double>> ASlices(numSlices), BSlices(numSlices);
+    Matrix<Real> R( A );
+    for( Int s=0; s<numSlices; ++s )
+    {
+        ASlices[s].Resize( A.Height(), A.Width() );
+        NextSlice( R, map, rowExps, normalA, (s+1)*sliceBits, ASlices[s] );
+    }
+    R = B;
+    for( Int t=0; t<numSlices; ++t )
+    {
+        BSlices[t].Resize( B.Height(), B.Width() );
+        NextSlice( R, map, colExps, !normalB, (t+1)*sliceBits, BSlices[t] );
+    }
+
+    // Each product of slices is exact, so only the summation (which proceeds
+    // from the least significant products) is subject to rounding
+    Matrix<double> Prod( m, n );
+    for( Int d=numSlices-1; d>=0; --d )
+        for( Int s=0; s<=d; ++s )
+        {
+            Gemm( orientA, orientB, 1., ASlices[s], BSlices[d-s], 0., Prod );
+            Accumulate( Prod, map, rowExps, colExps, (d+2)*sliceBits, P );
+        }
+}
+
+template<typename Real>
+void Product
+( Orientation orientA, Orientation orientB,
+  const DistMatrix<Real>& A, const DistMatrix<Real>& B, DistMatrix<Real>& P,
+  const OzakiGemmCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int m = ( normalA ? A.Height() : A.Width() );
+    const Int n = ( normalB ? B.Width() : B.Height() );
+    const Int k = ( normalA ? A.Width() : A.Height() );
+    P.Resize( m, n );
+    Zero( P );
+    if( m == 0 || n == 0 || k == 0 )
+        return;
+    const Int sliceBits = SliceBits( k );
+    const Int numSlices = NumSlices<Real>( k, sliceBits, ctrl );
+
+    // The scalings of the rows of op(A) and the columns of op(B) must agree
+    // across the grid, so the maximum magnitudes are reduced over all of it
+    const IndexMap AMap( A ), BMap( B ), PMap( P );
+    vector<double> maxAbs( m, 0. );
+    vector<Int> rowExps, colExps;
+    MaxAbs( A.LockedMatrix(), AMap, normalA, maxAbs );
+    mpi::AllReduce( maxAbs.data(), m, mpi::MAX, g.Comm() );
+    Exponents( maxAbs, rowExps );
+    maxAbs.assign( n, 0. );
+    MaxAbs( B.LockedMatrix(), BMap, !normalB, maxAbs );
+    mpi::AllReduce( maxAbs.data(), n, mpi::MAX, g.Comm() );
+    Exponents( maxAbs, colExps );
+
+    vector<DistMatrix<double>> ASlices, BSlices;
+    ASlices.reserve( numSlices );
+    BSlices.reserve( numSlices );
+    Matrix<Real> R( A.LockedMatrix() );
+    for( Int s=0; s<numSlices; ++s )
+    {
+        ASlices.emplace_back( g );
+        ASlices[s].AlignWith( A );
+        ASlices[s].Resize( A.Height(), A.Width() );
+        NextSlice
+        ( R, AMap, rowExps, normalA, (s+1)*sliceBits, ASlices[s].Matrix() );
+    }
+    R = B.LockedMatrix();
+    for( Int t=0; t<numSlices; ++t )
+    {
+        BSlices.emplace_back( g );
+        BSlices[t].AlignWith( B );
+        BSlices[t].Resize( B.Height(), B.Width() );
+        NextSlice
+        ( R, BMap, colExps, !normalB, (t+1)*sliceBits, BSlices[t].Matrix() );
+    }
+
+    DistMatrix<double> Prod( g );
+    Prod.AlignWith( P );
+    Prod.Resize( m, n );
+    for( Int d=numSlices-1; d>=0; --d )
+        for( Int s=0; s<=d; ++s )
+        {
+            Gemm( orientA, orientB, 1., ASlices[s], BSlices[d-s], 0., Prod );
+            Accumulate
+            ( Prod.LockedMatrix(), PMap, rowExps, colExps, (d+2)*sliceBits,
+              P.Matrix() );
+        }
+}
+
+// Helpers for writing the driver once for both Matrix and DistMatrix
+template<class Mat,typename S> struct Rebind;
+template<typename T,typename S> struct Rebind<Matrix<T>,S>
+{ typedef Matrix<S> type; };
+template<typename T,typename S> struct Rebind<DistMatrix<T>,S>
+{ typedef DistMatrix<S> type; };
+
+template<typename T,typename S>
+void MakeLike( const Matrix<T>& C, Matrix<S>& P ) { }
+template<typename T,typename S>
+void MakeLike( const DistMatrix<T>& C, DistMatrix<S>& P )
+{
+    P.SetGrid( C.Grid() );
+    P.AlignWith( C );
+}
+
+template<typename T>
+Matrix<T>& Local( Matrix<T>& A ) { return A; }
+template<typename T>
+Matrix<T>& Local( DistMatrix<T>& A ) { return A.Matrix(); }
+template<typename T>
+const Matrix<T>& Local( const Matrix<T>& A ) { return A; }
+template<typename T>
+const Matrix<T>& Local( const DistMatrix<T>& A ) { return A.LockedMatrix(); }
+
+// Real(A) and the (possibly conjugated) Imag(A)
+template<typename Real,class ComplexMat,class RealMat>
+void Split
+( const ComplexMat& A, bool conjugate, RealMat& AReal, RealMat& AImag )
+{
+    EL_DEBUG_CSE
+    MakeLike( A, AReal );
+    MakeLike( A, AImag );
+    AReal.Resize( A.Height(), A.Width() );
+    AImag.Resize( A.Height(), A.Width() );
+    const auto& ALoc = Local( A );
+    auto& ARealLoc = Local( AReal );
+    auto& AImagLoc = Local( AImag );
+    for( Int jLoc=0; jLoc<ALoc.Width(); ++jLoc )
+        for( Int iLoc=0; iLoc<ALoc.Height(); ++iLoc )
+        {
+            const Complex<Real>& alpha = ALoc.CRef(iLoc,jLoc);
+            ARealLoc(iLoc,jLoc) = RealPart(alpha);
+            AImagLoc(iLoc,jLoc) =
+              ( conjugate ? -ImagPart(alpha) : ImagPart(alpha) );
+        }
+}
+
+// C := alpha op(A) op(B) + beta C, where op(A) op(B) is formed from real
+// Ozaki products
+template<typename Real,class Mat>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  Real alpha, const Mat& A, const Mat& B, Real beta, Mat& C,
+  const OzakiGemmCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Mat P;
+    MakeLike( C, P );
+    Product( orientA, orientB, A, B, P, ctrl );
+    C *= beta;
+    Axpy( alpha, P, C );
+}
+
+template<typename Real,class Mat>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  Complex<Real> alpha, const Mat& A, const Mat& B,
+  Complex<Real> beta,        Mat& C,
+  const OzakiGemmCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef typename Rebind<Mat,Real>::type RealMat;
+    const Orientation realOrientA = ( orientA==NORMAL ? NORMAL : TRANSPOSE );
+    const Orientation realOrientB = ( orientB==NORMAL ? NORMAL : TRANSPOSE );
+
+    // With op(A) = AR + i AI and op(B) = BR + i BI,
+    // op(A) op(B) = (AR BR - AI BI) + i (AR BI + AI BR)
+    RealMat AReal, AImag, BReal, BImag;
+    Split<Real>( A, orientA==ADJOINT, AReal, AImag );
+    Split<Real>( B, orientB==ADJOINT, BReal, BImag );
+    RealMat PReal, PImag, Q;
+    MakeLike( C, PReal );
+    MakeLike( C, PImag );
+    MakeLike( C, Q );
+    Product( realOrientA, realOrientB, AReal, BReal, PReal, ctrl );
+    Product( realOrientA, realOrientB, AImag, BImag, Q, ctrl );
+    Axpy( Real(-1), Q, PReal );
+    Product( realOrientA, realOrientB, AReal, BImag, PImag, ctrl );
+    Product( realOrientA, realOrientB, AImag, BReal, Q, ctrl );
+    Axpy( Real(1), Q, PImag );
+
+    C *= beta;
+    auto& CLoc = Local( C );
+    const auto& PRealLoc = Local( PReal );
+    const auto& PImagLoc = Local( PImag );
+    for( Int jLoc=0; jLoc<CLoc.Width(); ++jLoc )
+        for( Int iLoc=0; iLoc<CLoc.Height(); ++iLoc )
+            CLoc(iLoc,jLoc) +=
+              alpha*Complex<Real>
+              (PRealLoc.CRef(iLoc,jLoc),PImagLoc.CRef(iLoc,jLoc));
+}
+
+} // namespace ozaki
+
+template<typename F>
+void OzakiGemm
+( Orientation orientA, Orientation orientB,
+  F alpha, const Matrix<F>& A, const Matrix<F>& B, F beta, Matrix<F>& C,
+  const OzakiGemmCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      const Int m = ( orientA==NORMAL ? A.Height() : A.Width() );
+      const Int n = ( orientB==NORMAL ? B.Width() : B.Height() );
+      const Int kA = ( orientA==NORMAL ? A.Width() : A.Height() );
+      const Int kB = ( orientB==NORMAL ? B.Height() : B.Width() );
+      if( m != C.Height() || n != C.Width() || kA != kB )
+          LogicError("Nonconformal OzakiGemm");
+    )
+    ozaki::Gemm( orientA, orientB, alpha, A, B, beta, C, ctrl );
+}
+
+template<typename F>
+void OzakiGemm
+( Orientation orientA, Orientation orientB,
+  F alpha, const AbstractDistMatrix<F>& APre, const AbstractDistMatrix<F>& BPre,
+  F beta,        AbstractDistMatrix<F>& CPre,
+  const OzakiGemmCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, BPre, CPre );
+      const Int m = ( orientA==NORMAL ? APre.Height() : APre.Width() );
+      const Int n = ( orientB==NORMAL ? BPre.Width() : BPre.Height() );
+      const Int kA = ( orientA==NORMAL ? APre.Width() : APre.Height() );
+      const Int kB = ( orientB==NORMAL ? BPre.Height() : BPre.Width() );
+      if( m != CPre.Height() || n != CPre.Width() || kA != kB )
+          LogicError("Nonconformal OzakiGemm");
+    )
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+    ozaki::Gemm( orientA, orientB, alpha, A, B, beta, C, ctrl );
+}
+
+#define PROTO(F) \
+  template void OzakiGemm \
+  ( Orientation orientA, Orientation orientB, \
+    F alpha, const Matrix<F>& A, const Matrix<F>& B, F beta, Matrix<F>& C, \
+    const OzakiGemmCtrl& ctrl ); \
+  template void OzakiGemm \
+  ( Orientation orientA, Orientation orientB, \
+    F alpha, const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& B, \
+    F beta,        AbstractDistMatrix<F>& C, \
+    const OzakiGemmCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
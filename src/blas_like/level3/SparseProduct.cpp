@@ -0,0 +1,748 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// Local products with fewer entries in (the local rows of) A than this are
+// not threaded
+const Int minThreadedEntries = 10000;
+
+// Apply 'kernel(iLoc,workspace)' to each of the local rows, where 'workspace'
+// is a dense array of length 'width' (initialized to 'initial') which is
+// private to the calling thread. The kernel must restore the entries of the
+// workspace which it modifies (or tag them with iLoc).
+template<typename W,class RowKernel>
+void ForEachRow
+( Int localHeight, Int width, const W& initial, Int numEntries,
+  const RowKernel& kernel )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    if( numEntries >= minThreadedEntries && omp_get_max_threads() > 1 )
+    {
+        #pragma omp parallel
+        {
+            vector<W> workspace( width, initial );
+            #pragma omp for schedule(dynamic,16)
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                kernel( iLoc, workspace );
+        }
+        return;
+    }
+#endif
+    vector<W> workspace( width, initial );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        kernel( iLoc, workspace );
+}
+
+// Form the (sorted) pattern of each of the local rows of the width-'width'
+// matrix C := A B, where the e'th entry of the local rows of A multiplies row
+// rowsB[e] of (the given rows of) B. If 'triangular' is true, only the 'uplo'
+// triangle of C is kept, and, if 'includeDiagonal' is true, the diagonal is
+// always kept. Each row is formed with a dense marker, where marker[j] == iLoc
+// if column j was already found in local row iLoc, by first counting the
+// entries of every row and then filling them in.
+void SymbolicProduct
+( Int localHeight, Int firstLocalRow, Int width,
+  const Int* offsetsA, const Int* rowsB,
+  const Int* offsetsB, const Int* targetsB,
+  bool triangular, UpperOrLower uplo, bool includeDiagonal,
+  vector<Int>& offsetsC, vector<Int>& targetsC )
+{
+    EL_DEBUG_CSE
+    // Returns the number of entries of local row iLoc of C and, if
+    // 'rowTargets' is non-null, stores their (unsorted) column indices
+    auto rowPattern =
+      [&]( Int iLoc, vector<Int>& marker, Int* rowTargets )
+      {
+          const Int i = firstLocalRow + iLoc;
+          Int numTargets = 0;
+          auto visit =
+            [&]( Int j )
+            {
+                if( marker[j] != iLoc )
+                {
+                    marker[j] = iLoc;
+                    if( rowTargets != nullptr )
+                        rowTargets[numTargets] = j;
+                    ++numTargets;
+                }
+            };
+          if( includeDiagonal )
+              visit( i );
+          for( Int e=offsetsA[iLoc]; e<offsetsA[iLoc+1]; ++e )
+          {
+              const Int k = rowsB[e];
+              for( Int f=offsetsB[k]; f<offsetsB[k+1]; ++f )
+              {
+                  const Int j = targetsB[f];
+                  if( !triangular || (uplo==LOWER ? j<=i : j>=i) )
+                      visit( j );
+              }
+          }
+          return numTargets;
+      };
+
+    const Int numEntriesA = offsetsA[localHeight] - offsetsA[0];
+    offsetsC.assign( localHeight+1, 0 );
+    ForEachRow
+    ( localHeight, width, Int(-1), numEntriesA,
+      [&]( Int iLoc, vector<Int>& marker )
+      { offsetsC[iLoc+1] = rowPattern( iLoc, marker, nullptr ); } );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        offsetsC[iLoc+1] += offsetsC[iLoc];
+
+    targetsC.resize( offsetsC[localHeight] );
+    ForEachRow
+    ( localHeight, width, Int(-1), numEntriesA,
+      [&]( Int iLoc, vector<Int>& marker )
+      {
+          Int* rowTargets = &targetsC[offsetsC[iLoc]];
+          const Int numTargets = rowPattern( iLoc, marker, rowTargets );
+          std::sort( rowTargets, rowTargets+numTargets );
+      } );
+}
+
+// Overwrite the values of the local rows of the width-'width' matrix C with
+// those of alpha A B, where the pattern of C was formed by SymbolicProduct.
+// The partial products of each row are summed into a dense accumulator, which
+// is then gathered into (and reset over) the pattern of the row.
+template<typename T>
+void NumericProduct
+( Int localHeight, Int firstLocalRow, Int width, T alpha,
+  const Int* offsetsA, const Int* rowsB, const T* valuesA,
+  const Int* offsetsB, const Int* targetsB, const T* valuesB,
+  bool triangular, UpperOrLower uplo,
+  const Int* offsetsC, const Int* targetsC, T* valuesC )
+{
+    EL_DEBUG_CSE
+    const Int numEntriesA = offsetsA[localHeight] - offsetsA[0];
+    ForEachRow
+    ( localHeight, width, T(0), numEntriesA,
+      [&]( Int iLoc, vector<T>& accumulator )
+      {
+          const Int i = firstLocalRow + iLoc;
+          for( Int e=offsetsA[iLoc]; e<offsetsA[iLoc+1]; ++e )
+          {
+              const Int k = rowsB[e];
+              const T alphaA = alpha*valuesA[e];
+              for( Int f=offsetsB[k]; f<offsetsB[k+1]; ++f )
+              {
+                  const Int j = targetsB[f];
+                  if( triangular && (uplo==LOWER ? j>i : j<i) )
+                      continue;
+                  accumulator[j] += alphaA*valuesB[f];
+              }
+          }
+          for( Int c=offsetsC[iLoc]; c<offsetsC[iLoc+1]; ++c )
+          {
+              const Int j = targetsC[c];
+              valuesC[c] = accumulator[j];
+              accumulator[j] = T(0);
+          }
+      } );
+}
+
+// A (64-bit FNV-1a) hash of the row lengths and column indices of the given
+// rows, which is used to detect changes to the sparsity patterns between the
+// symbolic and numeric phases
+std::uint64_t PatternHash
+( Int numRows, const Int* offsets, const Int* targets )
+{
+    EL_DEBUG_CSE
+    std::uint64_t hash = 14695981039346656037ULL;
+    auto mix =
+      [&]( Int value )
+      {
+          hash ^= std::uint64_t(value);
+          hash *= 1099511628211ULL;
+      };
+    mix( numRows );
+    for( Int i=0; i<numRows; ++i )
+    {
+        mix( offsets[i+1]-offsets[i] );
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+            mix( targets[e] );
+    }
+    return hash;
+}
+
+template<typename T>
+std::uint64_t PatternHash( const SparseMatrix<T>& A )
+{
+    return PatternHash
+      ( A.Height(), A.LockedOffsetBuffer(), A.LockedTargetBuffer() );
+}
+
+template<typename T>
+std::uint64_t PatternHash( const DistSparseMatrix<T>& A )
+{
+    return PatternHash
+      ( A.LocalHeight(), A.LockedOffsetBuffer(), A.LockedTargetBuffer() );
+}
+
+template<typename T>
+void SetPattern
+( Int height, Int width,
+  const vector<Int>& offsets, const vector<Int>& targets,
+  SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    Zeros( C, height, width );
+    C.Reserve( targets.size() );
+    for( Int i=0; i<height; ++i )
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+            C.QueueUpdate( i, targets[e], T(0) );
+    C.ProcessQueues();
+}
+
+template<typename T>
+void SetPattern
+( const Grid& grid, Int height, Int width,
+  const vector<Int>& offsets, const vector<Int>& targets,
+  DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    C.SetGrid( grid );
+    Zeros( C, height, width );
+    C.Reserve( targets.size() );
+    const Int localHeight = offsets.size()-1;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        for( Int e=offsets[iLoc]; e<offsets[iLoc+1]; ++e )
+            C.QueueLocalUpdate( iLoc, targets[e], T(0) );
+    C.ProcessLocalQueues();
+}
+
+} // anonymous namespace
+
+template<typename T>
+void SparseProduct<T>::Initialize
+( const SparseMatrix<T>& A, const SparseMatrix<T>& B, SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError("A and B did not conform");
+
+    vector<Int> offsetsC, targetsC;
+    SymbolicProduct
+    ( A.Height(), 0, B.Width(),
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer(),
+      B.LockedOffsetBuffer(), B.LockedTargetBuffer(),
+      false, LOWER, false, offsetsC, targetsC );
+    SetPattern( A.Height(), B.Width(), offsetsC, targetsC, C );
+
+    initialized_ = true;
+    syrk_ = false;
+    triangular_ = false;
+    patternHashA_ = PatternHash( A );
+    patternHashB_ = PatternHash( B );
+    patternHashC_ = PatternHash( C );
+    SwapClear( transOffsets_ );
+    SwapClear( transTargets_ );
+    SwapClear( transSources_ );
+    SwapClear( transValues_ );
+}
+
+template<typename T>
+void SparseProduct<T>::InitializeSyrk
+( const SparseMatrix<T>& A, SparseMatrix<T>& C, bool conjugate )
+{
+    EL_DEBUG_CSE
+    AnalyzeSyrk( false, LOWER, A, C, conjugate );
+}
+
+template<typename T>
+void SparseProduct<T>::InitializeSyrk
+( UpperOrLower uplo, const SparseMatrix<T>& A, SparseMatrix<T>& C,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    AnalyzeSyrk( true, uplo, A, C, conjugate );
+}
+
+template<typename T>
+void SparseProduct<T>::AnalyzeSyrk
+( bool triangular, UpperOrLower uplo,
+  const SparseMatrix<T>& A, SparseMatrix<T>& C, bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    const Int* offsetsA = A.LockedOffsetBuffer();
+    const Int* targetsA = A.LockedTargetBuffer();
+
+    // Form the pattern of A^T with a counting sort (which leaves each row
+    // sorted since the rows of A are traversed in order)
+    transOffsets_.assign( n+1, 0 );
+    for( Int e=0; e<numEntries; ++e )
+        ++transOffsets_[targetsA[e]+1];
+    for( Int k=0; k<n; ++k )
+        transOffsets_[k+1] += transOffsets_[k];
+    transTargets_.resize( numEntries );
+    transSources_.resize( numEntries );
+    transValues_.resize( numEntries );
+    auto positions = transOffsets_;
+    for( Int i=0; i<m; ++i )
+    {
+        for( Int e=offsetsA[i]; e<offsetsA[i+1]; ++e )
+        {
+            const Int pos = positions[targetsA[e]]++;
+            transTargets_[pos] = i;
+            transSources_[pos] = e;
+        }
+    }
+
+    vector<Int> offsetsC, targetsC;
+    SymbolicProduct
+    ( m, 0, m, offsetsA, targetsA, transOffsets_.data(), transTargets_.data(),
+      triangular, uplo, true, offsetsC, targetsC );
+    SetPattern( m, m, offsetsC, targetsC, C );
+
+    initialized_ = true;
+    syrk_ = true;
+    triangular_ = triangular;
+    conjugate_ = conjugate;
+    uplo_ = uplo;
+    patternHashA_ = PatternHash( A );
+    patternHashB_ = 0;
+    patternHashC_ = PatternHash( C );
+}
+
+template<typename T>
+void SparseProduct<T>::CheckPatterns
+( const SparseMatrix<T>& A, std::uint64_t patternHashB,
+  const SparseMatrix<T>& C, bool syrk ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The product has not been initialized");
+    if( syrk != syrk_ )
+        LogicError("The product was initialized for a different operation");
+    if( PatternHash(A) != patternHashA_ || patternHashB != patternHashB_ ||
+        PatternHash(C) != patternHashC_ )
+        LogicError
+        ("The sparsity patterns changed since the product was formed");
+}
+
+template<typename T>
+void SparseProduct<T>::Multiply
+( T alpha, const SparseMatrix<T>& A, const SparseMatrix<T>& B,
+  SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    CheckPatterns( A, PatternHash(B), C, false );
+    if( C.Height() != A.Height() || C.Width() != B.Width() )
+        LogicError("C was of the incorrect size");
+    NumericProduct
+    ( A.Height(), 0, B.Width(), alpha,
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer(), A.LockedValueBuffer(),
+      B.LockedOffsetBuffer(), B.LockedTargetBuffer(), B.LockedValueBuffer(),
+      false, LOWER,
+      C.LockedOffsetBuffer(), C.LockedTargetBuffer(), C.ValueBuffer() );
+}
+
+template<typename T>
+void SparseProduct<T>::Syrk
+( T alpha, const SparseMatrix<T>& A, const Matrix<T>& d, SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    CheckPatterns( A, 0, C, true );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( d.Height() != n || d.Width() != 1 )
+        LogicError("d must be a column vector of length ",n);
+    if( C.Height() != m || C.Width() != m )
+        LogicError("C was of the incorrect size");
+
+    // Form the values of diag(d) A^T (or diag(d) A^H)
+    const T* valuesA = A.LockedValueBuffer();
+    const T* dBuf = d.LockedBuffer();
+    const Int* transOffsetBuf = transOffsets_.data();
+    const Int* transSourceBuf = transSources_.data();
+    T* transValueBuf = transValues_.data();
+    const bool conjugate = conjugate_;
+    EL_PARALLEL_FOR
+    for( Int k=0; k<n; ++k )
+    {
+        const T delta = dBuf[k];
+        for( Int f=transOffsetBuf[k]; f<transOffsetBuf[k+1]; ++f )
+        {
+            const T value = valuesA[transSourceBuf[f]];
+            transValueBuf[f] = delta*(conjugate ? Conj(value) : value);
+        }
+    }
+
+    NumericProduct
+    ( m, 0, m, alpha,
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer(), valuesA,
+      transOffsetBuf, transTargets_.data(), transValueBuf,
+      triangular_, uplo_,
+      C.LockedOffsetBuffer(), C.LockedTargetBuffer(), C.ValueBuffer() );
+}
+
+template<typename T>
+void DistSparseProduct<T>::AnalyzeFetch
+( const DistSparseMatrix<T>& A, const DistMultiVec<T>& layoutB,
+  const Int* offsetsB, const Int* targetsB )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* targetsA = A.LockedTargetBuffer();
+
+    // Determine the (sorted) rows of B which our rows of A multiply
+    vector<Int> rows( targetsA, targetsA+numLocalEntries );
+    std::sort( rows.begin(), rows.end() );
+    rows.erase( std::unique( rows.begin(), rows.end() ), rows.end() );
+    const Int numRows = rows.size();
+    fetchRowOfEntry_.resize( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+        fetchRowOfEntry_[e] =
+          std::lower_bound( rows.begin(), rows.end(), targetsA[e] ) -
+          rows.begin();
+
+    // Request the rows from their owners (since the rows are sorted, they are
+    // already packed by owner)
+    vector<int> requestCounts( commSize, 0 ), requestOffs;
+    for( Int k : rows )
+        ++requestCounts[layoutB.RowOwner(k)];
+    Scan( requestCounts, requestOffs );
+    vector<int> requestedCounts( commSize ), requestedOffs;
+    mpi::AllToAll( requestCounts.data(), 1, requestedCounts.data(), 1, comm );
+    const int numRequested = Scan( requestedCounts, requestedOffs );
+    vector<Int> requested( numRequested );
+    mpi::AllToAll
+    ( rows.data(), requestCounts.data(), requestOffs.data(),
+      requested.data(), requestedCounts.data(), requestedOffs.data(), comm );
+
+    // Return the lengths of the requested rows
+    const Int firstLocalRowB = layoutB.FirstLocalRow();
+    fetchSendRows_.resize( numRequested );
+    vector<Int> requestedLengths( numRequested );
+    fetchSendCounts_.assign( commSize, 0 );
+    for( int q=0; q<commSize; ++q )
+    {
+        for( Int r=requestedOffs[q]; r<requestedOffs[q]+requestedCounts[q];
+             ++r )
+        {
+            const Int kLoc = requested[r] - firstLocalRowB;
+            fetchSendRows_[r] = kLoc;
+            requestedLengths[r] = offsetsB[kLoc+1] - offsetsB[kLoc];
+            fetchSendCounts_[q] += requestedLengths[r];
+        }
+    }
+    vector<Int> lengths( numRows );
+    mpi::AllToAll
+    ( requestedLengths.data(), requestedCounts.data(), requestedOffs.data(),
+      lengths.data(), requestCounts.data(), requestOffs.data(), comm );
+    fetchOffsets_.resize( numRows+1 );
+    fetchOffsets_[0] = 0;
+    for( Int r=0; r<numRows; ++r )
+        fetchOffsets_[r+1] = fetchOffsets_[r] + lengths[r];
+    fetchRecvCounts_.assign( commSize, 0 );
+    for( int q=0; q<commSize; ++q )
+        fetchRecvCounts_[q] =
+          fetchOffsets_[requestOffs[q]+requestCounts[q]] -
+          fetchOffsets_[requestOffs[q]];
+
+    // Return the patterns of the requested rows
+    const int totalSend = Scan( fetchSendCounts_, fetchSendOffs_ );
+    const int totalRecv = Scan( fetchRecvCounts_, fetchRecvOffs_ );
+    vector<Int> sendTargets;
+    sendTargets.reserve( totalSend );
+    for( Int kLoc : fetchSendRows_ )
+        sendTargets.insert
+        ( sendTargets.end(),
+          &targetsB[offsetsB[kLoc]], &targetsB[offsetsB[kLoc+1]] );
+    fetchTargets_.resize( totalRecv );
+    mpi::AllToAll
+    ( sendTargets.data(), fetchSendCounts_.data(), fetchSendOffs_.data(),
+      fetchTargets_.data(), fetchRecvCounts_.data(), fetchRecvOffs_.data(),
+      comm );
+    fetchSendValues_.resize( totalSend );
+    fetchValues_.resize( totalRecv );
+}
+
+template<typename T>
+void DistSparseProduct<T>::FetchValues
+( const Int* offsetsB, const T* valuesB, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    Int off = 0;
+    for( Int kLoc : fetchSendRows_ )
+        for( Int f=offsetsB[kLoc]; f<offsetsB[kLoc+1]; ++f )
+            fetchSendValues_[off++] = valuesB[f];
+    mpi::AllToAll
+    ( fetchSendValues_.data(), fetchSendCounts_.data(), fetchSendOffs_.data(),
+      fetchValues_.data(), fetchRecvCounts_.data(), fetchRecvOffs_.data(),
+      comm );
+}
+
+template<typename T>
+void DistSparseProduct<T>::FormProduct
+( T alpha, const DistSparseMatrix<T>& A, DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    NumericProduct
+    ( A.LocalHeight(), A.FirstLocalRow(), C.Width(), alpha,
+      A.LockedOffsetBuffer(), fetchRowOfEntry_.data(), A.LockedValueBuffer(),
+      fetchOffsets_.data(), fetchTargets_.data(), fetchValues_.data(),
+      triangular_, uplo_,
+      C.LockedOffsetBuffer(), C.LockedTargetBuffer(), C.ValueBuffer() );
+}
+
+template<typename T>
+void DistSparseProduct<T>::Initialize
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError("A and B did not conform");
+    if( !mpi::Congruent( A.Grid().Comm(), B.Grid().Comm() ) )
+        LogicError("Communicators of A and B must match");
+
+    DistMultiVec<T> layoutB( B.Grid() );
+    layoutB.Resize( B.Height(), 0 );
+    AnalyzeFetch( A, layoutB, B.LockedOffsetBuffer(), B.LockedTargetBuffer() );
+
+    vector<Int> offsetsC, targetsC;
+    SymbolicProduct
+    ( A.LocalHeight(), A.FirstLocalRow(), B.Width(),
+      A.LockedOffsetBuffer(), fetchRowOfEntry_.data(),
+      fetchOffsets_.data(), fetchTargets_.data(),
+      false, LOWER, false, offsetsC, targetsC );
+    SetPattern( A.Grid(), A.Height(), B.Width(), offsetsC, targetsC, C );
+
+    initialized_ = true;
+    syrk_ = false;
+    triangular_ = false;
+    patternHashA_ = PatternHash( A );
+    patternHashB_ = PatternHash( B );
+    patternHashC_ = PatternHash( C );
+    SwapClear( transSendPositions_ );
+    SwapClear( transRecvPositions_ );
+    SwapClear( transOffsets_ );
+    SwapClear( transTargets_ );
+    SwapClear( transSendValues_ );
+    SwapClear( transRecvValues_ );
+    SwapClear( transValues_ );
+}
+
+template<typename T>
+void DistSparseProduct<T>::InitializeSyrk
+( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& C, bool conjugate )
+{
+    EL_DEBUG_CSE
+    AnalyzeSyrk( false, LOWER, A, C, conjugate );
+}
+
+template<typename T>
+void DistSparseProduct<T>::InitializeSyrk
+( UpperOrLower uplo, const DistSparseMatrix<T>& A, DistSparseMatrix<T>& C,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    AnalyzeSyrk( true, uplo, A, C, conjugate );
+}
+
+template<typename T>
+void DistSparseProduct<T>::AnalyzeSyrk
+( bool triangular, UpperOrLower uplo,
+  const DistSparseMatrix<T>& A, DistSparseMatrix<T>& C, bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = mpi::Size( comm );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* offsetsA = A.LockedOffsetBuffer();
+    const Int* targetsA = A.LockedTargetBuffer();
+
+    // A^T (and d) are distributed like any other height-n object
+    DistMultiVec<T> layoutTrans( grid );
+    layoutTrans.Resize( n, 0 );
+    const Int firstLocalRowTrans = layoutTrans.FirstLocalRow();
+    const Int localHeightTrans = layoutTrans.LocalHeight();
+
+    // Send each entry (i,k) of A to the owner of row k of A^T
+    transSendCounts_.assign( commSize, 0 );
+    for( Int e=0; e<numLocalEntries; ++e )
+        ++transSendCounts_[layoutTrans.RowOwner(targetsA[e])];
+    const int totalSend = Scan( transSendCounts_, transSendOffs_ );
+    transSendPositions_.resize( numLocalEntries );
+    vector<Int> sendRows( totalSend ), sendCols( totalSend );
+    auto offs = transSendOffs_;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        for( Int e=offsetsA[iLoc]; e<offsetsA[iLoc+1]; ++e )
+        {
+            const Int k = targetsA[e];
+            const Int pos = offs[layoutTrans.RowOwner(k)]++;
+            transSendPositions_[e] = pos;
+            sendRows[pos] = k;
+            sendCols[pos] = firstLocalRow + iLoc;
+        }
+    }
+    transRecvCounts_.resize( commSize );
+    mpi::AllToAll
+    ( transSendCounts_.data(), 1, transRecvCounts_.data(), 1, comm );
+    const int totalRecv = Scan( transRecvCounts_, transRecvOffs_ );
+    vector<Int> recvRows( totalRecv ), recvCols( totalRecv );
+    mpi::AllToAll
+    ( sendRows.data(), transSendCounts_.data(), transSendOffs_.data(),
+      recvRows.data(), transRecvCounts_.data(), transRecvOffs_.data(), comm );
+    mpi::AllToAll
+    ( sendCols.data(), transSendCounts_.data(), transSendOffs_.data(),
+      recvCols.data(), transRecvCounts_.data(), transRecvOffs_.data(), comm );
+
+    // Bucket the received entries by row of A^T. Each process sent its rows
+    // in order and the processes own contiguous, increasing sets of rows, so
+    // the (stable) counting sort leaves each row sorted.
+    transOffsets_.assign( localHeightTrans+1, 0 );
+    for( Int r=0; r<totalRecv; ++r )
+        ++transOffsets_[recvRows[r]-firstLocalRowTrans+1];
+    for( Int kLoc=0; kLoc<localHeightTrans; ++kLoc )
+        transOffsets_[kLoc+1] += transOffsets_[kLoc];
+    transTargets_.resize( totalRecv );
+    transRecvPositions_.resize( totalRecv );
+    auto positions = transOffsets_;
+    for( Int r=0; r<totalRecv; ++r )
+    {
+        const Int pos = positions[recvRows[r]-firstLocalRowTrans]++;
+        transTargets_[pos] = recvCols[r];
+        transRecvPositions_[r] = pos;
+    }
+    transSendValues_.resize( totalSend );
+    transRecvValues_.resize( totalRecv );
+    transValues_.resize( totalRecv );
+
+    AnalyzeFetch
+    ( A, layoutTrans, transOffsets_.data(), transTargets_.data() );
+    vector<Int> offsetsC, targetsC;
+    SymbolicProduct
+    ( localHeight, firstLocalRow, m,
+      offsetsA, fetchRowOfEntry_.data(),
+      fetchOffsets_.data(), fetchTargets_.data(),
+      triangular, uplo, true, offsetsC, targetsC );
+    SetPattern( grid, m, m, offsetsC, targetsC, C );
+
+    initialized_ = true;
+    syrk_ = true;
+    triangular_ = triangular;
+    conjugate_ = conjugate;
+    uplo_ = uplo;
+    patternHashA_ = PatternHash( A );
+    patternHashB_ = 0;
+    patternHashC_ = PatternHash( C );
+}
+
+template<typename T>
+void DistSparseProduct<T>::CheckPatterns
+( const DistSparseMatrix<T>& A, std::uint64_t patternHashB,
+  const DistSparseMatrix<T>& C, bool syrk ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The product has not been initialized");
+    if( syrk != syrk_ )
+        LogicError("The product was initialized for a different operation");
+    if( PatternHash(A) != patternHashA_ || patternHashB != patternHashB_ ||
+        PatternHash(C) != patternHashC_ )
+        LogicError
+        ("The sparsity patterns changed since the product was formed");
+}
+
+template<typename T>
+void DistSparseProduct<T>::Multiply
+( T alpha, const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B,
+  DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    CheckPatterns( A, PatternHash(B), C, false );
+    if( C.Height() != A.Height() || C.Width() != B.Width() )
+        LogicError("C was of the incorrect size");
+    FetchValues
+    ( B.LockedOffsetBuffer(), B.LockedValueBuffer(), A.Grid().Comm() );
+    FormProduct( alpha, A, C );
+}
+
+template<typename T>
+void DistSparseProduct<T>::Syrk
+( T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& d,
+  DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    CheckPatterns( A, 0, C, true );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( d.Height() != n || d.Width() != 1 )
+        LogicError("d must be a column vector of length ",n);
+    if( !mpi::Congruent( A.Grid().Comm(), d.Grid().Comm() ) )
+        LogicError("Communicators of A and d must match");
+    if( C.Height() != m || C.Width() != m )
+        LogicError("C was of the incorrect size");
+    mpi::Comm comm = A.Grid().Comm();
+
+    // Redistribute the values of A into the rows of A^T
+    const T* valuesA = A.LockedValueBuffer();
+    const Int numLocalEntries = A.NumLocalEntries();
+    for( Int e=0; e<numLocalEntries; ++e )
+        transSendValues_[transSendPositions_[e]] = valuesA[e];
+    mpi::AllToAll
+    ( transSendValues_.data(), transSendCounts_.data(), transSendOffs_.data(),
+      transRecvValues_.data(), transRecvCounts_.data(), transRecvOffs_.data(),
+      comm );
+    const Int totalRecv = transRecvValues_.size();
+    for( Int r=0; r<totalRecv; ++r )
+        transValues_[transRecvPositions_[r]] = transRecvValues_[r];
+
+    // Form our rows of diag(d) A^T (or diag(d) A^H)
+    const Int localHeightTrans = d.LocalHeight();
+    const T* dBuf = d.LockedMatrix().LockedBuffer();
+    const Int* transOffsetBuf = transOffsets_.data();
+    T* transValueBuf = transValues_.data();
+    const bool conjugate = conjugate_;
+    EL_PARALLEL_FOR
+    for( Int kLoc=0; kLoc<localHeightTrans; ++kLoc )
+    {
+        const T delta = dBuf[kLoc];
+        for( Int f=transOffsetBuf[kLoc]; f<transOffsetBuf[kLoc+1]; ++f )
+        {
+            const T value = transValueBuf[f];
+            transValueBuf[f] = delta*(conjugate ? Conj(value) : value);
+        }
+    }
+
+    FetchValues( transOffsetBuf, transValueBuf, comm );
+    FormProduct( alpha, A, C );
+}
+
+#define PROTO(T) \
+  template class SparseProduct<T>; \
+  template class DistSparseProduct<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -38,6 +38,9 @@ void Syrk
     const char uploChar = UpperOrLowerToChar( uplo );
     const char transChar = OrientationToChar( orientation );
     const Int k = ( orientation == NORMAL ? A.Width() : A.Height() );
+    if( profile::Enabled() )
+        profile::AddFlops
+        ( (IsComplex<T>::value ? 4. : 1.)*double(C.Height())*C.Height()*k );
     if( conjugate )
     {
         blas::Herk
@@ -104,61 +107,14 @@ void Syrk
   T beta,        SparseMatrix<T>& C, bool conjugate )
 {
     EL_DEBUG_CSE
-
-    if( orientation == NORMAL )
-    {
-        SparseMatrix<T> B;
-        Transpose( A, B, conjugate );
-        const Orientation newOrient = ( conjugate ? ADJOINT : TRANSPOSE );
-        Syrk( uplo, newOrient, alpha, B, beta, C, conjugate );
-        return;
-    }
-
-    const Int m = A.Height();
-    const Int n = A.Width();
+    const Int n = ( orientation==NORMAL ? A.Height() : A.Width() );
     if( C.Height() != n || C.Width() != n )
         LogicError("C was of the incorrect size");
 
+    SparseMatrix<T> P;
+    Syrk( uplo, orientation, alpha, A, P, conjugate );
     ScaleTrapezoid( beta, uplo, C );
-
-    // Compute an upper bound on the required capacity
-    // ===============================================
-    Int newCapacity = C.NumEntries();
-    for( Int k=0; k<m; ++k )
-    {
-        const Int numConn = A.NumConnections(k);
-        newCapacity += numConn*numConn;
-    }
-    C.Reserve( newCapacity );
-
-    // Queue the updates
-    // =================
-    for( Int k=0; k<m; ++k )
-    {
-        const Int offset = A.RowOffset(k);
-        const Int numConn = A.NumConnections(k);
-        for( Int iConn=0; iConn<numConn; ++iConn )
-        {
-            const Int i = A.Col(offset+iConn);
-            const T A_ki = A.Value(offset+iConn);
-            for( Int jConn=0; jConn<numConn; ++jConn )
-            {
-                const Int j = A.Col(offset+jConn);
-                if( (uplo == LOWER && i >= j) || (uplo == UPPER && i <= j) )
-                {
-                    const T A_kj = A.Value(offset+jConn);
-                    if( conjugate )
-                        C.QueueUpdate( i, j, T(alpha)*Conj(A_ki)*A_kj );
-                    else
-                        C.QueueUpdate( i, j, T(alpha)*A_ki*A_kj );
-                }
-            }
-        }
-    }
-
-    // Force the result to be consistent
-    // =================================
-    C.ProcessQueues();
+    Axpy( T(1), P, C );
 }
 
 template<typename T>
@@ -168,14 +124,25 @@ void Syrk
                  SparseMatrix<T>& C, bool conjugate )
 {
     EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
+    SparseProduct<T> product;
+    Matrix<T> d;
     if( orientation == NORMAL )
-        C.Resize( m, m );
+    {
+        product.InitializeSyrk( uplo, A, C, conjugate );
+        d.Resize( A.Width(), 1 );
+        Fill( d, T(1) );
+        product.Syrk( alpha, A, d, C );
+    }
     else
-        C.Resize( n, n );
-    Zero( C );
-    Syrk( uplo, orientation, alpha, A, T(0), C, conjugate );
+    {
+        // A^T A = B B^T, where B = A^T (and similarly for the adjoint)
+        SparseMatrix<T> B;
+        Transpose( A, B, conjugate );
+        product.InitializeSyrk( uplo, B, C, conjugate );
+        d.Resize( B.Width(), 1 );
+        Fill( d, T(1) );
+        product.Syrk( alpha, B, d, C );
+    }
 }
 
 template<typename T>
@@ -185,70 +152,16 @@ void Syrk
   T beta,        DistSparseMatrix<T>& C, bool conjugate )
 {
     EL_DEBUG_CSE
-
-    if( orientation == NORMAL )
-    {
-        DistSparseMatrix<T> B(A.Grid());
-        Transpose( A, B, conjugate );
-        const Orientation newOrient = ( conjugate ? ADJOINT : TRANSPOSE );
-        Syrk( uplo, newOrient, alpha, B, beta, C, conjugate );
-        return;
-    }
-
-    const Int n = A.Width();
+    const Int n = ( orientation==NORMAL ? A.Height() : A.Width() );
     if( C.Height() != n || C.Width() != n )
         LogicError("C was of the incorrect size");
     if( C.Grid().Comm() != A.Grid().Comm() )
         LogicError("Communicators of A and C must match");
 
+    DistSparseMatrix<T> P(A.Grid());
+    Syrk( uplo, orientation, alpha, A, P, conjugate );
     ScaleTrapezoid( beta, uplo, C );
-
-    // Count the number of entries that we will send
-    // =============================================
-    Int sendCount = 0;
-    const Int localHeightA = A.LocalHeight();
-    for( Int kLoc=0; kLoc<localHeightA; ++kLoc )
-    {
-        const Int offset = A.RowOffset(kLoc);
-        const Int numConn = A.NumConnections(kLoc);
-        for( Int iConn=0; iConn<numConn; ++iConn )
-        {
-            const Int i = A.Col(offset+iConn);
-            for( Int jConn=0; jConn<numConn; ++jConn )
-            {
-                const Int j = A.Col(offset+jConn);
-                if( (uplo==LOWER && i>=j) || (uplo==UPPER && i<=j) )
-                    ++sendCount;
-            }
-        }
-    }
-
-    // Apply the updates
-    // =================
-    C.Reserve( sendCount, sendCount );
-    for( Int kLoc=0; kLoc<localHeightA; ++kLoc )
-    {
-        const Int offset = A.RowOffset(kLoc);
-        const Int numConn = A.NumConnections(kLoc);
-        for( Int iConn=0; iConn<numConn; ++iConn )
-        {
-            const Int i = A.Col(offset+iConn);
-            const T A_ki = A.Value(offset+iConn);
-            for( Int jConn=0; jConn<numConn; ++jConn )
-            {
-                const Int j = A.Col(offset+jConn);
-                if( (uplo==LOWER && i>=j) || (uplo==UPPER && i<=j) )
-                {
-                    const T A_kj = A.Value(offset+jConn);
-                    if( conjugate )
-                        C.QueueUpdate( i, j, T(alpha)*Conj(A_ki)*A_kj );
-                    else
-                        C.QueueUpdate( i, j, T(alpha)*A_ki*A_kj );
-                }
-            }
-        }
-    }
-    C.ProcessQueues();
+    Axpy( T(1), P, C );
 }
 
 template<typename T>
@@ -258,14 +171,25 @@ void Syrk
                  DistSparseMatrix<T>& C, bool conjugate )
 {
     EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
+    DistSparseProduct<T> product;
+    DistMultiVec<T> d(A.Grid());
     if( orientation == NORMAL )
-        C.Resize( m, m );
+    {
+        product.InitializeSyrk( uplo, A, C, conjugate );
+        d.Resize( A.Width(), 1 );
+        Fill( d, T(1) );
+        product.Syrk( alpha, A, d, C );
+    }
     else
-        C.Resize( n, n );
-    Zero( C );
-    Syrk( uplo, orientation, alpha, A, T(0), C, conjugate );
+    {
+        // A^T A = B B^T, where B = A^T (and similarly for the adjoint)
+        DistSparseMatrix<T> B(A.Grid());
+        Transpose( A, B, conjugate );
+        product.InitializeSyrk( uplo, B, C, conjugate );
+        d.Resize( B.Width(), 1 );
+        Fill( d, T(1) );
+        product.Syrk( alpha, B, d, C );
+    }
 }
 
 #define PROTO(T) \
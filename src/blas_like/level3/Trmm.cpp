@@ -45,6 +45,13 @@ void Trmm
     const char uploChar = UpperOrLowerToChar( uplo );
     const char transChar = OrientationToChar( orientation );
     const char diagChar = UnitOrNonUnitToChar( diag );
+    if( profile::Enabled() )
+    {
+        const double m = B.Height();
+        const double n = B.Width();
+        profile::AddFlops
+        ( (IsComplex<T>::value ? 4. : 1.)*(side==LEFT ? m*m*n : m*n*n) );
+    }
     blas::Trmm
     ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
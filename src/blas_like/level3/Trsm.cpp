@@ -58,6 +58,13 @@ void Trsm
             if( A.Get(j,j) == F(0) )
                 throw SingularMatrixException();
     }
+    if( profile::Enabled() )
+    {
+        const double m = B.Height();
+        const double n = B.Width();
+        profile::AddFlops
+        ( (IsComplex<F>::value ? 4. : 1.)*(side==LEFT ? m*m*n : m*n*n) );
+    }
     blas::Trsm
     ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
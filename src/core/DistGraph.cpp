@@ -438,47 +438,9 @@ void DistGraph::ProcessLocalQueues()
     EL_DEBUG_CSE
     if( locallyConsistent_ )
         return;
-
-    const Int numLocalEdges = sources_.size();
-    Int numRemoved = 0;
-    vector<pair<Int,Int>> pairs( numLocalEdges );
-    if( markedForRemoval_.size() != 0 )
-    {
-        for( Int e=0; e<numLocalEdges; ++e )
-        {
-            pair<Int,Int> candidate(sources_[e],targets_[e]);
-            if( markedForRemoval_.find(candidate) == markedForRemoval_.end() )
-                pairs[e-numRemoved] = candidate;
-            else
-                ++numRemoved;
-        }
-        SwapClear( markedForRemoval_ );
-        pairs.resize( numLocalEdges-numRemoved );
-    }
-    else
-    {
-        for( Int e=0; e<numLocalEdges; ++e )
-            pairs[e] = pair<Int,Int>{sources_[e],targets_[e]};
-    }
-    std::sort( pairs.begin(), pairs.end() );
-    const Int numSorted = pairs.size();
-
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int e=1; e<numSorted; ++e )
-        if( pairs[e] != pairs[lastUnique] )
-            pairs[++lastUnique] = pairs[e];
-    const Int numUnique = lastUnique+1;
-    pairs.resize( numUnique );
-
-    sources_.resize( numUnique );
-    targets_.resize( numUnique );
-    for( Int e=0; e<numUnique; ++e )
-    {
-        sources_[e] = pairs[e].first;
-        targets_[e] = pairs[e].second;
-    }
-    ComputeSourceOffsets();
+    AssembleQueues
+    ( FirstLocalSource(), numLocalSources_, sources_, targets_,
+      markedForRemoval_, localSourceOffsets_ );
     locallyConsistent_ = true;
 }
 
@@ -734,6 +696,33 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
       meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
       comm );
 
+    // Split our rows into runs of interior and boundary rows
+    const int commRank = grid_->Rank();
+    const Int* offsetBuffer = LockedOffsetBuffer();
+    const Int numLocalSources = NumLocalSources();
+    meta.interiorRuns.clear();
+    meta.boundaryRuns.clear();
+    for( Int iLoc=0; iLoc<numLocalSources; ++iLoc )
+    {
+        bool boundary = false;
+        for( Int e=offsetBuffer[iLoc]; e<offsetBuffer[iLoc+1]; ++e )
+        {
+            if( colBuffer[e] / vecBlocksize != commRank )
+            {
+                boundary = true;
+                break;
+            }
+        }
+        auto& runs = ( boundary ? meta.boundaryRuns : meta.interiorRuns );
+        if( !runs.empty() && runs.back() == iLoc )
+            runs.back() = iLoc+1;
+        else
+        {
+            runs.push_back( iLoc );
+            runs.push_back( iLoc+1 );
+        }
+    }
+
     meta.numRecvInds = numRecvInds;
     meta.ready = true;
 
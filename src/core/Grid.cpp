@@ -126,6 +126,7 @@ void Grid::SetUpGrid()
 
     // Create the communicator for the owning group (mpi::COMM_NULL otherwise)
     mpi::Create( viewingComm_, owningGroup_, owningComm_ );
+    profile::NameComm( viewingComm_, "Viewing" );
 
     vcToViewing_.resize(size_);
     diagsAndRanks_.resize(2*size_);
@@ -210,6 +211,14 @@ void Grid::SetUpGrid()
           mpi::ErrorHandlerSet( mdComm_,     mpi::ERRORS_RETURN );
           mpi::ErrorHandlerSet( mdPerpComm_, mpi::ERRORS_RETURN );
         )
+
+        profile::NameComm( owningComm_, "Owning" );
+        profile::NameComm( mcComm_, "MC" );
+        profile::NameComm( mrComm_, "MR" );
+        profile::NameComm( vcComm_, "VC" );
+        profile::NameComm( vrComm_, "VR" );
+        profile::NameComm( mdComm_, "MD" );
+        profile::NameComm( mdPerpComm_, "MDPerp" );
     }
     else
     {
@@ -0,0 +1,294 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#ifdef __linux__
+# include <sys/mman.h>
+#endif
+
+namespace {
+using namespace El;
+
+const size_t hugePageSize = size_t(1) << 21;
+
+// Each thread keeps its own free lists (indexed by the rounded size of their
+// buffers) so that the common paths never contend for a lock. The mutex of a
+// cache is only shared with ReleasePooledMemory, which empties the caches of
+// every thread.
+struct ThreadCache
+{
+    std::mutex mutex;
+    size_t bytesPooled=0;
+    std::unordered_map<size_t,vector<void*>> freeLists;
+
+    // Returns the number of bytes given back to the system
+    size_t Release()
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        for( auto& entry : freeLists )
+            for( void* ptr : entry.second )
+                std::free( ptr );
+        freeLists.clear();
+        const size_t releasedBytes = bytesPooled;
+        bytesPooled = 0;
+        return releasedBytes;
+    }
+};
+
+struct Pool
+{
+    std::atomic<bool> pool{false};
+    std::atomic<size_t> maxPooledBytes{0};
+    std::atomic<size_t> hugePageThreshold{0};
+    std::atomic<size_t> firstTouchThreshold{0};
+
+    std::atomic<size_t> bytesInUse{0};
+    std::atomic<size_t> peakBytesInUse{0};
+    std::atomic<size_t> bytesPooled{0};
+    std::atomic<size_t> numAllocations{0};
+    std::atomic<size_t> numPoolHits{0};
+
+    // Guards the registry of the caches of the live threads
+    std::mutex registryMutex;
+    std::unordered_set<ThreadCache*> caches;
+
+    Pool()
+    {
+        MemoryCtrl ctrl;
+        pool = ctrl.pool;
+        maxPooledBytes = ctrl.maxPooledBytes;
+        hugePageThreshold = ctrl.hugePageThreshold;
+        firstTouchThreshold = ctrl.firstTouchThreshold;
+    }
+};
+
+// The pool is intentionally never destroyed so that Memory objects with
+// static storage duration can safely release their buffers at exit
+Pool& ThePool()
+{
+    static Pool* pool = new Pool;
+    return *pool;
+}
+
+// The cache of the calling thread is created upon first use and returned to
+// the system when the thread exits, after which it is null and buffers are
+// freed directly
+thread_local ThreadCache* threadCache = nullptr;
+thread_local bool threadCacheDestroyed = false;
+
+struct ThreadCacheOwner
+{
+    ~ThreadCacheOwner()
+    {
+        if( threadCache == nullptr )
+            return;
+        Pool& pool = ThePool();
+        {
+            std::lock_guard<std::mutex> lock( pool.registryMutex );
+            pool.caches.erase( threadCache );
+        }
+        pool.bytesPooled -= threadCache->Release();
+        delete threadCache;
+        threadCache = nullptr;
+        threadCacheDestroyed = true;
+    }
+};
+
+ThreadCache* TheThreadCache()
+{
+    if( threadCache == nullptr && !threadCacheDestroyed )
+    {
+        static thread_local ThreadCacheOwner owner;
+        ThreadCache* cache = new ThreadCache;
+        Pool& pool = ThePool();
+        std::lock_guard<std::mutex> lock( pool.registryMutex );
+        pool.caches.insert( cache );
+        threadCache = cache;
+    }
+    return threadCache;
+}
+
+// Round up to a multiple of a quarter of the largest power of two below the
+// request so that no more than 25% of a buffer is wasted
+size_t RoundedSize( size_t numBytes )
+{
+    if( numBytes <= memoryAlignment )
+        return memoryAlignment;
+    size_t power = memoryAlignment;
+    while( 2*power < numBytes )
+        power *= 2;
+    const size_t step = power / 4;
+    return ((numBytes+step-1)/step)*step;
+}
+
+void* SystemAllocate( size_t numBytes )
+{
+    Pool& pool = ThePool();
+    const size_t hugePageThreshold = pool.hugePageThreshold;
+    const size_t firstTouchThreshold = pool.firstTouchThreshold;
+    const bool hugePages =
+      hugePageThreshold != 0 && numBytes >= hugePageThreshold;
+    const size_t alignment = hugePages ? hugePageSize : memoryAlignment;
+    void* ptr = nullptr;
+    if( posix_memalign( &ptr, alignment, numBytes ) != 0 )
+        throw std::bad_alloc();
+#ifdef __linux__
+    if( hugePages )
+        madvise( ptr, numBytes, MADV_HUGEPAGE );
+#endif
+#ifdef EL_HYBRID
+    if( firstTouchThreshold != 0 && numBytes >= firstTouchThreshold )
+    {
+        const size_t pageSize = 4096;
+        char* bytes = static_cast<char*>(ptr);
+        const long long numPages = (numBytes+pageSize-1) / pageSize;
+        #pragma omp parallel for schedule(static)
+        for( long long page=0; page<numPages; ++page )
+            bytes[page*pageSize] = 0;
+    }
+#endif
+    return ptr;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void SetMemoryCtrl( const MemoryCtrl& ctrl )
+{
+    Pool& pool = ThePool();
+    pool.maxPooledBytes = ctrl.maxPooledBytes;
+    pool.hugePageThreshold = ctrl.hugePageThreshold;
+    pool.firstTouchThreshold = ctrl.firstTouchThreshold;
+    pool.pool = ctrl.pool;
+    if( !ctrl.pool )
+        ReleasePooledMemory();
+}
+
+MemoryCtrl GetMemoryCtrl()
+{
+    Pool& pool = ThePool();
+    MemoryCtrl ctrl;
+    ctrl.pool = pool.pool;
+    ctrl.maxPooledBytes = pool.maxPooledBytes;
+    ctrl.hugePageThreshold = pool.hugePageThreshold;
+    ctrl.firstTouchThreshold = pool.firstTouchThreshold;
+    return ctrl;
+}
+
+MemoryStats GetMemoryStats()
+{
+    Pool& pool = ThePool();
+    MemoryStats stats;
+    stats.bytesInUse = pool.bytesInUse;
+    stats.peakBytesInUse = pool.peakBytesInUse;
+    stats.bytesPooled = pool.bytesPooled;
+    stats.numAllocations = pool.numAllocations;
+    stats.numPoolHits = pool.numPoolHits;
+    return stats;
+}
+
+void ResetPeakMemoryUsage()
+{
+    Pool& pool = ThePool();
+    pool.peakBytesInUse = size_t(pool.bytesInUse);
+}
+
+void ReleasePooledMemory()
+{
+    Pool& pool = ThePool();
+    std::lock_guard<std::mutex> lock( pool.registryMutex );
+    for( ThreadCache* cache : pool.caches )
+        pool.bytesPooled -= cache->Release();
+}
+
+void* PooledAllocate( size_t numBytes )
+{
+    if( numBytes == 0 )
+        return nullptr;
+    const size_t roundedSize = RoundedSize( numBytes );
+
+    Pool& pool = ThePool();
+    ++pool.numAllocations;
+    const size_t bytesInUse = (pool.bytesInUse += roundedSize);
+    size_t peak = pool.peakBytesInUse;
+    while( bytesInUse > peak &&
+           !pool.peakBytesInUse.compare_exchange_weak( peak, bytesInUse ) );
+
+    ThreadCache* cache = nullptr;
+    if( pool.pool )
+    {
+        try { cache = TheThreadCache(); }
+        catch( std::bad_alloc& ) { }
+    }
+    if( cache != nullptr )
+    {
+        std::lock_guard<std::mutex> lock( cache->mutex );
+        auto it = cache->freeLists.find( roundedSize );
+        if( it != cache->freeLists.end() && !it->second.empty() )
+        {
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            cache->bytesPooled -= roundedSize;
+            pool.bytesPooled -= roundedSize;
+            ++pool.numPoolHits;
+            return ptr;
+        }
+    }
+
+    try { return SystemAllocate( roundedSize ); }
+    catch( std::bad_alloc& )
+    {
+        // Return the cached buffers to the system and try once more
+        ReleasePooledMemory();
+        try { return SystemAllocate( roundedSize ); }
+        catch( std::bad_alloc& )
+        {
+            pool.bytesInUse -= roundedSize;
+            throw;
+        }
+    }
+}
+
+void PooledDeallocate( void* ptr, size_t numBytes ) EL_NO_EXCEPT
+{
+    if( ptr == nullptr )
+        return;
+    const size_t roundedSize = RoundedSize( numBytes );
+
+    Pool& pool = ThePool();
+    pool.bytesInUse -= roundedSize;
+    if( pool.pool )
+    {
+        ThreadCache* cache = nullptr;
+        try { cache = TheThreadCache(); }
+        catch( std::bad_alloc& ) { }
+        if( cache != nullptr )
+        {
+            std::lock_guard<std::mutex> lock( cache->mutex );
+            if( cache->bytesPooled+roundedSize <= pool.maxPooledBytes )
+            {
+                try
+                {
+                    cache->freeLists[roundedSize].push_back( ptr );
+                    cache->bytesPooled += roundedSize;
+                    pool.bytesPooled += roundedSize;
+                    return;
+                }
+                catch( std::bad_alloc& ) { }
+            }
+        }
+    }
+    std::free( ptr );
+}
+
+} // namespace El
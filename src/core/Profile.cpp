@@ -0,0 +1,500 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <unordered_map>
+
+namespace El {
+namespace profile {
+
+bool profilingEnabled = false;
+
+namespace {
+
+struct Frame
+{
+    const char* name;
+    bool inMpi;
+    double start, childTime;
+    double flops, bytes, messages;
+};
+
+struct RegionStats
+{
+    bool inMpi=false;
+    Int calls=0, active=0;
+    double time=0, selfTime=0, flops=0, bytes=0, messages=0;
+};
+
+struct Event
+{
+    const char* name;
+    Int depth;
+    double start, duration, flops, bytes;
+};
+
+struct Traffic
+{
+    double bytes=0, messages=0;
+};
+
+// N.B. The keys are the (unique per call site) EL_FUNCTION strings, so that
+// each region costs one hash of a pointer rather than of a string. Regions
+// are merged by name when the summary is formed.
+vector<Frame> regionStack;
+std::unordered_map<const char*,RegionStats> regionStats;
+// Communicator handles can be reused after they are freed, so traffic is
+// keyed on an identifier which outlives the handle
+std::map<std::pair<const char*,Int>,Traffic> regionTraffic;
+std::map<MPI_Comm,Int> commIds;
+vector<string> commNames;
+vector<Event> events;
+Int maxTraceDepth = 8;
+Int maxTraceEvents = 1000000;
+Clock::time_point epoch = Clock::now();
+string traceBasename;
+
+inline bool OnMasterThread()
+{
+#ifdef EL_HYBRID
+    return omp_get_thread_num() == 0;
+#else
+    return true;
+#endif
+}
+
+inline double Elapsed()
+{ return duration<double>(Clock::now()-epoch).count(); }
+
+// Reduce a __PRETTY_FUNCTION__ string, such as
+//   "void El::Gemm(El::Orientation, ...) [with T = double]",
+// to its qualified name, "El::Gemm".
+string ShortName( const char* name )
+{
+    const string full( name );
+    size_t end = string::npos;
+    Int depth = 0;
+    for( size_t i=0; i<full.size(); ++i )
+    {
+        const char c = full[i];
+        if( c == '<' )
+            ++depth;
+        else if( c == '>' && depth > 0 )
+            --depth;
+        else if( c == '(' && depth == 0 )
+        {
+            if( i >= 8 && full.compare(i-8,8,"operator") == 0 &&
+                full.compare(i,2,"()") == 0 )
+                end = i+2;
+            else
+                end = i;
+            break;
+        }
+    }
+    if( end == string::npos )
+        return full;
+    size_t begin = 0;
+    depth = 0;
+    for( size_t i=end; i>0; --i )
+    {
+        const char c = full[i-1];
+        if( c == '>' )
+            ++depth;
+        else if( c == '<' && depth > 0 )
+            --depth;
+        else if( c == ' ' && depth == 0 )
+        {
+            begin = i;
+            break;
+        }
+    }
+    return full.substr( begin, end-begin );
+}
+
+const string& CachedShortName( const char* name )
+{
+    static std::unordered_map<const char*,string> shortNames;
+    auto it = shortNames.find( name );
+    if( it == shortNames.end() )
+        it = shortNames.emplace( name, ShortName(name) ).first;
+    return it->second;
+}
+
+Int CommId( MPI_Comm comm )
+{
+    auto it = commIds.find( comm );
+    if( it == commIds.end() )
+    {
+        // Avoid the mpi wrappers, as we may be in the midst of one
+        int commSize;
+        MPI_Comm_size( comm, &commSize );
+        it = commIds.emplace( comm, commNames.size() ).first;
+        commNames.push_back( BuildString("size ",commSize) );
+    }
+    return it->second;
+}
+
+string JSONEscape( const string& s )
+{
+    string escaped;
+    for( const char c : s )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+// Temporarily disable profiling so that the communication required to report
+// upon a profile is not recorded in it
+class Pause
+{
+public:
+    Pause() : wasEnabled_(profilingEnabled) { profilingEnabled = false; }
+    ~Pause() { profilingEnabled = wasEnabled_; }
+private:
+    bool wasEnabled_;
+};
+
+} // anonymous namespace
+
+void Enable() { profilingEnabled = true; }
+void Disable() { profilingEnabled = false; }
+
+void Reset()
+{
+    regionStack.clear();
+    regionStats.clear();
+    regionTraffic.clear();
+    events.clear();
+    epoch = Clock::now();
+}
+
+void SetMaxTraceDepth( Int maxDepth ) { maxTraceDepth = maxDepth; }
+void SetMaxTraceEvents( Int maxEvents ) { maxTraceEvents = maxEvents; }
+
+void Begin( const char* name )
+{
+    if( !OnMasterThread() )
+        return;
+    auto it = regionStats.find( name );
+    if( it == regionStats.end() )
+    {
+        it = regionStats.emplace( name, RegionStats() ).first;
+        const string shortName = ShortName( name );
+        it->second.inMpi = ( shortName.compare(0,9,"El::mpi::") == 0 );
+    }
+    ++it->second.active;
+
+    Frame frame;
+    frame.name = name;
+    frame.inMpi = it->second.inMpi;
+    frame.start = Elapsed();
+    frame.childTime = 0;
+    frame.flops = frame.bytes = frame.messages = 0;
+    regionStack.push_back( frame );
+}
+
+void End()
+{
+    if( !OnMasterThread() || regionStack.empty() )
+        return;
+    const Frame frame = regionStack.back();
+    const Int depth = regionStack.size();
+    regionStack.pop_back();
+    const double duration = Elapsed() - frame.start;
+
+    RegionStats& stats = regionStats[frame.name];
+    ++stats.calls;
+    stats.selfTime += duration - frame.childTime;
+    // Only the outermost instance of a recursive region is inclusive
+    if( --stats.active <= 0 )
+    {
+        stats.active = 0;
+        stats.time += duration;
+        stats.flops += frame.flops;
+        stats.bytes += frame.bytes;
+        stats.messages += frame.messages;
+    }
+    if( !regionStack.empty() )
+    {
+        Frame& parent = regionStack.back();
+        parent.childTime += duration;
+        parent.flops += frame.flops;
+        parent.bytes += frame.bytes;
+        parent.messages += frame.messages;
+    }
+
+    if( depth <= maxTraceDepth && Int(events.size()) < maxTraceEvents )
+    {
+        Event event;
+        event.name = frame.name;
+        event.depth = depth;
+        event.start = frame.start;
+        event.duration = duration;
+        event.flops = frame.flops;
+        event.bytes = frame.bytes;
+        events.push_back( event );
+    }
+}
+
+void AddFlops( double flops )
+{
+    if( !OnMasterThread() || regionStack.empty() )
+        return;
+    regionStack.back().flops += flops;
+}
+
+void CountComm( mpi::Comm comm, size_t numBytes )
+{
+    if( !OnMasterThread() )
+        return;
+    // Attribute the message to the caller of the mpi wrappers
+    Frame* frame = nullptr;
+    for( auto it=regionStack.rbegin(); it!=regionStack.rend(); ++it )
+    {
+        if( !it->inMpi )
+        {
+            frame = &*it;
+            break;
+        }
+    }
+    if( frame == nullptr )
+        return;
+    frame->bytes += numBytes;
+    frame->messages += 1;
+    Traffic& traffic =
+      regionTraffic[std::make_pair(frame->name,CommId(comm.comm))];
+    traffic.bytes += numBytes;
+    traffic.messages += 1;
+}
+
+void NameComm( mpi::Comm comm, const string& name )
+{ commNames[CommId(comm.comm)] = name; }
+
+void ForgetComm( mpi::Comm comm )
+{ commIds.erase( comm.comm ); }
+
+void WriteTrace( const string& basename )
+{
+    Pause pause;
+    const int rank = mpi::Rank( mpi::COMM_WORLD );
+    const string filename = BuildString(basename,"-",rank,".json");
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << std::setprecision(12);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+         << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+         << ",\"tid\":0,\"args\":{\"name\":\"rank " << rank << "\"}}";
+    for( const auto& event : events )
+    {
+        file << ",\n{\"name\":\""
+             << JSONEscape(CachedShortName(event.name))
+             << "\",\"cat\":\"El\",\"ph\":\"X\",\"pid\":" << rank
+             << ",\"tid\":0,\"ts\":" << 1.e6*event.start
+             << ",\"dur\":" << 1.e6*event.duration
+             << ",\"args\":{\"depth\":" << event.depth
+             << ",\"flops\":" << event.flops
+             << ",\"bytes\":" << event.bytes << "}}";
+    }
+    file << "\n]}" << endl;
+}
+
+void PrintSummary( mpi::Comm comm, ostream& os, Int maxRows )
+{
+    Pause pause;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Serialize this rank's totals, merged by name, as lines of the form
+    //   R <tab> region <tab> calls <tab> time <tab> self <tab> flops ...
+    //   C <tab> region <tab> comm <tab> bytes <tab> messages
+    std::map<string,RegionStats> merged;
+    for( const auto& entry : regionStats )
+    {
+        RegionStats& stats = merged[CachedShortName(entry.first)];
+        stats.calls += entry.second.calls;
+        stats.time += entry.second.time;
+        stats.selfTime += entry.second.selfTime;
+        stats.flops += entry.second.flops;
+        stats.bytes += entry.second.bytes;
+        stats.messages += entry.second.messages;
+    }
+    std::map<std::pair<string,string>,Traffic> mergedTraffic;
+    for( const auto& entry : regionTraffic )
+    {
+        Traffic& traffic =
+          mergedTraffic[std::make_pair
+          (CachedShortName(entry.first.first),commNames[entry.first.second])];
+        traffic.bytes += entry.second.bytes;
+        traffic.messages += entry.second.messages;
+    }
+    ostringstream lines;
+    lines << std::setprecision(17);
+    for( const auto& entry : merged )
+        lines << "R\t" << entry.first << "\t" << entry.second.calls << "\t"
+              << entry.second.time << "\t" << entry.second.selfTime << "\t"
+              << entry.second.flops << "\t" << entry.second.bytes << "\t"
+              << entry.second.messages << "\n";
+    for( const auto& entry : mergedTraffic )
+        lines << "C\t" << entry.first.first << "\t" << entry.first.second
+              << "\t" << entry.second.bytes << "\t" << entry.second.messages
+              << "\n";
+    const string localLines = lines.str();
+
+    const int localSize = localLines.size();
+    vector<int> sizes( commSize ), offsets;
+    mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    const int totalSize = Scan( sizes, offsets );
+    vector<byte> allLines( commRank == 0 ? totalSize : 0 );
+    mpi::Gather
+    ( reinterpret_cast<const byte*>(localLines.data()), localSize,
+      allLines.data(), sizes.data(), offsets.data(), 0, comm );
+    if( commRank != 0 )
+        return;
+
+    struct Summary
+    {
+        Int calls=0;
+        double maxTime=0, sumTime=0, maxSelf=0;
+        double flops=0, bytes=0, messages=0;
+    };
+    std::map<string,Summary> summaries;
+    std::map<std::pair<string,string>,Traffic> totalTraffic;
+    std::map<string,Traffic> commTraffic;
+    std::istringstream stream
+    ( string(reinterpret_cast<const char*>(allLines.data()),totalSize) );
+    string line;
+    while( std::getline( stream, line ) )
+    {
+        vector<string> fields;
+        std::istringstream lineStream( line );
+        string field;
+        while( std::getline( lineStream, field, '\t' ) )
+            fields.push_back( field );
+        if( fields.size() == 8 && fields[0] == "R" )
+        {
+            Summary& summary = summaries[fields[1]];
+            const double time = std::stod(fields[3]);
+            summary.calls += std::stoll(fields[2]);
+            summary.maxTime = Max( summary.maxTime, time );
+            summary.sumTime += time;
+            summary.maxSelf = Max( summary.maxSelf, std::stod(fields[4]) );
+            summary.flops += std::stod(fields[5]);
+            summary.bytes += std::stod(fields[6]);
+            summary.messages += std::stod(fields[7]);
+        }
+        else if( fields.size() == 5 && fields[0] == "C" )
+        {
+            const double bytes = std::stod(fields[3]);
+            const double messages = std::stod(fields[4]);
+            Traffic& traffic =
+              totalTraffic[std::make_pair(fields[1],fields[2])];
+            traffic.bytes += bytes;
+            traffic.messages += messages;
+            commTraffic[fields[2]].bytes += bytes;
+            commTraffic[fields[2]].messages += messages;
+        }
+    }
+
+    auto Truncate = []( const string& name, size_t width )
+      { return name.size() <= width ? name :
+               name.substr(0,width-3) + "..."; };
+    const size_t nameWidth = 48;
+
+    vector<std::pair<string,Summary>> sorted
+    ( summaries.begin(), summaries.end() );
+    std::sort
+    ( sorted.begin(), sorted.end(),
+      []( const std::pair<string,Summary>& a,
+          const std::pair<string,Summary>& b )
+      { return a.second.maxTime > b.second.maxTime; } );
+    ostringstream msg;
+    msg << "Profile over " << commSize << " processes "
+        << "(times are in seconds and maximized over processes; flops, bytes "
+        << "and messages are summed)\n"
+        << std::left << std::setw(nameWidth) << "region" << std::right
+        << std::setw(12) << "calls" << std::setw(12) << "max time"
+        << std::setw(12) << "avg time" << std::setw(12) << "max self"
+        << std::setw(12) << "GFlop/s" << std::setw(12) << "MB"
+        << std::setw(12) << "messages" << "\n";
+    msg << std::setprecision(4);
+    for( Int row=0; row<Min(Int(sorted.size()),maxRows); ++row )
+    {
+        const Summary& summary = sorted[row].second;
+        const double gflops =
+          ( summary.maxTime > 0 ? summary.flops/summary.maxTime/1.e9 : 0. );
+        msg << std::left << std::setw(nameWidth)
+            << Truncate(sorted[row].first,nameWidth-1) << std::right
+            << std::setw(12) << summary.calls
+            << std::setw(12) << summary.maxTime
+            << std::setw(12) << summary.sumTime/commSize
+            << std::setw(12) << summary.maxSelf
+            << std::setw(12) << gflops
+            << std::setw(12) << summary.bytes/1.e6
+            << std::setw(12) << summary.messages << "\n";
+    }
+
+    msg << "\n" << std::left << std::setw(nameWidth) << "communicator"
+        << std::right << std::setw(12) << "MB" << std::setw(12) << "messages"
+        << "\n";
+    for( const auto& entry : commTraffic )
+        msg << std::left << std::setw(nameWidth)
+            << Truncate(entry.first,nameWidth-1) << std::right
+            << std::setw(12) << entry.second.bytes/1.e6
+            << std::setw(12) << entry.second.messages << "\n";
+
+    vector<std::pair<std::pair<string,string>,Traffic>> sortedTraffic
+    ( totalTraffic.begin(), totalTraffic.end() );
+    std::sort
+    ( sortedTraffic.begin(), sortedTraffic.end(),
+      []( const std::pair<std::pair<string,string>,Traffic>& a,
+          const std::pair<std::pair<string,string>,Traffic>& b )
+      { return a.second.bytes > b.second.bytes; } );
+    msg << "\n" << std::left << std::setw(nameWidth) << "region"
+        << std::setw(16) << "communicator" << std::right
+        << std::setw(12) << "MB" << std::setw(12) << "messages" << "\n";
+    for( Int row=0; row<Min(Int(sortedTraffic.size()),maxRows); ++row )
+    {
+        const auto& entry = sortedTraffic[row];
+        msg << std::left << std::setw(nameWidth)
+            << Truncate(entry.first.first,nameWidth-1)
+            << std::setw(16) << Truncate(entry.first.second,15) << std::right
+            << std::setw(12) << entry.second.bytes/1.e6
+            << std::setw(12) << entry.second.messages << "\n";
+    }
+    os << msg.str() << std::flush;
+}
+
+void Initialize()
+{
+    if( const char* basename = std::getenv("EL_PROFILE_TRACE") )
+    {
+        traceBasename = basename;
+        Reset();
+        Enable();
+    }
+}
+
+void Finalize()
+{
+    if( traceBasename.empty() )
+        return;
+    Disable();
+    WriteTrace( traceBasename );
+    PrintSummary();
+    traceBasename.clear();
+}
+
+} // namespace profile
+} // namespace El
@@ -182,6 +182,13 @@ void Initialize( int& argc, char**& argv )
     EmptyBlocksizeStack();
     PushBlocksizeStack( 128 );
 
+    // Load any machine-specific tuning parameters
+    if( const char* tuningFile = std::getenv("EL_TUNING_FILE") )
+        LoadTuningFile( tuningFile );
+
+    // Enable profiling if EL_PROFILE_TRACE was set
+    profile::Initialize();
+
     // Build the default grid
     Grid::InitializeDefault();
     Grid::InitializeTrivial();
@@ -214,6 +221,8 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        profile::Finalize();
+
         Grid::FinalizeDefault();
         Grid::FinalizeTrivial();
 
@@ -228,6 +237,7 @@ void Finalize()
 
 
         EmptyBlocksizeStack();
+        ReleasePooledMemory();
 
 #ifdef EL_HAVE_QD
         FinalizeQD();
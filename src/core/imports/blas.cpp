@@ -12,6 +12,9 @@ using El::BlasInt;
 using El::scomplex;
 using El::dcomplex;
 
+// Vectorized DoubleDouble kernels
+#include "./blas/DoubleDouble.hpp"
+
 // Level 1
 #include "./blas/Axpy.hpp"
 #include "./blas/Copy.hpp"
@@ -38,6 +38,9 @@ void Axpy
   const T* x, BlasInt incx,
         T* y, BlasInt incy )
 {
+    if( dd::Axpy( n, alpha, x, incx, y, incy ) )
+        return;
+
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     T gamma;
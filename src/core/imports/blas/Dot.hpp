@@ -33,6 +33,8 @@ T Dot
     //       involves a memory allocation
     T gamma;
     T alpha = 0;
+    if( dd::Dot( n, x, incx, y, incy, alpha ) )
+        return alpha;
     for( BlasInt i=0; i<n; ++i )
     {
         Conj( x[i*incx], gamma );
@@ -118,6 +120,8 @@ T Dotu
     //       involves a memory allocation
     T gamma;
     T alpha = 0;
+    if( dd::Dot( n, x, incx, y, incy, alpha ) )
+        return alpha;
     for( BlasInt i=0; i<n; ++i )
     {
         gamma = x[i*incx];
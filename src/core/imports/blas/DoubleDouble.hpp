@@ -0,0 +1,391 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Kernels which operate directly upon the (high,low) pairs of doubles that
+// make up a DoubleDouble. Each call into the QD library performs a single
+// scalar operation, whereas the loops below are written so that the
+// compiler can apply the error-free transformations to several entries at
+// once. With GCC on x86-64 Linux, AVX-512 and AVX2/FMA clones of each kernel
+// are generated and the appropriate one is chosen at load time based upon
+// the CPU.
+
+#if defined(__GNUC__) && !defined(__clang__) && \
+    defined(__x86_64__) && defined(__linux__)
+# define EL_DD_TARGETS \
+  __attribute__((target_clones("arch=skylake-avx512","arch=haswell","default")))
+#else
+# define EL_DD_TARGETS
+#endif
+#define EL_DD_INLINE static inline __attribute__((always_inline))
+
+namespace El {
+namespace blas {
+namespace dd {
+
+// Error-free transformations
+// ==========================
+EL_DD_INLINE void TwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    const double bb = s - a;
+    e = (a - (s - bb)) + (b - bb);
+}
+
+// Requires |a| >= |b|
+EL_DD_INLINE void QuickTwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    e = b - (s - a);
+}
+
+EL_DD_INLINE void TwoProd( double a, double b, double& p, double& e )
+{
+    p = a*b;
+    e = std::fma( a, b, -p );
+}
+
+// (sHi,sLo) := (aHi,aLo) + (bHi,bLo) using the same (IEEE-style) algorithm as
+// the default addition of the QD library
+EL_DD_INLINE void Add
+( double aHi, double aLo, double bHi, double bLo, double& sHi, double& sLo )
+{
+    double s1, s2, t1, t2;
+    TwoSum( aHi, bHi, s1, s2 );
+    TwoSum( aLo, bLo, t1, t2 );
+    s2 += t1;
+    QuickTwoSum( s1, s2, s1, s2 );
+    s2 += t2;
+    QuickTwoSum( s1, s2, sHi, sLo );
+}
+
+// (pHi,pLo) := (aHi,aLo) (bHi,bLo)
+EL_DD_INLINE void Mul
+( double aHi, double aLo, double bHi, double bLo, double& pHi, double& pLo )
+{
+    double p1, p2;
+    TwoProd( aHi, bHi, p1, p2 );
+    p2 += aHi*bLo + aLo*bHi;
+    QuickTwoSum( p1, p2, pHi, pLo );
+}
+
+// Kernels
+// =======
+// All vectors are arrays of (high,low) pairs and strides are in units of
+// pairs.
+
+// Dot products accumulate into this many independent partial sums so that
+// the loop-carried dependence does not prevent vectorization
+const int numDotLanes = 8;
+
+// y := alpha x + y
+EL_DD_TARGETS
+void AxpyKernel
+( BlasInt n, const double* alpha,
+  const double* x, BlasInt incx,
+        double* y, BlasInt incy )
+{
+    const double aHi = alpha[0], aLo = alpha[1];
+    if( incx == 1 && incy == 1 )
+    {
+        for( BlasInt i=0; i<n; ++i )
+        {
+            double tHi, tLo;
+            Mul( aHi, aLo, x[2*i], x[2*i+1], tHi, tLo );
+            Add( y[2*i], y[2*i+1], tHi, tLo, y[2*i], y[2*i+1] );
+        }
+    }
+    else
+    {
+        for( BlasInt i=0; i<n; ++i )
+        {
+            double tHi, tLo;
+            const double* xi = &x[2*i*incx];
+            double* yi = &y[2*i*incy];
+            Mul( aHi, aLo, xi[0], xi[1], tHi, tLo );
+            Add( yi[0], yi[1], tHi, tLo, yi[0], yi[1] );
+        }
+    }
+}
+
+// x := alpha x
+EL_DD_TARGETS
+void ScalKernel( BlasInt n, const double* alpha, double* x, BlasInt incx )
+{
+    const double aHi = alpha[0], aLo = alpha[1];
+    for( BlasInt i=0; i<n; ++i )
+    {
+        double* xi = &x[2*i*incx];
+        Mul( aHi, aLo, xi[0], xi[1], xi[0], xi[1] );
+    }
+}
+
+// result := x^T y
+EL_DD_TARGETS
+void DotKernel
+( BlasInt n,
+  const double* x, BlasInt incx,
+  const double* y, BlasInt incy,
+        double* result )
+{
+    double accHi[numDotLanes], accLo[numDotLanes];
+    for( int l=0; l<numDotLanes; ++l )
+        accHi[l] = accLo[l] = 0;
+    BlasInt i=0;
+    if( incx == 1 && incy == 1 )
+    {
+        for( ; i+numDotLanes<=n; i+=numDotLanes )
+        {
+            for( int l=0; l<numDotLanes; ++l )
+            {
+                double pHi, pLo;
+                Mul
+                ( x[2*(i+l)], x[2*(i+l)+1], y[2*(i+l)], y[2*(i+l)+1],
+                  pHi, pLo );
+                Add( accHi[l], accLo[l], pHi, pLo, accHi[l], accLo[l] );
+            }
+        }
+    }
+    for( ; i<n; ++i )
+    {
+        double pHi, pLo;
+        const double* xi = &x[2*i*incx];
+        const double* yi = &y[2*i*incy];
+        Mul( xi[0], xi[1], yi[0], yi[1], pHi, pLo );
+        Add( accHi[0], accLo[0], pHi, pLo, accHi[0], accLo[0] );
+    }
+    double sumHi=0, sumLo=0;
+    for( int l=0; l<numDotLanes; ++l )
+        Add( sumHi, sumLo, accHi[l], accLo[l], sumHi, sumLo );
+    result[0] = sumHi;
+    result[1] = sumLo;
+}
+
+// result := sum_i (scale x_i)^2, where 'scale' must be a power of two so
+// that the scaling is exact
+EL_DD_TARGETS
+void ScaledSquareSumKernel
+( BlasInt n, const double* x, BlasInt incx, double scale, double* result )
+{
+    double accHi[numDotLanes], accLo[numDotLanes];
+    for( int l=0; l<numDotLanes; ++l )
+        accHi[l] = accLo[l] = 0;
+    BlasInt i=0;
+    if( incx == 1 )
+    {
+        for( ; i+numDotLanes<=n; i+=numDotLanes )
+        {
+            for( int l=0; l<numDotLanes; ++l )
+            {
+                double pHi, pLo;
+                const double xHi = scale*x[2*(i+l)];
+                const double xLo = scale*x[2*(i+l)+1];
+                Mul( xHi, xLo, xHi, xLo, pHi, pLo );
+                Add( accHi[l], accLo[l], pHi, pLo, accHi[l], accLo[l] );
+            }
+        }
+    }
+    for( ; i<n; ++i )
+    {
+        double pHi, pLo;
+        const double xHi = scale*x[2*i*incx];
+        const double xLo = scale*x[2*i*incx+1];
+        Mul( xHi, xLo, xHi, xLo, pHi, pLo );
+        Add( accHi[0], accLo[0], pHi, pLo, accHi[0], accLo[0] );
+    }
+    double sumHi=0, sumLo=0;
+    for( int l=0; l<numDotLanes; ++l )
+        Add( sumHi, sumLo, accHi[l], accLo[l], sumHi, sumLo );
+    result[0] = sumHi;
+    result[1] = sumLo;
+}
+
+// C(0:mr,0:nr) += APanel BPanel for the 4 x 4 micro-tiles of the packed
+// Gemm engine, where APanel and BPanel are kc x 4 arrays of pairs
+EL_DD_TARGETS
+void MicroKernel4x4Kernel
+( BlasInt kc, BlasInt mr, BlasInt nr,
+  const double* APanel, const double* BPanel,
+        double* C, BlasInt CLDim )
+{
+    double accHi[16], accLo[16];
+    for( int e=0; e<16; ++e )
+        accHi[e] = accLo[e] = 0;
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const double* a = &APanel[8*l];
+        const double* b = &BPanel[8*l];
+        for( int j=0; j<4; ++j )
+        {
+            const double bHi = b[2*j], bLo = b[2*j+1];
+            for( int i=0; i<4; ++i )
+            {
+                double pHi, pLo;
+                Mul( a[2*i], a[2*i+1], bHi, bLo, pHi, pLo );
+                Add
+                ( accHi[i+4*j], accLo[i+4*j], pHi, pLo,
+                  accHi[i+4*j], accLo[i+4*j] );
+            }
+        }
+    }
+    for( BlasInt j=0; j<nr; ++j )
+    {
+        for( BlasInt i=0; i<mr; ++i )
+        {
+            double* gamma = &C[2*(i+j*CLDim)];
+            Add
+            ( gamma[0], gamma[1], accHi[i+4*j], accLo[i+4*j],
+              gamma[0], gamma[1] );
+        }
+    }
+}
+
+// Hooks for the generic BLAS implementations
+// ==========================================
+// Each returns true if the operation was performed by the kernels above.
+
+template<typename T>
+bool Axpy
+( BlasInt n, const T& alpha, const T* x, BlasInt incx, T* y, BlasInt incy )
+{ return false; }
+
+template<typename T>
+bool Scal( BlasInt n, const T& alpha, T* x, BlasInt incx )
+{ return false; }
+
+template<typename T>
+bool Dot
+( BlasInt n, const T* x, BlasInt incx, const T* y, BlasInt incy, T& result )
+{ return false; }
+
+template<typename T>
+bool Nrm2( BlasInt n, const T* x, BlasInt incx, Base<T>& result )
+{ return false; }
+
+template<typename T>
+bool Gemv
+( char trans, BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* x, BlasInt incx,
+  const T& beta,
+        T* y, BlasInt incy )
+{ return false; }
+
+#ifdef EL_HAVE_QD
+static_assert
+( sizeof(DoubleDouble) == 2*sizeof(double),
+  "DoubleDouble is assumed to be a (high,low) pair of doubles" );
+
+inline const double* Pairs( const DoubleDouble* x )
+{ return reinterpret_cast<const double*>(x); }
+inline double* Pairs( DoubleDouble* x )
+{ return reinterpret_cast<double*>(x); }
+
+inline bool Axpy
+( BlasInt n, const DoubleDouble& alpha,
+  const DoubleDouble* x, BlasInt incx,
+        DoubleDouble* y, BlasInt incy )
+{
+    AxpyKernel( n, Pairs(&alpha), Pairs(x), incx, Pairs(y), incy );
+    return true;
+}
+
+inline bool Scal
+( BlasInt n, const DoubleDouble& alpha, DoubleDouble* x, BlasInt incx )
+{
+    if( alpha == DoubleDouble(0) )
+    {
+        // Avoid propagating NaN's, as in the reference BLAS
+        for( BlasInt i=0; i<n; ++i )
+            x[i*incx] = 0;
+        return true;
+    }
+    ScalKernel( n, Pairs(&alpha), Pairs(x), incx );
+    return true;
+}
+
+inline bool Dot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy,
+  DoubleDouble& result )
+{
+    DotKernel( n, Pairs(x), incx, Pairs(y), incy, Pairs(&result) );
+    return true;
+}
+
+inline bool Nrm2
+( BlasInt n, const DoubleDouble* x, BlasInt incx, DoubleDouble& result )
+{
+    // Scale by a power of two near the reciprocal of the largest entry so
+    // that the squares can neither overflow nor underflow
+    double maxAbs = 0;
+    for( BlasInt i=0; i<n; ++i )
+        maxAbs = Max( maxAbs, std::abs(x[i*incx].x[0]) );
+    if( maxAbs == 0 )
+    {
+        result = 0;
+        return true;
+    }
+    if( !std::isfinite(maxAbs) )
+        return false;
+    const int exponent = std::ilogb( maxAbs );
+    DoubleDouble squareSum;
+    ScaledSquareSumKernel
+    ( n, Pairs(x), incx, std::ldexp(1.,-exponent), Pairs(&squareSum) );
+    result = Sqrt( squareSum );
+    result *= std::ldexp(1.,exponent);
+    return true;
+}
+
+inline bool Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy )
+{
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt yHeight = ( normal ? m : n );
+    if( beta != DoubleDouble(1) )
+        Scal( yHeight, beta, y, incy );
+    if( alpha == DoubleDouble(0) )
+        return true;
+
+    DoubleDouble gamma;
+    if( normal )
+    {
+        // y := alpha A x + y, one column of A at a time
+        for( BlasInt j=0; j<n; ++j )
+        {
+            gamma = alpha;
+            gamma *= x[j*incx];
+            AxpyKernel
+            ( m, Pairs(&gamma), Pairs(&A[j*ALDim]), 1, Pairs(y), incy );
+        }
+    }
+    else
+    {
+        // y := alpha A^T x + y, one dot product per column of A
+        for( BlasInt j=0; j<n; ++j )
+        {
+            DotKernel
+            ( m, Pairs(&A[j*ALDim]), 1, Pairs(x), incx, Pairs(&gamma) );
+            gamma *= alpha;
+            y[j*incy] += gamma;
+        }
+    }
+    return true;
+}
+#endif // ifdef EL_HAVE_QD
+
+} // namespace dd
+} // namespace blas
+} // namespace El
@@ -44,6 +44,249 @@ void EL_BLAS(zgemm)
 namespace El {
 namespace blas {
 
+namespace gemm {
+
+// Blocking parameters of the packed engine used for the scalar types which
+// the vendor BLAS does not support. A panel of op(A) of size MC x KC is packed
+// so that it remains in the L2 cache, a KC x NR micro-panel of op(B) is
+// streamed through the L1 cache, and an MR x NR tile of C is accumulated in
+// registers. The tiles are kept small since a single DoubleDouble or
+// QuadDouble already occupies two or four registers. NB is the blocksize used
+// by the other level-3 fallbacks to cast most of their work onto the engine.
+template<typename T>
+struct EngineTraits
+{
+    static constexpr BlasInt MR = ( sizeof(T) <= 16 ? 4 : 2 );
+    static constexpr BlasInt NR = ( sizeof(T) <= 32 ? 4 : 2 );
+    static constexpr BlasInt KC = ( sizeof(T) <= 16 ? 256 : 128 );
+    static constexpr BlasInt MC = 196608 / (KC*sizeof(T)) / MR * MR;
+    static constexpr BlasInt NC = 2048;
+    static constexpr BlasInt NB = 64;
+    static constexpr bool threaded = true;
+};
+
+#ifdef EL_HAVE_MPC
+// Each arithmetic operation on an MPFR-backed scalar is far more expensive
+// than a cache miss, so small blocks suffice, and the engine is kept
+// sequential since MPFR is not guaranteed to be built thread-safe
+template<>
+struct EngineTraits<BigInt>
+{
+    static constexpr BlasInt MR = 2, NR = 2, KC = 64, MC = 32, NC = 256,
+                             NB = 32;
+    static constexpr bool threaded = false;
+};
+template<>
+struct EngineTraits<BigFloat>
+{
+    static constexpr BlasInt MR = 2, NR = 2, KC = 64, MC = 32, NC = 256,
+                             NB = 32;
+    static constexpr bool threaded = false;
+};
+template<>
+struct EngineTraits<Complex<BigFloat>>
+{
+    static constexpr BlasInt MR = 2, NR = 2, KC = 64, MC = 32, NC = 256,
+                             NB = 32;
+    static constexpr bool threaded = false;
+};
+#endif
+
+// Pack the mc x kc block of op(A) whose top-left entry is at 'A' into
+// row micro-panels of height MR, padding the last micro-panel with zeros
+template<typename T,BlasInt MR>
+void PackA
+( char transA, BlasInt mc, BlasInt kc,
+  const T* A, BlasInt ALDim, T* APacked )
+{
+    const bool normal = ( std::toupper(transA) == 'N' );
+    const bool conjugate = ( std::toupper(transA) == 'C' );
+    for( BlasInt ir=0; ir<mc; ir+=MR )
+    {
+        const BlasInt mr = Min( MR, mc-ir );
+        T* panel = &APacked[ir*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            T* column = &panel[l*MR];
+            if( normal )
+                for( BlasInt i=0; i<mr; ++i )
+                    column[i] = A[(ir+i)+l*ALDim];
+            else if( conjugate )
+                for( BlasInt i=0; i<mr; ++i )
+                    Conj( A[l+(ir+i)*ALDim], column[i] );
+            else
+                for( BlasInt i=0; i<mr; ++i )
+                    column[i] = A[l+(ir+i)*ALDim];
+            for( BlasInt i=mr; i<MR; ++i )
+                column[i] = 0;
+        }
+    }
+}
+
+// Pack the kc x nr micro-panel of alpha op(B) whose top-left entry is at 'B',
+// padding with zeros up to a width of NR
+template<typename T,BlasInt NR>
+void PackBPanel
+( char transB, BlasInt kc, BlasInt nr,
+  const T& alpha, const T* B, BlasInt BLDim, T* BPanel )
+{
+    const bool normal = ( std::toupper(transB) == 'N' );
+    const bool conjugate = ( std::toupper(transB) == 'C' );
+    const bool scale = ( alpha != T(1) );
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        T* row = &BPanel[l*NR];
+        for( BlasInt j=0; j<nr; ++j )
+        {
+            if( normal )
+                row[j] = B[l+j*BLDim];
+            else if( conjugate )
+                Conj( B[j+l*BLDim], row[j] );
+            else
+                row[j] = B[j+l*BLDim];
+            if( scale )
+                row[j] *= alpha;
+        }
+        for( BlasInt j=nr; j<NR; ++j )
+            row[j] = 0;
+    }
+}
+
+// C(0:mr,0:nr) += APanel BPanel, where the panels were packed by PackA and
+// PackBPanel. The full MR x NR tile is accumulated in local storage so that
+// the inner loop has fixed trip counts.
+template<typename T,BlasInt MR,BlasInt NR>
+void MicroKernel
+( BlasInt kc, BlasInt mr, BlasInt nr,
+  const T* APanel, const T* BPanel,
+        T* C, BlasInt CLDim )
+{
+    // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
+    //       involves a memory allocation
+    T acc[MR*NR];
+    for( BlasInt e=0; e<MR*NR; ++e )
+        acc[e] = 0;
+    T delta;
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const T* a = &APanel[l*MR];
+        const T* b = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            for( BlasInt i=0; i<MR; ++i )
+            {
+                delta = a[i];
+                delta *= b[j];
+                acc[i+j*MR] += delta;
+            }
+        }
+    }
+    for( BlasInt j=0; j<nr; ++j )
+        for( BlasInt i=0; i<mr; ++i )
+            C[i+j*CLDim] += acc[i+j*MR];
+}
+
+#ifdef EL_HAVE_QD
+template<>
+void MicroKernel<DoubleDouble,4,4>
+( BlasInt kc, BlasInt mr, BlasInt nr,
+  const DoubleDouble* APanel, const DoubleDouble* BPanel,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    dd::MicroKernel4x4Kernel
+    ( kc, mr, nr, dd::Pairs(APanel), dd::Pairs(BPanel), dd::Pairs(C), CLDim );
+}
+#endif
+
+// C := alpha op(A) op(B) + C using packed panels, with the row blocks of C
+// distributed over the OpenMP threads
+template<typename T>
+void PackedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    typedef EngineTraits<T> Traits;
+    const BlasInt MR = Traits::MR;
+    const BlasInt NR = Traits::NR;
+    const BlasInt kcMax = Min( BlasInt(Traits::KC), k );
+    const BlasInt ncMax = Min( BlasInt(Traits::NC), n );
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+
+    // Shrink the row blocks if there would otherwise be fewer than threads
+    BlasInt mcMax = Traits::MC;
+    bool threaded = Traits::threaded;
+#ifdef EL_HYBRID
+    const BlasInt maxThreads = omp_get_max_threads();
+    threaded = threaded && maxThreads > 1 && BlasInt(m)*n*k >= 32768;
+    if( threaded )
+    {
+        const BlasInt mPerThread = (m+maxThreads-1) / maxThreads;
+        mcMax = Min( mcMax, Max( (mPerThread+MR-1)/MR*MR, MR ) );
+    }
+#else
+    threaded = false;
+#endif
+    mcMax = Min( mcMax, (m+MR-1)/MR*MR );
+    const BlasInt numRowBlocks = (m+mcMax-1) / mcMax;
+
+    std::vector<T> BPacked( ((ncMax+NR-1)/NR*NR)*kcMax );
+#ifdef EL_HYBRID
+    #pragma omp parallel if(threaded)
+#endif
+    {
+        std::vector<T> APacked( mcMax*kcMax );
+        for( BlasInt jc=0; jc<n; jc+=ncMax )
+        {
+            const BlasInt nc = Min( ncMax, n-jc );
+            const BlasInt numPanels = (nc+NR-1) / NR;
+            for( BlasInt pc=0; pc<k; pc+=kcMax )
+            {
+                const BlasInt kc = Min( kcMax, k-pc );
+
+#ifdef EL_HYBRID
+                #pragma omp for
+#endif
+                for( BlasInt q=0; q<numPanels; ++q )
+                {
+                    const BlasInt jr = q*NR;
+                    const T* BBlock = ( normalB ? &B[pc+(jc+jr)*BLDim]
+                                                : &B[(jc+jr)+pc*BLDim] );
+                    PackBPanel<T,Traits::NR>
+                    ( transB, kc, Min(NR,nc-jr), alpha, BBlock, BLDim,
+                      &BPacked[jr*kc] );
+                }
+
+#ifdef EL_HYBRID
+                #pragma omp for schedule(dynamic)
+#endif
+                for( BlasInt blockIndex=0; blockIndex<numRowBlocks;
+                     ++blockIndex )
+                {
+                    const BlasInt ic = blockIndex*mcMax;
+                    const BlasInt mc = Min( mcMax, m-ic );
+                    const T* ABlock = ( normalA ? &A[ic+pc*ALDim]
+                                                : &A[pc+ic*ALDim] );
+                    PackA<T,Traits::MR>
+                    ( transA, mc, kc, ABlock, ALDim, APacked.data() );
+                    for( BlasInt jr=0; jr<nc; jr+=NR )
+                        for( BlasInt ir=0; ir<mc; ir+=MR )
+                            MicroKernel<T,Traits::MR,Traits::NR>
+                            ( kc, Min(MR,mc-ir), Min(NR,nc-jr),
+                              &APacked[ir*kc], &BPacked[jr*kc],
+                              &C[(ic+ir)+(jc+jr)*CLDim], CLDim );
+                }
+            }
+        }
+    }
+}
+
+} // namespace gemm
+
 template<typename T>
 void Gemm
 ( char transA, char transB,
@@ -77,188 +320,12 @@ void Gemm
             for( BlasInt i=0; i<m; ++i )
                 C[i+j*CLDim] *= beta;
     }
+    if( m == 0 || n == 0 || k == 0 || alpha == T(0) )
+        return;
 
-    // Naive implementation
-    T gamma, delta;
-    if( std::toupper(transA) == 'N' && std::toupper(transB) == 'N' )
-    {
-        // C := alpha A B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt l=0; l<k; ++l )
-            {
-                gamma = alpha;
-                gamma *= B[l+j*BLDim];
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= gamma;
-                    C[i+j*CLDim] += delta;
-                }
-            }
-        }
-    }
-    else if( std::toupper(transA) == 'N' )
-    {
-        if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    gamma = alpha;
-                    gamma *= B[j+l*BLDim];
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    Conj( B[j+l*BLDim], gamma );
-                    gamma *= alpha;
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-    }
-    else if( std::toupper(transB) == 'N' )
-    {
-        if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-    }
-    else
-    {
-        if( std::toupper(transA) == 'T' && std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^T B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( B[j+l*BLDim], delta );
-                        delta *= A[l+i*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^H B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B^H + C
-            T phi;
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );       
-                        Conj( B[j+l*BLDim], phi );
-                        delta *= phi;
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-    }
+    // C := alpha op(A) op(B) + C
+    gemm::PackedGemm
+    ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
 }
 template void Gemm
 ( char transA, char transB,
@@ -48,6 +48,9 @@ void Gemv
   const T& beta,
         T* y, BlasInt incy )
 {
+    if( dd::Gemv( trans, m, n, alpha, A, ALDim, x, incx, beta, y, incy ) )
+        return;
+
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     // TODO: Special-case alpha=0, alpha=1, and alpha=-1?
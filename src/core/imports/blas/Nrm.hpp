@@ -42,6 +42,8 @@ Base<F> Nrm2( BlasInt n, const F* x, BlasInt incx )
 {
     typedef Base<F> Real;
     Real scale = 0; 
+    if( dd::Nrm2( n, x, incx, scale ) )
+        return scale;
     Real scaledSquare = 1;
     for( BlasInt i=0; i<n; ++i )
         UpdateScaledSquare( x[i*incx], scale, scaledSquare );
@@ -26,6 +26,8 @@ namespace blas {
 template<typename T>
 void Scal( BlasInt n, const T& alpha, T* x, BlasInt incx )
 {
+    if( dd::Scal( n, alpha, x, incx ) )
+        return;
     for( BlasInt j=0; j<n; ++j )
         x[j*incx] *= alpha;
 }
@@ -60,8 +60,34 @@ void EL_BLAS(zsymm)
 namespace El {
 namespace blas {
 
+// Form the full mA x mA (conjugate-)symmetric matrix from the triangle of A
+// referenced by 'uplo'
 template<typename T>
-void Hemm
+void ExpandHermitian
+( char uplo, BlasInt mA, const T* A, BlasInt ALDim,
+  std::vector<T>& AFull, bool conjugate )
+{
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    AFull.resize( mA*mA );
+    for( BlasInt j=0; j<mA; ++j )
+    {
+        const BlasInt iBeg = ( lower ? j : 0 );
+        const BlasInt iEnd = ( lower ? mA : j+1 );
+        for( BlasInt i=iBeg; i<iEnd; ++i )
+        {
+            AFull[i+j*mA] = A[i+j*ALDim];
+            if( i == j )
+                continue;
+            if( conjugate )
+                Conj( A[i+j*ALDim], AFull[j+i*mA] );
+            else
+                AFull[j+i*mA] = A[i+j*ALDim];
+        }
+    }
+}
+
+template<typename T>
+void HemmUnblocked
 ( char side, char uplo,
   BlasInt m, BlasInt n,
   const T& alpha,
@@ -239,6 +265,38 @@ void Hemm
           LogicError("Unsuported Hemm option");
     )
 }
+// Expand the referenced triangle of A into a full matrix so that the product
+// is a single call to the packed Gemm engine. The extra O(mA^2) storage is
+// small relative to the O(mA^2 n) work.
+template<typename T>
+void Hemm
+( char side, char uplo,
+  BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt mA = ( onLeft ? m : n );
+    if( mA <= gemm::EngineTraits<T>::NB )
+    {
+        HemmUnblocked
+        ( side, uplo, m, n, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+    std::vector<T> AFull;
+    ExpandHermitian( uplo, mA, A, ALDim, AFull, true );
+    if( onLeft )
+        Gemm
+        ( 'N', 'N', m, n, m,
+          alpha, AFull.data(), mA, B, BLDim, beta, C, CLDim );
+    else
+        Gemm
+        ( 'N', 'N', m, n, n,
+          alpha, B, BLDim, AFull.data(), mA, beta, C, CLDim );
+}
 template void Hemm
 ( char side, char uplo, BlasInt m, BlasInt n,
   const Int& alpha,
@@ -369,7 +427,7 @@ void Hemm
 }
 
 template<typename T>
-void Symm
+void SymmUnblocked
 ( char side, char uplo,
   BlasInt m, BlasInt n, 
   const T& alpha,
@@ -547,6 +605,36 @@ void Symm
           LogicError("Unsuported Symm option");
     )
 }
+// The same approach as Hemm
+template<typename T>
+void Symm
+( char side, char uplo,
+  BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt mA = ( onLeft ? m : n );
+    if( mA <= gemm::EngineTraits<T>::NB )
+    {
+        SymmUnblocked
+        ( side, uplo, m, n, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+    std::vector<T> AFull;
+    ExpandHermitian( uplo, mA, A, ALDim, AFull, false );
+    if( onLeft )
+        Gemm
+        ( 'N', 'N', m, n, m,
+          alpha, AFull.data(), mA, B, BLDim, beta, C, CLDim );
+    else
+        Gemm
+        ( 'N', 'N', m, n, n,
+          alpha, B, BLDim, AFull.data(), mA, beta, C, CLDim );
+}
 template void Symm
 ( char side, char uplo, BlasInt m, BlasInt n,
   const Int& alpha,
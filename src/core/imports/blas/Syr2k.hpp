@@ -61,7 +61,7 @@ namespace El {
 namespace blas {
 
 template<typename T>
-void Her2k
+void Her2kUnblocked
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const T& alpha,
@@ -199,6 +199,63 @@ void Her2k
         }
     }
 }
+// Each block column of the triangle of C is split into its diagonal block,
+// which is updated by the unblocked kernel, and the remainder, which is
+// formed from two calls to the packed Gemm engine
+template<typename T>
+void Her2k
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt nb = gemm::EngineTraits<T>::NB;
+    if( n <= nb )
+    {
+        Her2kUnblocked
+        ( uplo, trans, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const T alphaBar = Conj(alpha);
+    const T betaT( beta );
+    for( BlasInt j=0; j<n; j+=nb )
+    {
+        const BlasInt jb = Min( nb, n-j );
+        const T* Aj = ( normal ? &A[j] : &A[j*ALDim] );
+        const T* Bj = ( normal ? &B[j] : &B[j*BLDim] );
+        Her2kUnblocked
+        ( uplo, trans, jb, k, alpha, Aj, ALDim, Bj, BLDim,
+          beta, &C[j+j*CLDim], CLDim );
+
+        // The rows of the block column outside of the diagonal block
+        const BlasInt iBeg = ( lower ? j+jb : 0 );
+        const BlasInt iEnd = ( lower ? n : j );
+        T* Cij = &C[iBeg+j*CLDim];
+        if( normal )
+        {
+            Gemm
+            ( 'N', 'C', iEnd-iBeg, jb, k,
+              alpha, &A[iBeg], ALDim, Bj, BLDim, betaT, Cij, CLDim );
+            Gemm
+            ( 'N', 'C', iEnd-iBeg, jb, k,
+              alphaBar, &B[iBeg], BLDim, Aj, ALDim, T(1), Cij, CLDim );
+        }
+        else
+        {
+            Gemm
+            ( 'C', 'N', iEnd-iBeg, jb, k,
+              alpha, &A[iBeg*ALDim], ALDim, Bj, BLDim, betaT, Cij, CLDim );
+            Gemm
+            ( 'C', 'N', iEnd-iBeg, jb, k,
+              alphaBar, &B[iBeg*BLDim], BLDim, Aj, ALDim, T(1), Cij, CLDim );
+        }
+    }
+}
 template void Her2k
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
@@ -345,7 +402,7 @@ void Her2k
 }
 
 template<typename T>
-void Syr2k
+void Syr2kUnblocked
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const T& alpha,
@@ -470,6 +527,61 @@ void Syr2k
         }
     }
 }
+// The same blocking as Her2k
+template<typename T>
+void Syr2k
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt nb = gemm::EngineTraits<T>::NB;
+    if( n <= nb )
+    {
+        Syr2kUnblocked
+        ( uplo, trans, n, k, alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const T& alphaBar = alpha;
+    const T& betaT = beta;
+    for( BlasInt j=0; j<n; j+=nb )
+    {
+        const BlasInt jb = Min( nb, n-j );
+        const T* Aj = ( normal ? &A[j] : &A[j*ALDim] );
+        const T* Bj = ( normal ? &B[j] : &B[j*BLDim] );
+        Syr2kUnblocked
+        ( uplo, trans, jb, k, alpha, Aj, ALDim, Bj, BLDim,
+          beta, &C[j+j*CLDim], CLDim );
+
+        // The rows of the block column outside of the diagonal block
+        const BlasInt iBeg = ( lower ? j+jb : 0 );
+        const BlasInt iEnd = ( lower ? n : j );
+        T* Cij = &C[iBeg+j*CLDim];
+        if( normal )
+        {
+            Gemm
+            ( 'N', 'T', iEnd-iBeg, jb, k,
+              alpha, &A[iBeg], ALDim, Bj, BLDim, betaT, Cij, CLDim );
+            Gemm
+            ( 'N', 'T', iEnd-iBeg, jb, k,
+              alphaBar, &B[iBeg], BLDim, Aj, ALDim, T(1), Cij, CLDim );
+        }
+        else
+        {
+            Gemm
+            ( 'T', 'N', iEnd-iBeg, jb, k,
+              alpha, &A[iBeg*ALDim], ALDim, Bj, BLDim, betaT, Cij, CLDim );
+            Gemm
+            ( 'T', 'N', iEnd-iBeg, jb, k,
+              alphaBar, &B[iBeg*BLDim], BLDim, Aj, ALDim, T(1), Cij, CLDim );
+        }
+    }
+}
 template void Syr2k
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
@@ -55,7 +55,7 @@ namespace El {
 namespace blas {
 
 template<typename T>
-void Herk
+void HerkUnblocked
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
   const Base<T>& alpha,
@@ -163,6 +163,62 @@ void Herk
         }
     }
 }
+// Each block column of the triangle of C is split into its diagonal block,
+// which is updated by the unblocked kernel, and the remainder, which is a
+// single call to the packed Gemm engine
+template<typename T>
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Base<T>& alpha,
+  const T* A, BlasInt ALDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt nb = gemm::EngineTraits<T>::NB;
+    if( n <= nb )
+    {
+        HerkUnblocked( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const T alphaT(alpha), betaT(beta);
+    for( BlasInt j=0; j<n; j+=nb )
+    {
+        const BlasInt jb = Min( nb, n-j );
+        const T* Aj = ( normal ? &A[j] : &A[j*ALDim] );
+        HerkUnblocked
+        ( uplo, trans, jb, k, alpha, Aj, ALDim, beta, &C[j+j*CLDim], CLDim );
+        if( lower )
+        {
+            const BlasInt i = j+jb;
+            if( normal )
+                Gemm
+                ( 'N', 'C', n-i, jb, k,
+                  alphaT, &A[i], ALDim, Aj, ALDim,
+                  betaT, &C[i+j*CLDim], CLDim );
+            else
+                Gemm
+                ( 'C', 'N', n-i, jb, k,
+                  alphaT, &A[i*ALDim], ALDim, Aj, ALDim,
+                  betaT, &C[i+j*CLDim], CLDim );
+        }
+        else
+        {
+            if( normal )
+                Gemm
+                ( 'N', 'C', j, jb, k,
+                  alphaT, A, ALDim, Aj, ALDim,
+                  betaT, &C[j*CLDim], CLDim );
+            else
+                Gemm
+                ( 'C', 'N', j, jb, k,
+                  alphaT, A, ALDim, Aj, ALDim,
+                  betaT, &C[j*CLDim], CLDim );
+        }
+    }
+}
 template void Herk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
@@ -291,7 +347,7 @@ void Herk
 }
 
 template<typename T>
-void Syrk
+void SyrkUnblocked
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
   const T& alpha,
@@ -399,6 +455,61 @@ void Syrk
         }
     }
 }
+// The same blocking as Herk
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt nb = gemm::EngineTraits<T>::NB;
+    if( n <= nb )
+    {
+        SyrkUnblocked( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const T& alphaT = alpha;
+    const T& betaT = beta;
+    for( BlasInt j=0; j<n; j+=nb )
+    {
+        const BlasInt jb = Min( nb, n-j );
+        const T* Aj = ( normal ? &A[j] : &A[j*ALDim] );
+        SyrkUnblocked
+        ( uplo, trans, jb, k, alpha, Aj, ALDim, beta, &C[j+j*CLDim], CLDim );
+        if( lower )
+        {
+            const BlasInt i = j+jb;
+            if( normal )
+                Gemm
+                ( 'N', 'T', n-i, jb, k,
+                  alphaT, &A[i], ALDim, Aj, ALDim,
+                  betaT, &C[i+j*CLDim], CLDim );
+            else
+                Gemm
+                ( 'T', 'N', n-i, jb, k,
+                  alphaT, &A[i*ALDim], ALDim, Aj, ALDim,
+                  betaT, &C[i+j*CLDim], CLDim );
+        }
+        else
+        {
+            if( normal )
+                Gemm
+                ( 'N', 'T', j, jb, k,
+                  alphaT, A, ALDim, Aj, ALDim,
+                  betaT, &C[j*CLDim], CLDim );
+            else
+                Gemm
+                ( 'T', 'N', j, jb, k,
+                  alphaT, A, ALDim, Aj, ALDim,
+                  betaT, &C[j*CLDim], CLDim );
+        }
+    }
+}
 template void Syrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
@@ -38,7 +38,7 @@ namespace El {
 namespace blas {
 
 template<typename T>
-void Trmm
+void TrmmUnblocked
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const T& alpha,
@@ -53,10 +53,6 @@ void Trmm
         for( BlasInt i=0; i<m; ++i )
             B[i+j*BLDim] *= alpha;
 
-    // TODO: Legitimate blocked implementations...it seems offensive to
-    //       repeatedly stream all of the triangular matrix through memory
-    //       for each row/column of B
-
     if( onLeft )
     {
         for( BlasInt j=0; j<n; ++j )
@@ -78,6 +74,76 @@ void Trmm
         }
     }
 }
+// Blocked triangular multiplication: each block of rows (or columns) of B
+// is multiplied by its diagonal block with the unblocked kernel and then
+// receives the contribution from the not-yet-overwritten portion of B
+// through the packed Gemm engine
+template<typename T>
+void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+        T* B, BlasInt BLDim )
+{
+    const BlasInt nb = gemm::EngineTraits<T>::NB;
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt mA = ( onLeft ? m : n );
+    if( mA <= nb )
+    {
+        TrmmUnblocked
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+
+    // Scale B
+    if( alpha != T(1) )
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+
+    // op(A) is lower triangular if and only if exactly one of 'lower' and
+    // 'normal' is false
+    const bool opLower = ( lower == normal );
+    const BlasInt numBlocks = (mA+nb-1) / nb;
+    for( BlasInt t=0; t<numBlocks; ++t )
+    {
+        // Overwrite each block before the blocks that it depends upon
+        const bool forward = ( onLeft ? !opLower : opLower );
+        const BlasInt blockIndex = ( forward ? t : numBlocks-1-t );
+        const BlasInt k = blockIndex*nb;
+        const BlasInt kb = Min( nb, mA-k );
+        const T* A11 = &A[k+k*ALDim];
+
+        // The indices whose original values contribute to this block
+        const BlasInt rBeg = ( forward ? k+kb : 0 );
+        const BlasInt rEnd = ( forward ? mA : k );
+        if( onLeft )
+        {
+            // B1 := op(A11) B1 + op(A12) B2
+            T* B1 = &B[k];
+            TrmmUnblocked
+            ( side, uplo, trans, unit, kb, n, T(1), A11, ALDim, B1, BLDim );
+            const T* A12 = ( normal ? &A[k+rBeg*ALDim] : &A[rBeg+k*ALDim] );
+            Gemm
+            ( trans, 'N', kb, n, rEnd-rBeg,
+              T(1), A12, ALDim, &B[rBeg], BLDim, T(1), B1, BLDim );
+        }
+        else
+        {
+            // B1 := B1 op(A11) + B2 op(A21)
+            T* B1 = &B[k*BLDim];
+            TrmmUnblocked
+            ( side, uplo, trans, unit, m, kb, T(1), A11, ALDim, B1, BLDim );
+            const T* A21 = ( normal ? &A[rBeg+k*ALDim] : &A[k+rBeg*ALDim] );
+            Gemm
+            ( 'N', trans, m, kb, rEnd-rBeg,
+              T(1), &B[rBeg*BLDim], BLDim, A21, ALDim, T(1), B1, BLDim );
+        }
+    }
+}
 template void Trmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
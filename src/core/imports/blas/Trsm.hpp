@@ -38,7 +38,7 @@ namespace El {
 namespace blas {
 
 template<typename F>
-void Trsm
+void TrsmUnblocked
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const F& alpha,
@@ -293,6 +293,76 @@ void Trsm
         }
     }
 }
+
+// Blocked triangular solves: each diagonal block is solved by the unblocked
+// kernel and the solution is then eliminated from the remaining rows (or
+// columns) of B with the packed Gemm engine
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const BlasInt nb = gemm::EngineTraits<F>::NB;
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt mA = ( onLeft ? m : n );
+    if( mA <= nb )
+    {
+        TrsmUnblocked
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+
+    // Scale B
+    if( alpha != F(1) )
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+
+    // op(A) is lower triangular if and only if exactly one of 'lower' and
+    // 'normal' is false
+    const bool opLower = ( lower == normal );
+    const BlasInt numBlocks = (mA+nb-1) / nb;
+    for( BlasInt t=0; t<numBlocks; ++t )
+    {
+        // Traverse the diagonal blocks in the order of the substitution
+        const bool forward = ( onLeft ? opLower : !opLower );
+        const BlasInt blockIndex = ( forward ? t : numBlocks-1-t );
+        const BlasInt k = blockIndex*nb;
+        const BlasInt kb = Min( nb, mA-k );
+        const F* A11 = &A[k+k*ALDim];
+
+        // The remaining indices which depend upon this block
+        const BlasInt rBeg = ( forward ? k+kb : 0 );
+        const BlasInt rEnd = ( forward ? mA : k );
+        if( onLeft )
+        {
+            // Solve op(A11) X1 = B1 and then B2 -= op(A21) X1
+            F* B1 = &B[k];
+            TrsmUnblocked
+            ( side, uplo, trans, unit, kb, n, F(1), A11, ALDim, B1, BLDim );
+            const F* A21 = ( normal ? &A[rBeg+k*ALDim] : &A[k+rBeg*ALDim] );
+            Gemm
+            ( trans, 'N', rEnd-rBeg, n, kb,
+              F(-1), A21, ALDim, B1, BLDim, F(1), &B[rBeg], BLDim );
+        }
+        else
+        {
+            // Solve X1 op(A11) = B1 and then B2 -= X1 op(A12)
+            F* B1 = &B[k*BLDim];
+            TrsmUnblocked
+            ( side, uplo, trans, unit, m, kb, F(1), A11, ALDim, B1, BLDim );
+            const F* A12 = ( normal ? &A[k+rBeg*ALDim] : &A[rBeg+k*ALDim] );
+            Gemm
+            ( 'N', trans, m, rEnd-rBeg, kb,
+              F(-1), B1, BLDim, A12, ALDim, F(1), &B[rBeg*BLDim], BLDim );
+        }
+    }
+}
 #ifdef EL_HAVE_QD
 template void Trsm
 ( char side, char uplo, char trans, char unit,
@@ -32,6 +32,41 @@ SafeMpi( int mpiError ) EL_NO_RELEASE_EXCEPT
     )
 }
 
+// Report one message of 'count' entries of type T to the profiler
+template<typename T>
+inline void CountMessage( const El::mpi::Comm& comm, int count )
+{
+    if( El::profile::Enabled() )
+        El::profile::CountComm( comm, size_t(count)*sizeof(T) );
+}
+
+// Report one message whose size is the sum of the per-process counts
+template<typename T>
+inline void CountMessage( const El::mpi::Comm& comm, const int* counts )
+{
+    if( El::profile::Enabled() )
+    {
+        int commSize;
+        MPI_Comm_size( comm.comm, &commSize );
+        size_t count = 0;
+        for( int q=0; q<commSize; ++q )
+            count += counts[q];
+        El::profile::CountComm( comm, count*sizeof(T) );
+    }
+}
+
+// Report one message of 'count' entries of type T per process
+template<typename T>
+inline void CountMessageToAll( const El::mpi::Comm& comm, int count )
+{
+    if( El::profile::Enabled() )
+    {
+        int commSize;
+        MPI_Comm_size( comm.comm, &commSize );
+        El::profile::CountComm( comm, size_t(count)*commSize*sizeof(T) );
+    }
+}
+
 template<typename T>
 MPI_Op NativeOp( const El::mpi::Op& op )
 {
@@ -129,6 +164,61 @@ void Free( Datatype& type ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Type_free( &type ) );
 }
 
+// Derived datatypes
+// =================
+void Commit( Datatype& type ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Type_commit( &type ) );
+}
+
+void CreateContiguous
+( int count, Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Type_contiguous( count, oldType, &newType ) );
+}
+
+void CreateVector
+( int count, int blockLength, int stride,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Type_vector( count, blockLength, stride, oldType, &newType ) );
+}
+
+void CreateIndexed
+( int count, const int* blockLengths, const int* displs,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Type_indexed
+      ( count, const_cast<int*>(blockLengths), const_cast<int*>(displs),
+        oldType, &newType ) );
+}
+
+void CreateHIndexed
+( int count, const int* blockLengths, const Aint* displs,
+  Datatype oldType, Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Type_create_hindexed
+      ( count, const_cast<int*>(blockLengths), const_cast<Aint*>(displs),
+        oldType, &newType ) );
+}
+
+void CreateResized
+( Datatype oldType, Aint lowerBound, Aint extent,
+  Datatype& newType ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Type_create_resized( oldType, lowerBound, extent, &newType ) );
+}
+
 // Communicator manipulation
 // =========================
 int Rank( Comm comm ) EL_NO_RELEASE_EXCEPT
@@ -176,9 +266,24 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL,
+        &nodeComm.comm ) );
+#else
+    // Without MPI-3, conservatively treat each process as its own node
+    SafeMpi( MPI_Comm_split( comm.comm, Rank(comm), key, &nodeComm.comm ) );
+#endif
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    profile::ForgetComm( comm );
     SafeMpi( MPI_Comm_free( &comm.comm ) );
 }
 
@@ -546,12 +651,97 @@ int GetCount( Status& status ) EL_NO_RELEASE_EXCEPT
     return count;
 }
 
+// Parallel I/O
+// ============
+void FileOpen
+( Comm comm, const std::string& filename, int mode, File& file )
+{
+    EL_DEBUG_CSE
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), mode, MPI_INFO_NULL,
+        &file.file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+}
+
+void FileClose( File& file ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_File_close( &file.file ) );
+}
+
+Offset FileGetSize( File file ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Offset size;
+    SafeMpi( MPI_File_get_size( file.file, &size ) );
+    return size;
+}
+
+void FileSetSize( File file, Offset size ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_File_set_size( file.file, size ) );
+}
+
+void FileSetView
+( File file, Offset disp, Datatype etype, Datatype fileType )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_File_set_view
+      ( file.file, disp, etype, fileType, const_cast<char*>("native"),
+        MPI_INFO_NULL ) );
+}
+
+void FileReadAtAll
+( File file, Offset offset, void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_File_read_at_all
+      ( file.file, offset, buf, count, type, MPI_STATUS_IGNORE ) );
+}
+
+void FileWriteAtAll
+( File file, Offset offset, const void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_File_write_at_all
+      ( file.file, offset, const_cast<void*>(buf), count, type,
+        MPI_STATUS_IGNORE ) );
+}
+
+void FileReadAll( File file, void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_File_read_all( file.file, buf, count, type, MPI_STATUS_IGNORE ) );
+}
+
+void FileWriteAll( File file, const void* buf, int count, Datatype type )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_File_write_all
+      ( file.file, const_cast<void*>(buf), count, type,
+        MPI_STATUS_IGNORE ) );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     SafeMpi
     ( MPI_Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
@@ -564,6 +754,7 @@ void TaggedSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -583,6 +774,7 @@ template<typename T,
 void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
@@ -609,6 +801,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     SafeMpi
     ( MPI_Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -622,6 +815,7 @@ void TaggedISend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Isend
@@ -643,6 +837,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Isend
@@ -674,6 +869,7 @@ void TaggedIRSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     SafeMpi
     ( MPI_Irsend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -687,6 +883,7 @@ void TaggedIRSend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Irsend
@@ -709,6 +906,7 @@ void TaggedIRSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Irsend
@@ -739,6 +937,7 @@ void TaggedISSend
   Request<Real>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     SafeMpi
     ( MPI_Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -752,6 +951,7 @@ void TaggedISSend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Issend
@@ -773,6 +973,7 @@ void TaggedISSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Issend
@@ -923,6 +1124,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, sc );
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -939,6 +1141,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, sc );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -964,6 +1167,7 @@ void TaggedSendRecv
         T* rbuf, int rc, int from, int rtag, Comm comm )
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, sc );
     Status status;
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
@@ -1004,6 +1208,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -1019,6 +1224,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1041,6 +1247,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Serialize( count, buf, packedBuf );
@@ -1063,6 +1270,7 @@ void Broadcast( Real* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     if( Size(comm) == 1 || count == 0 )
         return;
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
@@ -1074,6 +1282,7 @@ void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -1090,6 +1299,7 @@ void Broadcast( T* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     if( Size(comm) == 1 || count == 0 )
         return;
     std::vector<byte> packedBuf;
@@ -1110,6 +1320,7 @@ void IBroadcast
 ( Real* buf, int count, int root, Comm comm, Request<Real>& request )
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
     ( MPI_Ibcast
@@ -1126,6 +1337,7 @@ void IBroadcast
   Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1149,14 +1361,22 @@ void IBroadcast
 ( T* buf, int count, int root, Comm comm, Request<T>& request )
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
-    request.receivingPacked = true;
-    request.recvCount = count;
-    request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
+    if( mpi::Rank(comm) == root )
+    {
+        Serialize( count, buf, request.buffer );
+    }
+    else
+    {
+        request.receivingPacked = true;
+        request.recvCount = count;
+        request.unpackedRecvBuf = buf;
+        ReserveSerialized( count, buf, request.buffer );
+    }
     SafeMpi
     ( MPI_Ibcast
-      ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
+      ( request.buffer.data(), count, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1175,6 +1395,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, sc );
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1189,6 +1410,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, sc );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1213,6 +1435,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, sc );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalRecv = rc*commSize;
@@ -1239,6 +1462,7 @@ void IGather
   Request<Real>& request )
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, sc );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
     ( MPI_Igather
@@ -1259,6 +1483,7 @@ void IGather
   Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, sc );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1288,20 +1513,37 @@ void IGather
   Request<T>& request )
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, sc );
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
-    if( mpi::Rank(comm) == root )
+    const int commRank = mpi::Rank(comm);
+    if( commRank == root )
     {
+        // The root contributes its packed data in place
         const int commSize = mpi::Size(comm);
         request.receivingPacked = true;
         request.recvCount = rc*commSize;
         request.unpackedRecvBuf = rbuf;
         ReserveSerialized( rc*commSize, rbuf, request.buffer );
+        std::vector<byte> packedSend;
+        Serialize( sc, sbuf, packedSend );
+        MemCopy
+        ( &request.buffer[commRank*packedSend.size()], packedSend.data(),
+          packedSend.size() );
+        SafeMpi
+        ( MPI_Igather
+          ( MPI_IN_PLACE,          sc, TypeMap<T>(),
+            request.buffer.data(), rc, TypeMap<T>(), root, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        Serialize( sc, sbuf, request.buffer );
+        SafeMpi
+        ( MPI_Igather
+          ( request.buffer.data(), sc, TypeMap<T>(),
+            nullptr,               rc, TypeMap<T>(), root, comm.comm,
+            &request.backend ) );
     }
-    SafeMpi
-    ( MPI_Igather
-      ( request.buffer.data(), sc, TypeMap<Real>(),
-        rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
-        &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
 #endif
@@ -1316,6 +1558,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, sc );
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf),
@@ -1338,6 +1581,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, sc );
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1382,6 +1626,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, sc );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     int totalRecv=0;
@@ -1416,6 +1661,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, sc );
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1440,6 +1686,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, sc );
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1474,6 +1721,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, sc );
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -1488,6 +1736,87 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    CountMessage<Real>( comm, sc );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, sc );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    CountMessage<T>( comm, sc );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // Each process contributes its packed data in place
+    const int commRank = mpi::Rank(comm);
+    const int commSize = mpi::Size(comm);
+    request.receivingPacked = true;
+    request.recvCount = rc*commSize;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc*commSize, rbuf, request.buffer );
+    std::vector<byte> packedSend;
+    Serialize( sc, sbuf, packedSend );
+    MemCopy
+    ( &request.buffer[commRank*packedSend.size()], packedSend.data(),
+      packedSend.size() );
+    SafeMpi
+    ( MPI_Iallgather
+      ( MPI_IN_PLACE,          sc, TypeMap<T>(),
+        request.buffer.data(), rc, TypeMap<T>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllGather
@@ -1496,6 +1825,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, sc );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1533,6 +1863,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, sc );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1585,6 +1916,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, sc );
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
 
@@ -1613,6 +1945,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, sc );
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1627,6 +1960,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, sc );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1651,6 +1985,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, sc );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1673,6 +2008,7 @@ void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, sc );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1696,6 +2032,7 @@ void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, sc );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1734,6 +2071,7 @@ void Scatter( T* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, sc );
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1760,6 +2098,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessageToAll<Real>( comm, sc );
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1774,6 +2113,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessageToAll<Complex<Real>>( comm, sc );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1800,6 +2140,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessageToAll<T>( comm, sc );
     const int commSize = mpi::Size( comm );
     const int totalSend = sc*commSize;
     const int totalRecv = rc*commSize;
@@ -1814,6 +2155,88 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    CountMessageToAll<Real>( comm, sc );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( MPI_Ialltoall
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+    CountMessageToAll<Complex<Real>>( comm, sc );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Ialltoall
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( MPI_Ialltoall
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    CountMessageToAll<T>( comm, sc );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // The packed receive data precedes the packed send data so that Wait
+    // can unpack from the front of the request buffer
+    const int commSize = mpi::Size( comm );
+    std::vector<byte> packedSend;
+    Serialize( sc*commSize, sbuf, packedSend );
+    request.receivingPacked = true;
+    request.recvCount = rc*commSize;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc*commSize, rbuf, request.buffer );
+    const size_t recvSize = request.buffer.size();
+    request.buffer.resize( recvSize+packedSend.size() );
+    MemCopy
+    ( &request.buffer[recvSize], packedSend.data(), packedSend.size() );
+    SafeMpi
+    ( MPI_Ialltoall
+      ( &request.buffer[recvSize], sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllToAll
@@ -1822,6 +2245,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, scs );
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf),
@@ -1843,6 +2267,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, scs );
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1884,6 +2309,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, scs );
     const int commSize = mpi::Size( comm );
     const int totalSend = scs[commSize-1]+sds[commSize-1];
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
@@ -1928,6 +2354,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     if( count == 0 )
         return;
 
@@ -1946,6 +2373,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
     if( count == 0 )
         return;
 
@@ -1984,6 +2412,7 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     if( count == 0 )
         return;
 
@@ -2032,6 +2461,7 @@ void Reduce( Real* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2057,6 +2487,7 @@ void Reduce( Complex<Real>* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
     if( Size(comm) == 1 )
         return;
     if( count != 0 )
@@ -2119,6 +2550,7 @@ void Reduce( T* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     if( count == 0 )
         return;
 
@@ -2151,6 +2583,7 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2168,6 +2601,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2205,6 +2639,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     if( count == 0 )
         return;
 
@@ -2241,6 +2676,7 @@ void AllReduce( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2256,6 +2692,7 @@ void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2291,6 +2728,7 @@ void AllReduce( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     if( count == 0 )
         return;
 
@@ -2311,12 +2749,113 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( count == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( count == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( MPI_Iallreduce
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*count, TypeMap<Real>(),
+            opC, comm.comm, &request.backend ) );
+        return;
+    }
+#endif
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, count,
+        TypeMap<Complex<Real>>(), opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( count == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    // The packed result precedes the packed input (see IAllToAll)
+    MPI_Op opC = NativeOp<T>( op );
+    std::vector<byte> packedSend;
+    Serialize( count, sbuf, packedSend );
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( count, rbuf, request.buffer );
+    const size_t recvSize = request.buffer.size();
+    request.buffer.resize( recvSize+packedSend.size() );
+    MemCopy
+    ( &request.buffer[recvSize], packedSend.data(), packedSend.size() );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( &request.buffer[recvSize], request.buffer.data(), count,
+        TypeMap<T>(), opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( sbuf, rbuf, count, SUM, comm, request ); }
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessageToAll<Real>( comm, rc );
     if( rc == 0 )
         return;
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
@@ -2343,6 +2882,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessageToAll<Complex<Real>>( comm, rc );
     if( rc == 0 )
         return;
 
@@ -2377,6 +2917,7 @@ void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessageToAll<T>( comm, rc );
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2424,6 +2965,7 @@ void ReduceScatter( Real* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessageToAll<Real>( comm, rc );
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2451,6 +2993,7 @@ void ReduceScatter( Complex<Real>* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessageToAll<Complex<Real>>( comm, rc );
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2486,6 +3029,7 @@ void ReduceScatter( T* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessageToAll<T>( comm, rc );
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2524,6 +3068,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, rcs );
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
     ( MPI_Reduce_scatter
@@ -2539,6 +3084,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, rcs );
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -2580,6 +3126,7 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, rcs );
     const int commRank = mpi::Rank(comm);
     const int commSize = mpi::Size(comm);
     int totalSend=0;
@@ -2603,6 +3150,104 @@ void ReduceScatter( const T* sbuf, T* rbuf, const int* rcs, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { ReduceScatter( sbuf, rbuf, rcs, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Op op, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    CountMessageToAll<Real>( comm, rc );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( rc == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Real*>(sbuf), rbuf, rc, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+    CountMessageToAll<Complex<Real>>( comm, rc );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( rc == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+#ifdef EL_AVOID_COMPLEX_MPI
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*rc, TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, rc, TypeMap<Complex<Real>>(),
+        opC, comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    CountMessageToAll<T>( comm, rc );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( rc == 0 )
+    {
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    // The packed result precedes the packed input (see IAllToAll)
+    const int commSize = mpi::Size( comm );
+    MPI_Op opC = NativeOp<T>( op );
+    std::vector<byte> packedSend;
+    Serialize( rc*commSize, sbuf, packedSend );
+    request.receivingPacked = true;
+    request.recvCount = rc;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc, rbuf, request.buffer );
+    const size_t recvSize = request.buffer.size();
+    request.buffer.resize( recvSize+packedSend.size() );
+    MemCopy
+    ( &request.buffer[recvSize], packedSend.data(), packedSend.size() );
+    SafeMpi
+    ( MPI_Ireduce_scatter_block
+      ( &request.buffer[recvSize], request.buffer.data(), rc, TypeMap<T>(),
+        opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request )
+{ IReduceScatter( sbuf, rbuf, rc, SUM, comm, request ); }
+
 void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm )
@@ -2626,6 +3271,7 @@ void Scan( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2644,6 +3290,7 @@ void Scan
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2680,6 +3327,7 @@ void Scan( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     if( count == 0 )
         return;
 
@@ -2723,6 +3371,7 @@ void Scan( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Real>( comm, count );
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2738,6 +3387,7 @@ void Scan( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<Complex<Real>>( comm, count );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2773,6 +3423,7 @@ void Scan( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    CountMessage<T>( comm, count );
     if( count == 0 )
         return;
 
@@ -2792,6 +3443,131 @@ void Scan( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { Scan( buf, count, SUM, comm ); }
 
+template<typename T>
+void Start( Request<T>& request )
+{
+    EL_DEBUG_CSE
+    if( request.restart )
+        request.restart( request );
+    else
+        SafeMpi( MPI_Start( &request.backend ) );
+}
+
+template<typename T>
+void StartAll( int numRequests, Request<T>* requests )
+{
+    EL_DEBUG_CSE
+    for( Int j=0; j<numRequests; ++j )
+        Start( requests[j] );
+}
+
+template<typename T>
+void Free( Request<T>& request )
+{
+    EL_DEBUG_CSE
+    if( request.restart )
+        request.restart = nullptr;
+    else if( request.backend != MPI_REQUEST_NULL )
+        SafeMpi( MPI_Request_free( &request.backend ) );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void SendInit
+( const Real* buf, int count, int to, Comm comm, Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Send_init
+      ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 0, comm.comm,
+        &request.backend ) );
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void SendInit
+( const T* buf, int count, int to, Comm comm, Request<T>& request )
+{
+    EL_DEBUG_CSE
+    request.restart = [=]( Request<T>& req )
+      { ISend( buf, count, to, comm, req ); };
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void RecvInit
+( Real* buf, int count, int from, Comm comm, Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Recv_init
+      ( buf, count, TypeMap<Real>(), from, ANY_TAG, comm.comm,
+        &request.backend ) );
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void RecvInit
+( T* buf, int count, int from, Comm comm, Request<T>& request )
+{
+    EL_DEBUG_CSE
+    request.restart = [=]( Request<T>& req )
+      { IRecv( buf, count, from, comm, req ); };
+}
+
+template<typename T>
+void BroadcastInit
+( T* buf, int count, int root, Comm comm, Request<T>& request )
+{
+    EL_DEBUG_CSE
+    request.restart = [=]( Request<T>& req )
+      { IBroadcast( buf, count, root, comm, req ); };
+}
+
+template<typename T>
+void AllGatherInit
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    request.restart = [=]( Request<T>& req )
+      { IAllGather( sbuf, sc, rbuf, rc, comm, req ); };
+}
+
+template<typename T>
+void AllToAllInit
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    request.restart = [=]( Request<T>& req )
+      { IAllToAll( sbuf, sc, rbuf, rc, comm, req ); };
+}
+
+template<typename T>
+void AllReduceInit
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    request.restart = [=]( Request<T>& req )
+      { IAllReduce( sbuf, rbuf, count, op, comm, req ); };
+}
+
+template<typename T>
+void ReduceScatterInit
+( const T* sbuf, T* rbuf, int rc, Op op, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    request.restart = [=]( Request<T>& req )
+      { IReduceScatter( sbuf, rbuf, rc, op, comm, req ); };
+}
+
 template<typename T>
 void SparseAllToAll
 ( const vector<T>& sendBuffer,
@@ -2926,6 +3702,31 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, int sc, \
           T* rbuf, int rc, \
     int root, Comm comm, Request<T>& request ); \
+  template void IAllReduce<T> \
+  ( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request ); \
+  template void IReduceScatter<T> \
+  ( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request ); \
+  template void Start( Request<T>& request ); \
+  template void StartAll( int numRequests, Request<T>* requests ); \
+  template void Free( Request<T>& request ); \
+  template void SendInit<T> \
+  ( const T* buf, int count, int to, Comm comm, Request<T>& request ); \
+  template void RecvInit<T> \
+  ( T* buf, int count, int from, Comm comm, Request<T>& request ); \
+  template void BroadcastInit \
+  ( T* buf, int count, int root, Comm comm, Request<T>& request ); \
+  template void AllGatherInit \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
+  template void AllToAllInit \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
+  template void AllReduceInit \
+  ( const T* sbuf, T* rbuf, int count, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void ReduceScatterInit \
+  ( const T* sbuf, T* rbuf, int rc, Op op, Comm comm, \
+    Request<T>& request ); \
   template vector<T> AllToAll<T> \
   ( const vector<T>& sendBuf, \
     const vector<int>& sendCounts, \
@@ -3022,7 +3823,19 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, T* rbuf, int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce<S>( T* buf, int count, Op op, Comm comm ) \
-  EL_NO_RELEASE_EXCEPT;
+  EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather<S> \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
+  template void IAllToAll<S> \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
+  template void IAllReduce<S> \
+  ( const T* sbuf, T* rbuf, int count, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void IReduceScatter<S> \
+  ( const T* sbuf, T* rbuf, int rc, Op op, Comm comm, \
+    Request<T>& request );
 
 #define MPI_PROTO_REAL(T) \
   MPI_PROTO_BASE(T) \
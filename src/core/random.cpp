@@ -12,11 +12,17 @@ namespace {
 
 // A common Mersenne twister configuration
 std::mt19937 generator;
+long generatorSeed = 0;
 
 #ifdef EL_HAVE_MPC
 gmp_randstate_t gmpRandState;
 #endif
 
+// The (rank-independent) seed of the counter-based streams and the index of
+// the next stream
+unsigned long long streamSeed = 21;
+std::uint32_t streamIndex = 0;
+
 }
 
 namespace El {
@@ -24,10 +30,15 @@ namespace El {
 void InitializeRandom( bool deterministic )
 {
     const unsigned rank = mpi::Rank( mpi::COMM_WORLD );
-    const long secs = ( deterministic ? 21 : time(NULL) );
+    long secs = ( deterministic ? 21 : time(NULL) );
+    if( !deterministic )
+        mpi::Broadcast( secs, 0, mpi::COMM_WORLD );
     const long seed = (secs<<16) | (rank & 0xFFFF);
 
+    SetRandomStreamSeed( secs );
+
     ::generator.seed( seed );
+    ::generatorSeed = seed;
 
     srand( seed );
 
@@ -47,7 +58,39 @@ void FinalizeRandom()
 }
 
 std::mt19937& Generator()
-{ return ::generator; }
+{
+#ifdef EL_HYBRID
+    // Threads other than the master draw from their own generators so that
+    // threaded drivers (e.g., shift-parallel pseudospectra) do not race
+    const int thread = omp_get_thread_num();
+    if( thread != 0 )
+    {
+        static thread_local std::mt19937 threadGenerator;
+        static thread_local bool seeded = false;
+        if( !seeded )
+        {
+            threadGenerator.seed( ::generatorSeed + 7919*thread );
+            seeded = true;
+        }
+        return threadGenerator;
+    }
+#endif
+    return ::generator;
+}
+
+void SetRandomStreamSeed( unsigned long long seed )
+{
+    ::streamSeed = seed;
+    ::streamIndex = 0;
+}
+
+RandomKey NewRandomStream()
+{
+    RandomKey key;
+    key.word[0] = std::uint32_t(::streamSeed);
+    key.word[1] = std::uint32_t(::streamSeed >> 32) ^ ::streamIndex++;
+    return key;
+}
 
 #ifdef EL_HAVE_MPC
 namespace mpfr {
@@ -0,0 +1,127 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_DISTIO_HPP
+#define EL_IO_DISTIO_HPP
+
+namespace El {
+namespace dist_io {
+
+// Collective MPI-IO transfers between a distributed matrix and a column-major
+// image of the full matrix stored at a given byte offset within a file.
+//
+// Each process describes the file locations of its local entries with a
+// derived datatype: the global rows it owns are coalesced into contiguous
+// runs (a single run for [*,X] distributions, a run per block for block
+// distributions), and the resulting column pattern is repeated at the
+// offset of each owned global column. The MPI-IO layer can then aggregate
+// the requests of all processes into large contiguous accesses rather than
+// funneling the data through a single process.
+
+// The entries are moved as opaque bytes so that the file layout is identical
+// to that of the sequential reader and writer.
+template<typename T>
+inline mpi::Datatype EntryType()
+{
+    mpi::Datatype entryType;
+    mpi::CreateContiguous( sizeof(T), mpi::TypeMap<byte>(), entryType );
+    mpi::Commit( entryType );
+    return entryType;
+}
+
+template<typename T>
+inline mpi::Datatype FileType
+( const AbstractDistMatrix<T>& A, mpi::Datatype entryType )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+
+    vector<int> runLengths, runOffsets;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( !runLengths.empty() && runOffsets.back()+runLengths.back() == i )
+            ++runLengths.back();
+        else
+        {
+            runLengths.push_back( 1 );
+            runOffsets.push_back( i );
+        }
+    }
+    mpi::Datatype colType, paddedColType;
+    mpi::CreateIndexed
+    ( runLengths.size(), runLengths.data(), runOffsets.data(),
+      entryType, colType );
+    mpi::CreateResized( colType, 0, height*sizeof(T), paddedColType );
+    mpi::Free( colType );
+
+    vector<int> colLengths( localWidth, 1 );
+    vector<mpi::Aint> colOffsets( localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        colOffsets[jLoc] = mpi::Aint(A.GlobalCol(jLoc))*height*sizeof(T);
+    mpi::Datatype fileType;
+    mpi::CreateHIndexed
+    ( localWidth, colLengths.data(), colOffsets.data(),
+      paddedColType, fileType );
+    mpi::Free( paddedColType );
+    mpi::Commit( fileType );
+    return fileType;
+}
+
+// Describes the (possibly padded) local buffer of A
+template<typename T>
+inline mpi::Datatype MemoryType
+( const AbstractDistMatrix<T>& A, mpi::Datatype entryType )
+{
+    mpi::Datatype memType;
+    mpi::CreateVector
+    ( A.LocalWidth(), A.LocalHeight(), A.LDim(), entryType, memType );
+    mpi::Commit( memType );
+    return memType;
+}
+
+template<typename T>
+inline void Read
+( AbstractDistMatrix<T>& A, mpi::File& file, mpi::Offset disp )
+{
+    EL_DEBUG_CSE
+    mpi::Datatype entryType = EntryType<T>();
+    mpi::Datatype fileType = FileType( A, entryType );
+    mpi::Datatype memType = MemoryType( A, entryType );
+    mpi::FileSetView( file, disp, entryType, fileType );
+    const int count = ( A.LocalHeight()*A.LocalWidth() > 0 ? 1 : 0 );
+    mpi::FileReadAll( file, A.Buffer(), count, memType );
+    mpi::Free( memType );
+    mpi::Free( fileType );
+    mpi::Free( entryType );
+}
+
+// Only the first member of each team of redundant processes writes its data
+template<typename T>
+inline void Write
+( const AbstractDistMatrix<T>& A, mpi::File& file, mpi::Offset disp )
+{
+    EL_DEBUG_CSE
+    mpi::Datatype entryType = EntryType<T>();
+    mpi::Datatype fileType = FileType( A, entryType );
+    mpi::Datatype memType = MemoryType( A, entryType );
+    mpi::FileSetView( file, disp, entryType, fileType );
+    const bool writing = A.RedundantRank() == 0 &&
+                         A.LocalHeight()*A.LocalWidth() > 0;
+    mpi::FileWriteAll( file, A.LockedBuffer(), writing ? 1 : 0, memType );
+    mpi::Free( memType );
+    mpi::Free( fileType );
+    mpi::Free( entryType );
+}
+
+} // namespace dist_io
+} // namespace El
+
+#endif // ifndef EL_IO_DISTIO_HPP
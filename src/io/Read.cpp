@@ -56,10 +56,20 @@ void Read
 
     if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
-        if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
+        if( A.CrossRank() == A.Root() )
         {
-            Read( A.Matrix(), filename, format );
-            A.Resize( A.Matrix().Height(), A.Matrix().Width() );
+            // A redundantly-stored matrix (e.g., [STAR,STAR]) is read by a
+            // single process and then broadcast to the rest of its team
+            Int dims[2];
+            if( A.RedundantRank() == 0 )
+            {
+                Read( A.Matrix(), filename, format );
+                dims[0] = A.Matrix().Height();
+                dims[1] = A.Matrix().Width();
+            }
+            mpi::Broadcast( dims, 2, 0, A.RedundantComm() );
+            A.Resize( dims[0], dims[1] );
+            Broadcast( A, A.RedundantComm(), 0 );
         }
         A.MakeSizeConsistent();
     }
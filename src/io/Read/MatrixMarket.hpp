@@ -403,6 +403,157 @@ void MatrixMarket( SparseMatrix<T>& A, const string filename )
     }
 }
 
+namespace mm {
+
+inline void SkipBlanks( const char*& pos )
+{
+    while( *pos == ' ' || *pos == '\t' || *pos == '\r' )
+        ++pos;
+}
+
+inline void SkipLine( const char*& pos )
+{
+    while( *pos != '\n' && *pos != '\0' )
+        ++pos;
+    if( *pos == '\n' )
+        ++pos;
+}
+
+// The following parsers operate in place on null-terminated text without
+// allocating. Each stops at the first character which cannot continue the
+// number and fails, rather than moving on to the next line, if the current
+// line has no more fields.
+inline bool ParseIndex( const char*& pos, Int& value )
+{
+    SkipBlanks( pos );
+    if( *pos < '0' || *pos > '9' )
+        return false;
+    Int v = 0;
+    do
+    {
+        v = 10*v + (*pos-'0');
+        ++pos;
+    } while( *pos >= '0' && *pos <= '9' );
+    value = v;
+    return true;
+}
+
+inline bool ParseReal( const char*& pos, double& value )
+{
+    SkipBlanks( pos );
+    if( *pos == '\n' || *pos == '\0' )
+        return false;
+    char* next;
+    value = std::strtod( pos, &next );
+    if( next == pos )
+        return false;
+    pos = next;
+    return true;
+}
+
+inline bool ParseReal( const char*& pos, float& value )
+{
+    SkipBlanks( pos );
+    if( *pos == '\n' || *pos == '\0' )
+        return false;
+    char* next;
+    value = std::strtof( pos, &next );
+    if( next == pos )
+        return false;
+    pos = next;
+    return true;
+}
+
+// The remaining (e.g., extended-precision) types fall back to their stream
+// extraction operators
+template<typename Real>
+bool ParseReal( const char*& pos, Real& value )
+{
+    SkipBlanks( pos );
+    const char* end = pos;
+    while( *end != '\0' && !std::isspace(*end) )
+        ++end;
+    if( end == pos )
+        return false;
+    std::istringstream stream( string(pos,end) );
+    if( !(stream >> value) )
+        return false;
+    pos = end;
+    return true;
+}
+
+// Return the beginning of the first line of 'text' which starts at or after
+// position 'pos'
+inline Int LineStart( const vector<char>& text, Int pos )
+{
+    const Int size = text.size();
+    if( pos == 0 || pos >= size )
+        return Min( pos, size );
+    while( pos < size && text[pos-1] != '\n' )
+        ++pos;
+    return pos;
+}
+
+// Read the lines of 'file' which begin within the byte range [begin,end),
+// including the remainder of the last such line, into 'text' and append a
+// null terminator. The data of the file lies within [dataBegin,dataEnd),
+// which begins on a line. Thus, if the ranges of the processes partition the
+// data, each line is read by exactly one process.
+inline void ReadLines
+( std::ifstream& file,
+  std::streamoff dataBegin,
+  std::streamoff dataEnd,
+  std::streamoff begin,
+  std::streamoff end,
+  vector<char>& text )
+{
+    EL_DEBUG_CSE
+    text.clear();
+    if( begin < end )
+    {
+        // Include the preceding byte so that we can tell whether the range
+        // starts on a line
+        const std::streamoff readBegin =
+          ( begin > dataBegin ? begin-1 : begin );
+        text.resize( end-readBegin );
+        file.seekg( readBegin );
+        if( !file.read( text.data(), text.size() ) )
+            RuntimeError("Could not read bytes ",readBegin," to ",end);
+        if( begin > dataBegin )
+        {
+            auto it = std::find( text.begin(), text.end(), '\n' );
+            if( it == text.end() )
+                text.clear();
+            else
+                text.erase( text.begin(), it+1 );
+        }
+
+        // Complete the last line
+        std::streamoff pos = end;
+        const Int blockSize = 4096;
+        while( !text.empty() && text.back() != '\n' && pos < dataEnd )
+        {
+            const Int oldSize = text.size();
+            const Int numRead = Min( Int(dataEnd-pos), blockSize );
+            text.resize( oldSize+numRead );
+            if( !file.read( &text[oldSize], numRead ) )
+                RuntimeError("Could not read bytes ",pos," to ",pos+numRead);
+            pos += numRead;
+            auto it = std::find( text.begin()+oldSize, text.end(), '\n' );
+            if( it != text.end() )
+                text.erase( it+1, text.end() );
+        }
+    }
+    if( !text.empty() && text.back() != '\n' )
+        text.push_back( '\n' );
+    text.push_back( '\0' );
+}
+
+} // namespace mm
+
+// Each process reads and parses (with all of its threads) only the lines
+// beginning within an even share of the bytes of the file's data and then
+// routes the entries to the owners of their rows with a single AllToAll.
 template<typename T>
 void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
 {
@@ -476,13 +627,14 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
     while( file.peek() == '%' )
         std::getline( file, line );
 
-    int m, n;
+    Int m, n;
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract the size line");
+    const std::streamoff dataBegin = file.tellg();
 
     // Read in the matrix dimensions and number of nonzeros
     // ====================================================
-    int numNonzero;
+    Int numNonzero;
     if( isMatrix )
     {
         std::stringstream lineStream( line );
@@ -507,59 +659,121 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
     // ========================
     Zeros( A, m, n );
 
-    // Fill in the local nonzero entries by passively calling QueueUpdate
-    // ==================================================================
-    int i, j;
-    Real realPart, imagPart;
-    T value;
-    const int commSize = A.Grid().Size();
-    A.Reserve( numNonzero/commSize ); // Assume an even nonzero distribution
-    bool passive = true;
-    for( Int k=0; k<numNonzero; ++k )
+    // Read the lines beginning in this process's share of the data
+    // ============================================================
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commRank = grid.Rank();
+    const int commSize = grid.Size();
+    file.seekg( 0, std::ios::end );
+    const std::streamoff dataEnd = file.tellg();
+    const std::streamoff dataSize = dataEnd - dataBegin;
+    vector<char> text;
+    mm::ReadLines
+    ( file, dataBegin, dataEnd,
+      dataBegin + (dataSize*commRank)/commSize,
+      dataBegin + (dataSize*(commRank+1))/commSize, text );
+    file.close();
+
+    // Parse the lines with each thread handling a contiguous block of them
+    // =====================================================================
+#ifdef EL_HYBRID
+    const Int numThreads = omp_get_max_threads();
+#else
+    const Int numThreads = 1;
+#endif
+    const Int textSize = text.size()-1;
+    vector<vector<Entry<T>>> threadEntries(numThreads);
+    vector<string> threadErrors(numThreads);
+    EL_PARALLEL_FOR
+    for( Int t=0; t<numThreads; ++t )
     {
-        if( !std::getline( file, line ) )
-            RuntimeError("Could not get nonzero ",k);
-        std::stringstream lineStream( line );
-        if( !(lineStream >> i) )
-            RuntimeError("Could not extract row coordinate of nonzero ",k);
-        --i; // convert from Fortran to C indexing
-        if( isMatrix )
-        {
-            if( !(lineStream >> j) )
-                RuntimeError
-                ("Could not extract col coordinate of nonzero ",k);
-            --j;
-        }
-        else
-            j = 0;
-
-        if( isPattern )
-        {
-            A.QueueUpdate( i, j, T(1), passive );
-        }
-        else
+        const Int textBegin = mm::LineStart( text, (textSize*t)/numThreads );
+        const Int textEnd = mm::LineStart( text, (textSize*(t+1))/numThreads );
+        const char* pos = &text[textBegin];
+        const char* end = &text[textEnd];
+        auto& entries = threadEntries[t];
+        entries.reserve( (end-pos)/16 );
+        Int i, j=1;
+        Real realPart, imagPart;
+        T value;
+        while( pos < end )
         {
-            if( isComplex )
+            mm::SkipBlanks( pos );
+            if( *pos == '\n' || *pos == '%' )
             {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                if( !(lineStream >> imagPart) )
-                    RuntimeError
-                    ("Could not extract imag part of entry (",i,",",j,")");
+                mm::SkipLine( pos );
+                continue;
+            }
+            const char* lineBegin = pos;
+            bool valid = mm::ParseIndex( pos, i ) && i >= 1 && i <= m;
+            if( isMatrix )
+                valid = valid && mm::ParseIndex( pos, j ) && j >= 1 && j <= n;
+            if( isPattern )
+            {
+                value = T(1);
+            }
+            else if( isComplex )
+            {
+                valid = valid && mm::ParseReal( pos, realPart ) &&
+                                 mm::ParseReal( pos, imagPart );
                 SetRealPart( value, realPart );
                 SetImagPart( value, imagPart );
-                A.QueueUpdate( i, j, value, passive );
             }
             else
             {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real entry (",i,",",j,")");
-                A.QueueUpdate( i, j, T(realPart), passive );
+                valid = valid && mm::ParseReal( pos, realPart );
+                value = T(realPart);
+            }
+            if( !valid )
+            {
+                const char* lineEnd = lineBegin;
+                while( *lineEnd != '\n' && *lineEnd != '\0' )
+                    ++lineEnd;
+                threadErrors[t] = string(lineBegin,lineEnd);
+                break;
             }
+            // Convert from Fortran to C indexing
+            entries.push_back( Entry<T>{ i-1, j-1, value } );
+            mm::SkipLine( pos );
         }
     }
+    SwapClear( text );
+    Int numLocalNonzero = 0;
+    for( Int t=0; t<numThreads; ++t )
+    {
+        if( !threadErrors[t].empty() )
+            RuntimeError("Invalid nonzero: ",threadErrors[t]);
+        numLocalNonzero += threadEntries[t].size();
+    }
+    const Int numReadNonzero = mpi::AllReduce( numLocalNonzero, comm );
+    if( numReadNonzero != numNonzero )
+        RuntimeError
+        ("Expected ",numNonzero," nonzeros but read ",numReadNonzero);
+
+    // Send each entry to the owner of its row
+    // =======================================
+    vector<int> sendCounts(commSize,0);
+    for( const auto& entries : threadEntries )
+        for( const auto& entry : entries )
+            ++sendCounts[A.RowOwner(entry.i)];
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Entry<T>> sendBuf(totalSend);
+    for( auto& entries : threadEntries )
+    {
+        for( const auto& entry : entries )
+            sendBuf[offs[A.RowOwner(entry.i)]++] = entry;
+        SwapClear( entries );
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    SwapClear( sendBuf );
+
+    const Int firstLocalRow = A.FirstLocalRow();
+    A.Reserve( recvBuf.size() );
+    for( const auto& entry : recvBuf )
+        A.QueueLocalUpdate( entry.i-firstLocalRow, entry.j, entry.value );
     A.ProcessLocalQueues();
 
     if( isSymmetric )
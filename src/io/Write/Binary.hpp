@@ -9,6 +9,8 @@
 #ifndef EL_WRITE_BINARY_HPP
 #define EL_WRITE_BINARY_HPP
 
+#include "../DistIO.hpp"
+
 namespace El {
 namespace write {
 
@@ -35,6 +37,28 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::File file;
+    mpi::FileOpen
+    ( A.Grid().ViewingComm(), filename, mpi::MODE_WRONLY|mpi::MODE_CREATE,
+      file );
+
+    const Int metaBytes = 2*sizeof(Int);
+    const Int dataBytes = A.Height()*A.Width()*sizeof(T);
+    mpi::FileSetSize( file, metaBytes+dataBytes );
+    const Int dims[2] = { A.Height(), A.Width() };
+    const bool writingMeta = A.Grid().ViewingRank() == 0;
+    mpi::FileWriteAtAll
+    ( file, 0, dims, writingMeta ? metaBytes : 0, mpi::TypeMap<byte>() );
+    dist_io::Write( A, file, metaBytes );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
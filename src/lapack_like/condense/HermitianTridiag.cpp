@@ -47,6 +47,7 @@ void Ger2Sub
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 namespace El {
 
@@ -218,7 +219,22 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
-          AbstractDistMatrix<F>& B );
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    Matrix<Base<F>>& d, \
+    Matrix<F>& dSub, \
+    herm_tridiag::TwoStageQ<F>& Q, \
+    Int bandwidth ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    Matrix<Base<F>>& d, \
+    Matrix<F>& dSub, \
+    Int bandwidth ); \
+  template void herm_tridiag::ApplyQ \
+  ( const herm_tridiag::TwoStageQ<F>& Q, Matrix<F>& B );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+namespace two_stage {
+
+// Reduce the (explicitly Hermitian) matrix A to a band of the given width
+// with one block reflector, I - V T V^H, per panel of columns. The panel
+// factorization is unblocked, but the two-sided update of the trailing
+// matrix, which contains the vast majority of the work, is cast as Gemm's.
+template<typename F>
+void ReduceToBand( Matrix<F>& A, Int bandwidth, TwoStageQ<F>* Q )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    Matrix<F> V, T, householderScalars, W, Y, Z, S;
+    for( Int j=0; j+b<n-1; j+=b )
+    {
+        const Int p0 = j+b;
+        const Int h = n-p0;
+        const Int nb = Min(b,h);
+        const IR panelInd( j, j+b ), ind2( p0, END );
+
+        Zeros( V, h, nb );
+        householderScalars.Resize( nb, 1 );
+        for( Int i=0; i<nb; ++i )
+        {
+            const Int col = j+i;
+            const Int r = p0+i;
+            auto alpha11 = A( IR(r), IR(col) );
+            auto a21 = A( IR(r+1,END), IR(col) );
+            const F tau = LeftReflector( alpha11, a21 );
+            householderScalars(i) = tau;
+
+            auto v = V( IR(i,END), IR(i) );
+            v(0) = F(1);
+            auto vB = V( IR(i+1,END), IR(i) );
+            vB = a21;
+            Zero( a21 );
+
+            // Apply H = I - tau v v^H to the rest of the panel
+            auto APan = A( IR(r,END), IR(col+1,j+b) );
+            Gemm( ADJOINT, NORMAL, F(1), v, APan, S );
+            Gemm( NORMAL, NORMAL, -tau, v, S, F(1), APan );
+        }
+        // Keep both triangles explicit for the second stage
+        auto A21 = A( ind2, panelInd );
+        auto A12 = A( panelInd, ind2 );
+        Adjoint( A21, A12 );
+
+        // Form the upper-triangular T such that
+        //   I - V T V^H = adjoint(H_0) adjoint(H_1) ... adjoint(H_{nb-1})
+        Zeros( T, nb, nb );
+        for( Int i=0; i<nb; ++i )
+        {
+            const F tauConj = Conj(householderScalars(i));
+            T(i,i) = tauConj;
+            if( i == 0 )
+                continue;
+            auto V0 = V( ALL, IR(0,i) );
+            auto v1 = V( ALL, IR(i) );
+            auto t01 = T( IR(0,i), IR(i) );
+            Gemv( ADJOINT, F(1), V0, v1, F(0), t01 );
+            Trmv( UPPER, NORMAL, NON_UNIT, T(IR(0,i),IR(0,i)), t01 );
+            t01 *= -tauConj;
+        }
+
+        // With Q = I - V T V^H, A22 := Q^H A22 Q is formed as
+        //   A22 := A22 - (V Y^H + Y V^H),
+        // where W = A22 V T and Y = W - V (T^H V^H W) / 2
+        auto A22 = A( ind2, ind2 );
+        Gemm( NORMAL, NORMAL, F(1), A22, V, Z );
+        Gemm( NORMAL, NORMAL, F(1), Z, T, W );
+        Gemm( ADJOINT, NORMAL, F(1), V, W, S );
+        Gemm( ADJOINT, NORMAL, F(1), T, S, Z );
+        Y = W;
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, Z, F(1), Y );
+        Gemm( NORMAL, ADJOINT, F(-1), V, Y, F(1), A22 );
+        Gemm( NORMAL, ADJOINT, F(-1), Y, V, F(1), A22 );
+
+        if( Q != nullptr )
+        {
+            Q->panelOffsets.push_back( p0 );
+            Q->panelReflectors.push_back( V );
+            Q->panelFactors.push_back( T );
+        }
+    }
+}
+
+// Chase the band of width 'bandwidth' down to tridiagonal form. Sweep j
+// annihilates column j below its subdiagonal, and each subsequent reflector
+// annihilates the first column of the bulge introduced by its predecessor,
+// so each sweep costs O(n b) and the stage costs O(n^2 b).
+template<typename F>
+void ChaseBand( Matrix<F>& A, Int bandwidth, TwoStageQ<F>* Q )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = bandwidth;
+    Matrix<F> u, w;
+    for( Int j=0; j<n-2; ++j )
+    {
+        Int c = j;
+        Int r0 = j+1;
+        Int r1 = Min(j+b,n-1);
+        while( r1 > r0 )
+        {
+            const Int length = r1-r0+1;
+            const IR reflInd( r0, r1+1 );
+            auto alpha = A( IR(r0), IR(c) );
+            auto x = A( IR(r0+1,r1+1), IR(c) );
+            const F tau = LeftReflector( alpha, x );
+            u.Resize( length, 1 );
+            u(0) = F(1);
+            for( Int k=1; k<length; ++k )
+                u(k) = x(k-1);
+            Zero( x );
+            A(c,r0) = Conj(A(r0,c));
+            for( Int k=r0+1; k<=r1; ++k )
+                A(c,k) = F(0);
+
+            // A := H A H^H over the window touched by the band
+            const Int cEnd = Min(r1+b,n-1);
+            const IR windowInd( c+1, cEnd+1 );
+            auto ARows = A( reflInd, windowInd );
+            Gemv( ADJOINT, F(1), ARows, u, w );
+            Ger( -tau, u, w, ARows );
+            auto ACols = A( windowInd, reflInd );
+            Gemv( NORMAL, F(1), ACols, u, w );
+            Ger( -Conj(tau), w, u, ACols );
+
+            if( Q != nullptr )
+            {
+                Q->chaseOffsets.push_back( r0 );
+                Q->chaseScalars.push_back( tau );
+                const Int offset = Q->chaseReflectors.size();
+                Q->chaseReflectors.resize( offset+b, F(0) );
+                for( Int k=0; k<length; ++k )
+                    Q->chaseReflectors[offset+k] = u(k);
+            }
+
+            c = r0;
+            r0 += b;
+            r1 = Min(r1+b,n-1);
+        }
+    }
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& d,
+  Matrix<F>& dSub,
+  Int bandwidth,
+  TwoStageQ<F>* Q )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( bandwidth < 1 )
+        LogicError("The bandwidth must be positive");
+    const Int n = A.Height();
+    const Int b = Max( Min(bandwidth,n-1), Int(1) );
+    if( Q != nullptr )
+    {
+        *Q = TwoStageQ<F>();
+        Q->bandwidth = b;
+    }
+    MakeHermitian( uplo, A );
+    ReduceToBand( A, b, Q );
+    ChaseBand( A, b, Q );
+    d = GetRealPartOfDiagonal( A );
+    dSub = GetDiagonal( A, -1 );
+}
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& d,
+  Matrix<F>& dSub,
+  TwoStageQ<F>& Q,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::TwoStage( uplo, A, d, dSub, bandwidth, &Q );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& d,
+  Matrix<F>& dSub,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::TwoStage<F>( uplo, A, d, dSub, bandwidth, nullptr );
+}
+
+template<typename F>
+void ApplyQ( const TwoStageQ<F>& Q, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = B.Height();
+    const Int b = Q.bandwidth;
+    Matrix<F> w, S, R;
+
+    // B := (adjoint(H_0) ... adjoint(H_{K-1})) B for the chasing reflectors
+    for( Int k=Q.chaseOffsets.size()-1; k>=0; --k )
+    {
+        const Int r0 = Q.chaseOffsets[k];
+        const Int length = Min(b,n-r0);
+        const Matrix<F> u( length, 1, &Q.chaseReflectors[k*b], b );
+        auto BRows = B( IR(r0,r0+length), ALL );
+        Gemv( ADJOINT, F(1), BRows, u, w );
+        Ger( -Conj(Q.chaseScalars[k]), u, w, BRows );
+    }
+
+    // B := (I - V T V^H) B for each panel of the banded reduction
+    for( Int k=Q.panelOffsets.size()-1; k>=0; --k )
+    {
+        const auto& V = Q.panelReflectors[k];
+        const auto& T = Q.panelFactors[k];
+        auto BB = B( IR(Q.panelOffsets[k],END), ALL );
+        Gemm( ADJOINT, NORMAL, F(1), V, BB, S );
+        Gemm( NORMAL, NORMAL, F(1), T, S, R );
+        Gemm( NORMAL, NORMAL, F(-1), V, R, F(1), BB );
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -109,6 +109,19 @@ void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
     }
 }
 
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.scalapack || !ctrl.lookahead )
+        Cholesky( uplo, A, ctrl.scalapack );
+    else if( uplo == LOWER )
+        cholesky::LowerVariant3Lookahead( A );
+    else
+        cholesky::UpperVariant3Lookahead( A );
+}
+
 template<typename F> 
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p )
@@ -207,6 +220,8 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void Cholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
@@ -23,7 +23,7 @@ void LowerVariant2Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -64,7 +64,7 @@ void LowerVariant2Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,MC,  STAR> X21_MC_STAR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky",A.Grid());
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -49,7 +49,7 @@ void LowerVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -87,7 +87,7 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky",A.Grid());
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -125,6 +125,115 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// A pipelined version of LowerVariant3Blocked. Once the columns of the next
+// panel have received the current update, that panel is factored and the
+// gathers of its [MC,STAR] and [MR,STAR] forms are started, so that they
+// proceed while the rest of the trailing matrix is updated.
+template<typename F>
+void LowerVariant3Lookahead( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(grid);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(grid);
+    // The gathered panels alternate between two sets of buffers
+    DistMatrix<F,MC,  STAR> A21_MC_STAR0(grid), A21_MC_STAR1(grid);
+    DistMatrix<F,MR,  STAR> A21_MR_STAR0(grid), A21_MR_STAR1(grid);
+    DistMatrix<F,MC,  STAR>* A21Bufs_MC_STAR[2] =
+      { &A21_MC_STAR0, &A21_MC_STAR1 };
+    DistMatrix<F,MR,  STAR>* A21Bufs_MR_STAR[2] =
+      { &A21_MR_STAR0, &A21_MR_STAR1 };
+    copy::PendingCopy<F> pendingMC, pendingMR;
+
+    const Int n = A.Height();
+    const Int bsize = TunedBlocksize<F>("Cholesky",A.Grid());
+
+    // Factor the (fully updated) panel beginning at index k and start the
+    // gathers of its subdiagonal block
+    auto factorPanel = [&]( Int k, Int buf )
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind1( k,    k+nb ),
+                           ind2( k+nb, n    );
+          auto A11 = A( ind1, ind1 );
+          auto A21 = A( ind2, ind1 );
+          auto A22 = A( ind2, ind2 );
+
+          A11_STAR_STAR = A11;
+          Cholesky( LOWER, A11_STAR_STAR );
+          A11 = A11_STAR_STAR;
+
+          A21_VC_STAR.AlignWith( A22 );
+          A21_VC_STAR = A21;
+          LocalTrsm
+          ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+            F(1), A11_STAR_STAR, A21_VC_STAR );
+          A21_VR_STAR.AlignWith( A22 );
+          A21_VR_STAR = A21_VC_STAR;
+
+          A21Bufs_MC_STAR[buf]->AlignWith( A22 );
+          A21Bufs_MR_STAR[buf]->AlignWith( A22 );
+          copy::PartialColAllGather
+          ( A21_VC_STAR, *A21Bufs_MC_STAR[buf], pendingMC );
+          copy::PartialColAllGather
+          ( A21_VR_STAR, *A21Bufs_MR_STAR[buf], pendingMR );
+      };
+
+    if( n > 0 )
+        factorPanel( 0, 0 );
+    for( Int k=0, buf=0; k<n; k+=bsize, buf=1-buf )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-k-nb);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        pendingMC.Finish();
+        pendingMR.Finish();
+        auto& A21_MC_STAR = *A21Bufs_MC_STAR[buf];
+        auto& A21_MR_STAR = *A21Bufs_MR_STAR[buf];
+
+        const Range<Int> indNext( 0, nbNext ), indRest( nbNext, END );
+        auto A21Next_MC_STAR = A21_MC_STAR( indNext, ALL );
+        auto A21Rest_MC_STAR = A21_MC_STAR( indRest, ALL );
+        auto A21Next_MR_STAR = A21_MR_STAR( indNext, ALL );
+        auto A21Rest_MR_STAR = A21_MR_STAR( indRest, ALL );
+        if( nbNext > 0 )
+        {
+            // Update the next panel and then factor it
+            auto A22NextNext = A22( indNext, indNext );
+            auto A22RestNext = A22( indRest, indNext );
+            LocalTrrk
+            ( LOWER, ADJOINT,
+              F(-1), A21Next_MC_STAR, A21Next_MR_STAR, F(1), A22NextNext );
+            LocalGemm
+            ( NORMAL, ADJOINT,
+              F(-1), A21Rest_MC_STAR, A21Next_MR_STAR, F(1), A22RestNext );
+            factorPanel( k+nb, 1-buf );
+        }
+
+        // The bulk of the update overlaps with the gathers of the next panel
+        auto A22RestRest = A22( indRest, indRest );
+        LocalTrrk
+        ( LOWER, ADJOINT,
+          F(-1), A21Rest_MC_STAR, A21Rest_MR_STAR, F(1), A22RestRest );
+
+        A21 = A21_MC_STAR;
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
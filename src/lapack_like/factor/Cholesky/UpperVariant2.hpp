@@ -25,7 +25,7 @@ void UpperVariant2Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -69,7 +69,7 @@ void UpperVariant2Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F> X11(grid), X12(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky",A.Grid());
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
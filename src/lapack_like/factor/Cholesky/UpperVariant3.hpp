@@ -54,7 +54,7 @@ void UpperVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -91,7 +91,7 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A12_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("Cholesky",A.Grid());
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -122,6 +122,112 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// A pipelined version of UpperVariant3Blocked; see LowerVariant3Lookahead
+template<typename F>
+void UpperVariant3Lookahead( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(grid);
+    DistMatrix<F,STAR,VC  > A12_STAR_VC(grid);
+    // The gathered panels alternate between two sets of buffers
+    DistMatrix<F,STAR,MC  > A12_STAR_MC0(grid), A12_STAR_MC1(grid);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR0(grid), A12_STAR_MR1(grid);
+    DistMatrix<F,STAR,MC  >* A12Bufs_STAR_MC[2] =
+      { &A12_STAR_MC0, &A12_STAR_MC1 };
+    DistMatrix<F,STAR,MR  >* A12Bufs_STAR_MR[2] =
+      { &A12_STAR_MR0, &A12_STAR_MR1 };
+    copy::PendingCopy<F> pendingMC, pendingMR;
+
+    const Int n = A.Height();
+    const Int bsize = TunedBlocksize<F>("Cholesky",A.Grid());
+
+    // Factor the (fully updated) panel beginning at index k and start the
+    // gathers of its superdiagonal block
+    auto factorPanel = [&]( Int k, Int buf )
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind1( k,    k+nb ),
+                           ind2( k+nb, n    );
+          auto A11 = A( ind1, ind1 );
+          auto A12 = A( ind1, ind2 );
+          auto A22 = A( ind2, ind2 );
+
+          A11_STAR_STAR = A11;
+          Cholesky( UPPER, A11_STAR_STAR );
+          A11 = A11_STAR_STAR;
+
+          A12_STAR_VR.AlignWith( A22 );
+          A12_STAR_VR = A12;
+          LocalTrsm
+          ( LEFT, UPPER, ADJOINT, NON_UNIT,
+            F(1), A11_STAR_STAR, A12_STAR_VR );
+          A12_STAR_VC.AlignWith( A22 );
+          A12_STAR_VC = A12_STAR_VR;
+
+          A12Bufs_STAR_MC[buf]->AlignWith( A22 );
+          A12Bufs_STAR_MR[buf]->AlignWith( A22 );
+          copy::PartialRowAllGather
+          ( A12_STAR_VC, *A12Bufs_STAR_MC[buf], pendingMC );
+          copy::PartialRowAllGather
+          ( A12_STAR_VR, *A12Bufs_STAR_MR[buf], pendingMR );
+      };
+
+    if( n > 0 )
+        factorPanel( 0, 0 );
+    for( Int k=0, buf=0; k<n; k+=bsize, buf=1-buf )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-k-nb);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        pendingMC.Finish();
+        pendingMR.Finish();
+        auto& A12_STAR_MC = *A12Bufs_STAR_MC[buf];
+        auto& A12_STAR_MR = *A12Bufs_STAR_MR[buf];
+
+        const Range<Int> indNext( 0, nbNext ), indRest( nbNext, END );
+        auto A12Next_STAR_MC = A12_STAR_MC( ALL, indNext );
+        auto A12Rest_STAR_MC = A12_STAR_MC( ALL, indRest );
+        auto A12Next_STAR_MR = A12_STAR_MR( ALL, indNext );
+        auto A12Rest_STAR_MR = A12_STAR_MR( ALL, indRest );
+        if( nbNext > 0 )
+        {
+            // Update the next panel and then factor it
+            auto A22NextNext = A22( indNext, indNext );
+            auto A22NextRest = A22( indNext, indRest );
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12Next_STAR_MC, A12Next_STAR_MR, F(1), A22NextNext );
+            LocalGemm
+            ( ADJOINT, NORMAL,
+              F(-1), A12Next_STAR_MC, A12Rest_STAR_MR, F(1), A22NextRest );
+            factorPanel( k+nb, 1-buf );
+        }
+
+        // The bulk of the update overlaps with the gathers of the next panel
+        auto A22RestRest = A22( indRest, indRest );
+        LocalTrrk
+        ( UPPER, ADJOINT,
+          F(-1), A12Rest_STAR_MC, A12Rest_STAR_MR, F(1), A22RestRest );
+
+        A12 = A12_STAR_MR;
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
@@ -668,12 +668,14 @@ double Front<Field>::FactorGFlops() const
         double realFrontFlops=0;
         if( front.sparseLeaf )
         {
-            if( Unfactored(front.type) )
-                LogicError("Matrix has not yet been factored");
-
-            // Count the flops from the sparse factorization
-            const Int* offsetBuf = front.LSparse.LockedOffsetBuffer();
-            for( Int j=0; j<n; ++j )
+            // Count the flops from the sparse factorization. Before the
+            // leaf is factored, the entries of the original matrix stand in
+            // for those of L (ignoring fill-in).
+            const auto& LSparse =
+              ( Unfactored(front.type) ? front.workSparse : front.LSparse );
+            const Int* offsetBuf = LSparse.LockedOffsetBuffer();
+            const Int numSources = LSparse.Height();
+            for( Int j=0; j<numSources; ++j )
             {
                 const Int nnz = offsetBuf[j+1]-offsetBuf[j];
                 realFrontFlops += nnz*(nnz+2.);
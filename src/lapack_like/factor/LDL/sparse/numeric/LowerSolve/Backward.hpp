@@ -21,12 +21,16 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_BACKWARD_HPP
 
 #include "./FrontBackward.hpp"
+#include "../Schedule.hpp"
 
 namespace El {
 namespace ldl {
 
-template<typename F> 
-inline void LowerBackwardSolve
+namespace backward_solve {
+
+// Solve against this front and then set up the workspaces of its children
+template<typename F>
+inline void SolveFront
 ( const NodeInfo& info, 
   const Front<F>& front,
         MatrixNode<F>& X, bool conjugate )
@@ -77,12 +81,68 @@ inline void LowerBackwardSolve
         dupMV->work.Empty();
     else if( haveDupMatParent )
         dupMat->work.Empty();
+}
 
+template<typename F>
+inline void Sequential
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X, bool conjugate )
+{
+    EL_DEBUG_CSE
+    SolveFront( info, front, X, conjugate );
+    const Int numChildren = front.children.size();
     for( Int c=0; c<numChildren; ++c )
-        LowerBackwardSolve
+        Sequential
         ( *info.children[c], *front.children[c], *X.children[c], conjugate );
 }
 
+// A handle to a node of the elimination tree, its front, and its right-hand
+// sides
+template<typename F>
+struct SolveNode
+{
+    const NodeInfo* info;
+    const Front<F>* front;
+    MatrixNode<F>* X;
+
+    Int NumChildren() const { return info->children.size(); }
+    SolveNode<F> Child( Int c ) const
+    { return SolveNode<F>{ info->children[c].get(), front->children[c].get(),
+                           X->children[c].get() }; }
+};
+
+} // namespace backward_solve
+
+template<typename F> 
+inline void LowerBackwardSolve
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X, bool conjugate )
+{
+    EL_DEBUG_CSE
+    typedef backward_solve::SolveNode<F> Node;
+    const Int numRHS = X.matrix.Width();
+    auto subtreeGFlops =
+      [&]( const Node& node ) { return node.front->SolveGFlops( numRHS ); };
+    auto processSubtree =
+      [&]( const Node& node )
+      {
+          backward_solve::Sequential
+          ( *node.info, *node.front, *node.X, conjugate );
+      };
+    auto processFront =
+      [&]( const Node& node )
+      {
+          backward_solve::SolveFront
+          ( *node.info, *node.front, *node.X, conjugate );
+      };
+    const bool topDown = true;
+    ScheduledTraversal
+    ( Node{ &info, &front, &X }, subtreeGFlops, processSubtree, processFront,
+      topDown );
+}
+
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
@@ -21,23 +21,21 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_FORWARD_HPP
 
 #include "./FrontForward.hpp"
+#include "../Schedule.hpp"
 
 namespace El {
 namespace ldl {
 
-template<typename F> 
-void LowerForwardSolve
-( const NodeInfo& info, 
+namespace forward_solve {
+
+template<typename F>
+void SolveFront
+( const NodeInfo& info,
   const Front<F>& front,
         MatrixNode<F>& X )
 {
     EL_DEBUG_CSE
 
-    const Int numChildren = info.children.size();
-    for( Int c=0; c<numChildren; ++c )
-        LowerForwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
-
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
     //       (or a duplicate's parent)
@@ -50,6 +48,7 @@ void LowerForwardSolve
     Zero( WB );
 
     // Update using the children (if they exist)
+    const Int numChildren = info.children.size();
     for( Int c=0; c<numChildren; ++c )
     {
         auto& childW = X.children[c]->work;
@@ -74,6 +73,59 @@ void LowerForwardSolve
     X.matrix = WT;
 }
 
+template<typename F>
+void Sequential
+( const NodeInfo& info,
+  const Front<F>& front,
+        MatrixNode<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        Sequential( *info.children[c], *front.children[c], *X.children[c] );
+    SolveFront( info, front, X );
+}
+
+// A handle to a node of the elimination tree, its front, and its right-hand
+// sides
+template<typename F>
+struct SolveNode
+{
+    const NodeInfo* info;
+    const Front<F>* front;
+    MatrixNode<F>* X;
+
+    Int NumChildren() const { return info->children.size(); }
+    SolveNode<F> Child( Int c ) const
+    { return SolveNode<F>{ info->children[c].get(), front->children[c].get(),
+                           X->children[c].get() }; }
+};
+
+} // namespace forward_solve
+
+template<typename F> 
+void LowerForwardSolve
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X )
+{
+    EL_DEBUG_CSE
+    typedef forward_solve::SolveNode<F> Node;
+    const Int numRHS = X.matrix.Width();
+    auto subtreeGFlops =
+      [&]( const Node& node ) { return node.front->SolveGFlops( numRHS ); };
+    auto processSubtree =
+      []( const Node& node )
+      { forward_solve::Sequential( *node.info, *node.front, *node.X ); };
+    auto processFront =
+      []( const Node& node )
+      { forward_solve::SolveFront( *node.info, *node.front, *node.X ); };
+    const bool topDown = false;
+    ScheduledTraversal
+    ( Node{ &info, &front, &X }, subtreeGFlops, processSubtree, processFront,
+      topDown );
+}
+
 template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
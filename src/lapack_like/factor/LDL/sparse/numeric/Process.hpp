@@ -24,12 +24,118 @@
 #define EL_LDL_PROCESS_HPP
 
 #include "./ProcessFront.hpp"
+#include "./Schedule.hpp"
 
 namespace El {
 namespace ldl {
 
+namespace process {
+
 template<typename Field>
-void Process
+void FactorSparseLeaf
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+{
+    EL_DEBUG_CSE
+    front.type = factorType;
+    const Int m = front.LDense.Height();
+    const Int n = front.LDense.Width();
+    const Int numEntries = info.LOffsets.back();
+    const Int numSources = info.LOffsets.size()-1;
+
+    // TODO(poulson): Add support for pivoting here
+    if( PivotedFactorization(factorType) )
+        Zeros( front.subdiag, Max(n-1,0), 1 );
+
+    Zeros( front.LSparse, numSources, numSources );
+    front.LSparse.ForceNumEntries( numEntries );
+    Field* LValBuf = front.LSparse.ValueBuffer();
+    Int* LRowBuf = front.LSparse.SourceBuffer();
+    Int* LColBuf = front.LSparse.TargetBuffer();
+    Int* LOffsetBuf = front.LSparse.OffsetBuffer();
+
+    for( Int i=0; i<numSources; ++i )
+    {
+        const Int iStart = info.LOffsets[i];
+        const Int iEnd = info.LOffsets[i+1];
+        LOffsetBuf[i] = iStart;
+        for( Int e=iStart; e<iEnd; ++e )
+            LRowBuf[e] = i;
+    }
+    LOffsetBuf[numSources] = info.LOffsets[numSources];
+    front.diag.Resize( numSources, 1 );
+
+    // Factor the transpose of L
+    // TODO(poulson): Reuse these workspaces
+    vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
+    vector<Field> y(numSources);
+    suite_sparse::ldl::Numeric
+    ( numSources,
+      front.workSparse.LockedOffsetBuffer(),
+      front.workSparse.LockedTargetBuffer(),
+      front.workSparse.LockedValueBuffer(),
+      LOffsetBuf,
+      info.LParents.data(),
+      LNnz.data(),
+      LColBuf,
+      LValBuf,
+      front.diag.Buffer(),
+      y.data(),
+      pattern.data(),
+      flag.data(),
+      static_cast<const Int*>(nullptr),
+      static_cast<const Int*>(nullptr),
+      front.isHermitian );
+    front.LSparse.ForceConsistency();
+
+    // Solve against L_{TL}^T from the right
+    bool onLeft = false;
+    suite_sparse::ldl::LTSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
+
+    // Save a copy of ABL
+    auto ABLCopy = front.LDense;
+
+    // Solve against the diagonal
+    suite_sparse::ldl::DSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      front.diag.Buffer() );
+
+    // Form the Schur complement
+    Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
+    Trrk
+    ( LOWER, NORMAL, orientation,
+      Field(-1), front.LDense, ABLCopy, Field(0), front.workDense );
+}
+
+// Add the update matrix of child 'c' into the front and then free it
+template<typename Field>
+void ExtendAdd( const NodeInfo& info, Front<Field>& front, Int c )
+{
+    EL_DEBUG_CSE
+    auto& FL = front.LDense;
+    auto& FBR = front.workDense;
+    auto& childU = front.children[c]->workDense;
+    const int childUSize = childU.Height();
+    for( int jChild=0; jChild<childUSize; ++jChild )
+    {
+        const int j = info.childRelInds[c][jChild];
+        for( int iChild=jChild; iChild<childUSize; ++iChild )
+        {
+            const int i = info.childRelInds[c][iChild];
+            const Field value = childU(iChild,jChild);
+            if( j < info.size )
+                FL(i,j) += value;
+            else
+                FBR(i-info.size,j-info.size) += value;
+        }
+    }
+    childU.Empty();
+}
+
+// Factor a front whose children have already been factored
+template<typename Field>
+void FactorFront
 ( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
 {
     EL_DEBUG_CSE
@@ -40,112 +146,73 @@ void Process
 
     if( front.sparseLeaf )
     {
-        front.type = factorType;
-        const Int m = front.LDense.Height();
-        const Int n = front.LDense.Width();
-        const Int numEntries = info.LOffsets.back();
-        const Int numSources = info.LOffsets.size()-1;
-
-        // TODO(poulson): Add support for pivoting here
-        if( PivotedFactorization(factorType) )
-            Zeros( front.subdiag, Max(n-1,0), 1 );
-
-        Zeros( front.LSparse, numSources, numSources );
-        front.LSparse.ForceNumEntries( numEntries );
-        Field* LValBuf = front.LSparse.ValueBuffer();
-        Int* LRowBuf = front.LSparse.SourceBuffer();
-        Int* LColBuf = front.LSparse.TargetBuffer();
-        Int* LOffsetBuf = front.LSparse.OffsetBuffer();
-
-        for( Int i=0; i<numSources; ++i )
-        {
-            const Int iStart = info.LOffsets[i];
-            const Int iEnd = info.LOffsets[i+1];
-            LOffsetBuf[i] = iStart;
-            for( Int e=iStart; e<iEnd; ++e )
-                LRowBuf[e] = i;
-        }
-        LOffsetBuf[numSources] = info.LOffsets[numSources];
-        front.diag.Resize( numSources, 1 );
-
-        // Factor the transpose of L
-        // TODO(poulson): Reuse these workspaces
-        vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
-        vector<Field> y(numSources);
-        suite_sparse::ldl::Numeric
-        ( numSources,
-          front.workSparse.LockedOffsetBuffer(),
-          front.workSparse.LockedTargetBuffer(),
-          front.workSparse.LockedValueBuffer(),
-          LOffsetBuf,
-          info.LParents.data(),
-          LNnz.data(),
-          LColBuf,
-          LValBuf,
-          front.diag.Buffer(),
-          y.data(),
-          pattern.data(),
-          flag.data(),
-          static_cast<const Int*>(nullptr),
-          static_cast<const Int*>(nullptr),
-          front.isHermitian );
-        front.LSparse.ForceConsistency();
-
-        // Solve against L_{TL}^T from the right
-        bool onLeft = false;
-        suite_sparse::ldl::LTSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
-
-        // Save a copy of ABL
-        auto ABLCopy = front.LDense;
-
-        // Solve against the diagonal
-        suite_sparse::ldl::DSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          front.diag.Buffer() );
-
-        // Form the Schur complement
-        Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
-        Trrk
-        ( LOWER, NORMAL, orientation,
-          Field(-1), front.LDense, ABLCopy, Field(0), front.workDense );
+        FactorSparseLeaf( info, front, factorType );
     }
     else
     {
-        auto& FL = front.LDense;
         EL_DEBUG_ONLY(
+          const auto& FL = front.LDense;
           if( FL.Height() != info.size+updateSize || FL.Width() != info.size )
               LogicError("Front was not the proper size");
         )
 
-        // Process children and add in their updates
+        // Add in the child updates
         const int numChildren = info.children.size();
         for( Int c=0; c<numChildren; ++c )
-        {
-            Process( *info.children[c], *front.children[c], factorType );
-
-            auto& childU = front.children[c]->workDense;
-            const int childUSize = childU.Height();
-            for( int jChild=0; jChild<childUSize; ++jChild )
-            {
-                const int j = info.childRelInds[c][jChild];
-                for( int iChild=jChild; iChild<childUSize; ++iChild )
-                {
-                    const int i = info.childRelInds[c][iChild];
-                    const Field value = childU(iChild,jChild);
-                    if( j < info.size )
-                        FL(i,j) += value;
-                    else
-                        FBR(i-info.size,j-info.size) += value;
-                }
-            }
-            childU.Empty();
-        }
+            ExtendAdd( info, front, c );
         ProcessFront( front, factorType );
     }
 }
 
+template<typename Field>
+void Sequential
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+{
+    EL_DEBUG_CSE
+    if( !front.sparseLeaf )
+    {
+        const int numChildren = info.children.size();
+        for( Int c=0; c<numChildren; ++c )
+            Sequential( *info.children[c], *front.children[c], factorType );
+    }
+    FactorFront( info, front, factorType );
+}
+
+// A handle to a node of the elimination tree and its front
+template<typename Field>
+struct FactorNode
+{
+    const NodeInfo* info;
+    Front<Field>* front;
+
+    Int NumChildren() const { return info->children.size(); }
+    FactorNode<Field> Child( Int c ) const
+    { return FactorNode<Field>{ info->children[c].get(),
+                                front->children[c].get() }; }
+};
+
+} // namespace process
+
+template<typename Field>
+void Process
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+{
+    EL_DEBUG_CSE
+    typedef process::FactorNode<Field> Node;
+    auto subtreeGFlops =
+      []( const Node& node ) { return node.front->FactorGFlops(); };
+    auto processSubtree =
+      [&]( const Node& node )
+      { process::Sequential( *node.info, *node.front, factorType ); };
+    auto processFront =
+      [&]( const Node& node )
+      { process::FactorFront( *node.info, *node.front, factorType ); };
+    const bool topDown = false;
+    ScheduledTraversal
+    ( Node{ &info, &front }, subtreeGFlops, processSubtree, processFront,
+      topDown );
+}
+
 template<typename Field>
 void Process
 ( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType )
@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_NUMERIC_SCHEDULE_HPP
+#define EL_LDL_NUMERIC_SCHEDULE_HPP
+
+#include <exception>
+
+namespace El {
+namespace ldl {
+
+// Since distinct subtrees of the elimination tree are independent, the
+// sequential portion of the multifrontal factorization (and of the triangular
+// solves) can process them concurrently. The tree is cut so that each subtree
+// below the cutoff performs at most 1/(ldlTasksPerThread*numThreads) of the
+// total work; these subtrees are processed in parallel, from the most to the
+// least expensive, while the few fronts above the cutoff are processed by the
+// calling thread outside of the parallel region, where their (large) dense
+// kernels are free to use a threaded BLAS.
+
+// The number of subtrees per thread that the cutoff aims to expose
+const double ldlTasksPerThread = 8;
+
+// A 'Node' is a lightweight handle to the corresponding nodes of the
+// elimination tree, the fronts, and any workspace trees which are traversed
+// in lockstep. It must provide NumChildren() and Child(c).
+template<class Node,class CostFunctor>
+void SplitAtCutoff
+( const Node& node,
+  const CostFunctor& subtreeGFlops,
+  double cutoff,
+  vector<std::pair<double,Node>>& subtrees,
+  vector<Node>& topFronts )
+{
+    const double gflops = subtreeGFlops( node );
+    const Int numChildren = node.NumChildren();
+    if( gflops <= cutoff || numChildren == 0 )
+    {
+        subtrees.emplace_back( gflops, node );
+        return;
+    }
+    for( Int c=0; c<numChildren; ++c )
+        SplitAtCutoff( node.Child(c), subtreeGFlops, cutoff, subtrees,
+          topFronts );
+    topFronts.push_back( node );
+}
+
+// Process the tree rooted at 'root', where 'processSubtree' handles an entire
+// subtree and 'processFront' handles a single front whose children have
+// already been handled (or, if 'topDown', whose parent has). The top fronts
+// are visited in postorder, or in reverse postorder if 'topDown'.
+template<class Node,class CostFunctor,class SubtreeFunctor,class FrontFunctor>
+void ScheduledTraversal
+( const Node& root,
+  const CostFunctor& subtreeGFlops,
+  const SubtreeFunctor& processSubtree,
+  const FrontFunctor& processFront,
+  bool topDown )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const int numThreads = omp_get_max_threads();
+    if( numThreads > 1 && !omp_in_parallel() )
+    {
+        const double cutoff =
+          subtreeGFlops(root) / (ldlTasksPerThread*numThreads);
+        vector<std::pair<double,Node>> subtrees;
+        vector<Node> topFronts;
+        SplitAtCutoff( root, subtreeGFlops, cutoff, subtrees, topFronts );
+        std::stable_sort
+        ( subtrees.begin(), subtrees.end(),
+          []( const std::pair<double,Node>& a,
+              const std::pair<double,Node>& b )
+          { return a.first > b.first; } );
+
+        if( topDown )
+            for( auto it=topFronts.rbegin(); it!=topFronts.rend(); ++it )
+                processFront( *it );
+
+        // OpenMP forbids exceptions from escaping the parallel region, so
+        // they are captured and the first is rethrown afterwards
+        const Int numSubtrees = subtrees.size();
+        vector<std::exception_ptr> exceptions( numSubtrees );
+        #pragma omp parallel for schedule(dynamic,1)
+        for( Int t=0; t<numSubtrees; ++t )
+        {
+            try { processSubtree( subtrees[t].second ); }
+            catch( ... ) { exceptions[t] = std::current_exception(); }
+        }
+        for( const auto& exception : exceptions )
+            if( exception )
+                std::rethrow_exception( exception );
+
+        if( !topDown )
+            for( const auto& node : topFronts )
+                processFront( node );
+        return;
+    }
+#endif
+    processSubtree( root );
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_NUMERIC_SCHEDULE_HPP
@@ -10,6 +10,8 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
+#include "./LU/Lookahead.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -25,7 +27,7 @@ void LU( Matrix<F>& A )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("LU");
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -60,7 +62,7 @@ void LU( AbstractDistMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("LU",A.Grid());
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -109,7 +111,7 @@ void LU( Matrix<F>& A, Permutation& P )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("LU");
 
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
@@ -151,10 +153,30 @@ void LU
     lu::Full( A, P, Q );
 }
 
+template<typename F>
+void LU( Matrix<F>& A, Permutation& P, LUPivotType pivotType )
+{
+    EL_DEBUG_CSE
+    if( pivotType != LU_PARTIAL && pivotType != LU_TOURNAMENT )
+        LogicError("Unsupported pivot type for a single permutation");
+    // A tournament over a single process reduces to partial pivoting
+    LU( A, P );
+}
+
 template<typename F>
 void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 {
     EL_DEBUG_CSE
+    LU( APre, P, LU_PARTIAL );
+}
+
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& APre, DistPermutation& P, LUPivotType pivotType )
+{
+    EL_DEBUG_CSE
+    if( pivotType != LU_PARTIAL && pivotType != LU_TOURNAMENT )
+        LogicError("Unsupported pivot type for a single permutation");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -176,7 +198,7 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("LU",A.Grid());
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -199,7 +221,10 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
         ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
         A11_STAR_STAR = A11;
         A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        if( pivotType == LU_TOURNAMENT )
+            lu::TournamentPanel( A11_STAR_STAR, A21_MC_STAR, P, PB, k );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
 
         PB.PermuteRows( AB );
 
@@ -220,6 +245,16 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     }
 }
 
+template<typename F>
+void LU( AbstractDistMatrix<F>& A, DistPermutation& P, const LUCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.lookahead )
+        lu::Lookahead( A, P, ctrl.pivotType );
+    else
+        LU( A, P, ctrl.pivotType );
+}
+
 template<typename F>
 void LU
 ( AbstractDistMatrix<F>& A,
@@ -241,6 +276,18 @@ void LU
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( Matrix<F>& A, \
+    Permutation& P, \
+    LUPivotType pivotType ); \
+  template void LU \
+  ( AbstractDistMatrix<F>& A, \
+    DistPermutation& P, \
+    LUPivotType pivotType ); \
+  template void LU \
+  ( AbstractDistMatrix<F>& A, \
+    DistPermutation& P, \
+    const LUCtrl& ctrl ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -274,6 +321,12 @@ void LU
     DistPermutation& PB, \
     Int offset, \
     vector<F>& pivotBuf ); \
+  template void lu::TournamentPanel \
+  ( DistMatrix<F,  STAR,STAR>& A11, \
+    DistMatrix<F,  MC,  STAR>& A21, \
+    DistPermutation& P, \
+    DistPermutation& PB, \
+    Int offset ); \
   template void lu::SolveAfter \
   ( Orientation orientation, \
     const Matrix<F>& A, \
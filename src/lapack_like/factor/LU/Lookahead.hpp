@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_LOOKAHEAD_HPP
+#define EL_LU_LOOKAHEAD_HPP
+
+namespace El {
+namespace lu {
+
+// A pipelined version of the partially-pivoted (or tournament-pivoted)
+// distributed LU factorization. The columns of the next panel are updated
+// before the rest of the trailing matrix so that the gather of that panel
+// to [MC,STAR] is in flight during the bulk of the local Gemm.
+template<typename F>
+void Lookahead
+( AbstractDistMatrix<F>& APre, DistPermutation& P, LUPivotType pivotType )
+{
+    EL_DEBUG_CSE
+    if( pivotType != LU_PARTIAL && pivotType != LU_TOURNAMENT )
+        LogicError("Unsupported pivot type for a single permutation");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    const Grid& g = A.Grid();
+    DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,  MC,  STAR> A21_MC_STAR(g);
+    DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,  STAR,MR  > A12_STAR_MR(g);
+    DistMatrix<F,  MC,  STAR> AB1_MC_STAR(g);
+    copy::PendingCopy<F> pending;
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    P.SetGrid( g );
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    DistPermutation PB(g);
+
+    vector<F> panelBuf, pivotBuf;
+    const Int bsize = TunedBlocksize<F>("LU",A.Grid());
+
+    // Start gathering the (fully updated) panel beginning at index k
+    auto startGather = [&]( Int k )
+      {
+          const Int nb = Min(bsize,minDim-k);
+          auto AB1 = A( IR(k,END), IR(k,k+nb) );
+          AB1_MC_STAR.AlignWith( AB1 );
+          copy::RowAllGather( AB1, AB1_MC_STAR, pending );
+      };
+
+    if( minDim > 0 )
+        startGather( 0 );
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const Int nbNext = Min(bsize,minDim-k-nb);
+        const IR ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        auto AB  = A( indB, ALL );
+
+        // Form the contiguous panel expected by lu::Panel from the gathered
+        // columns, which only requires communication for A11
+        pending.Finish();
+        const Int A21Height = A21.Height();
+        const Int A21LocHeight = A21.LocalHeight();
+        const Int panelLDim = nb+A21LocHeight;
+        FastResize( panelBuf, panelLDim*nb );
+        A11_STAR_STAR.Attach
+        ( nb, nb, g, 0, 0, &panelBuf[0], panelLDim, 0 );
+        A21_MC_STAR.Attach
+        ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
+        A11_STAR_STAR = AB1_MC_STAR( IR(0,nb), ALL );
+        auto A21Gathered = AB1_MC_STAR( IR(nb,END), ALL );
+        lapack::Copy
+        ( 'F', A21LocHeight, nb,
+          A21Gathered.LockedBuffer(), A21Gathered.LDim(),
+          A21_MC_STAR.Buffer(),       A21_MC_STAR.LDim() );
+        if( pivotType == LU_TOURNAMENT )
+            lu::TournamentPanel( A11_STAR_STAR, A21_MC_STAR, P, PB, k );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+
+        PB.PermuteRows( AB );
+
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12_STAR_VR;
+
+        const IR indNext( 0, nbNext ), indRest( nbNext, END );
+        if( nbNext > 0 )
+        {
+            auto A22Next = A22( ALL, indNext );
+            auto A12Next_STAR_MR = A12_STAR_MR( ALL, indNext );
+            LocalGemm
+            ( NORMAL, NORMAL,
+              F(-1), A21_MC_STAR, A12Next_STAR_MR, F(1), A22Next );
+            startGather( k+nb );
+        }
+
+        // The bulk of the update overlaps with the gather of the next panel
+        auto A22Rest = A22( ALL, indRest );
+        auto A12Rest_STAR_MR = A12_STAR_MR( ALL, indRest );
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12Rest_STAR_MR, F(1), A22Rest );
+
+        A11 = A11_STAR_STAR;
+        A12 = A12_STAR_MR;
+        A21 = A21_MC_STAR;
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_LOOKAHEAD_HPP
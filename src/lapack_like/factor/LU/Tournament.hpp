@@ -0,0 +1,219 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+namespace El {
+namespace lu {
+
+namespace tournament {
+
+// Overwrite the candidate rows (and their indices) with the (at most n) rows
+// that partial pivoting selects from them, in the order of selection.
+// Unlike lu::Panel, a zero pivot column is tolerated, as rank-deficient
+// candidate sets are common in the leaves of the tournament.
+template<typename F>
+void Select( Matrix<F>& cand, vector<Int>& inds )
+{
+    EL_DEBUG_CSE
+    const Int c = cand.Height();
+    const Int n = cand.Width();
+    const Int numSelected = Min(c,n);
+
+    Matrix<F> W( cand );
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    vector<Int> perm( c );
+    for( Int i=0; i<c; ++i )
+        perm[i] = i;
+    for( Int k=0; k<numSelected; ++k )
+    {
+        const Int iPiv = k + blas::MaxInd( c-k, &WBuf[k+k*WLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &WBuf[k], WLDim, &WBuf[iPiv], WLDim );
+            std::swap( perm[k], perm[iPiv] );
+        }
+        const F alpha = WBuf[k+k*WLDim];
+        if( alpha == F(0) )
+            continue;
+        blas::Scal( c-(k+1), F(1)/alpha, &WBuf[(k+1)+k*WLDim], 1 );
+        blas::Geru
+        ( c-(k+1), n-(k+1),
+          F(-1), &WBuf[(k+1)+k*WLDim], 1, &WBuf[k+(k+1)*WLDim], WLDim,
+                 &WBuf[(k+1)+(k+1)*WLDim], WLDim );
+    }
+
+    Matrix<F> winners( numSelected, n );
+    vector<Int> winnerInds( numSelected );
+    for( Int i=0; i<numSelected; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+            winners(i,j) = cand(perm[i],j);
+        winnerInds[i] = inds[perm[i]];
+    }
+    cand = winners;
+    inds = winnerInds;
+}
+
+} // namespace tournament
+
+// Communication-avoiding analogue of the distributed lu::Panel: the n pivots
+// of the panel are chosen with a binary tournament over the process column
+// (each round of which selects the partial-pivoting winners of the union of
+// two candidate sets), so that only log2(p) messages and a single broadcast
+// are required rather than an all-reduce and broadcast per column. The panel
+// is then factored without further communication.
+//
+// The assumptions on the buffers of A and B are the same as for lu::Panel,
+// except that A[*,*] must be correct on every process.
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = mpi::Rank( colComm );
+    const int colSize = mpi::Size( colComm );
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+    )
+
+    // The leaves of the tournament are the local rows of B, with the rows of
+    // A belonging to the first process
+    const Int numTop = ( colRank == 0 ? n : 0 );
+    Matrix<F> cand( numTop+BLocHeight, n );
+    vector<Int> inds( numTop+BLocHeight );
+    for( Int i=0; i<numTop; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+            cand(i,j) = A.GetLocal(i,j);
+        inds[i] = i;
+    }
+    for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+    {
+        for( Int j=0; j<n; ++j )
+            cand(numTop+iLoc,j) = B.GetLocal(iLoc,j);
+        inds[numTop+iLoc] = n + B.GlobalRow(iLoc);
+    }
+    tournament::Select( cand, inds );
+
+    // Play the rounds of the tournament, with the winner on the first process
+    vector<F> recvVals;
+    vector<Int> recvInds;
+    for( int stride=1; stride<colSize; stride*=2 )
+    {
+        if( colRank % (2*stride) == stride )
+        {
+            const Int numCand = cand.Height();
+            const int partner = colRank - stride;
+            mpi::Send( numCand, partner, colComm );
+            mpi::Send( cand.LockedBuffer(), numCand*n, partner, colComm );
+            mpi::Send( inds.data(), numCand, partner, colComm );
+            break;
+        }
+        else if( colRank % (2*stride) == 0 && colRank+stride < colSize )
+        {
+            const int partner = colRank + stride;
+            const Int numRecv = mpi::Recv<Int>( partner, colComm );
+            FastResize( recvVals, numRecv*n );
+            recvInds.resize( numRecv );
+            mpi::Recv( recvVals.data(), numRecv*n, partner, colComm );
+            mpi::Recv( recvInds.data(), numRecv, partner, colComm );
+
+            const Int numCand = cand.Height();
+            Matrix<F> merged( numCand+numRecv, n );
+            for( Int j=0; j<n; ++j )
+            {
+                for( Int i=0; i<numCand; ++i )
+                    merged(i,j) = cand(i,j);
+                for( Int i=0; i<numRecv; ++i )
+                    merged(numCand+i,j) = recvVals[i+j*numRecv];
+            }
+            inds.insert( inds.end(), recvInds.begin(), recvInds.end() );
+            cand = merged;
+            tournament::Select( cand, inds );
+        }
+    }
+    Int numWinners = cand.Height();
+    mpi::Broadcast( numWinners, 0, colComm );
+    if( numWinners != n )
+        LogicError("Tournament produced ",numWinners," of ",n," pivots");
+    cand.Resize( n, n );
+    inds.resize( n );
+    mpi::Broadcast( cand.Buffer(), n*n, 0, colComm );
+    mpi::Broadcast( inds.data(), n, 0, colComm );
+
+    // Convert the winners into a sequence of swaps. Since each winner is
+    // swapped into the top of the panel, every row displaced into the bottom
+    // of the panel is one of the original rows of A.
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+    std::map<Int,Int> posOfOrig, origAtPos;
+    auto position = [&]( Int orig )
+      { auto it = posOfOrig.find(orig);
+        return it == posOfOrig.end() ? orig : it->second; };
+    auto original = [&]( Int pos )
+      { auto it = origAtPos.find(pos);
+        return it == origAtPos.end() ? pos : it->second; };
+    for( Int k=0; k<n; ++k )
+    {
+        const Int iPiv = position( inds[k] );
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+        if( iPiv != k )
+        {
+            const Int origK = original( k );
+            origAtPos[k] = inds[k];
+            origAtPos[iPiv] = origK;
+            posOfOrig[inds[k]] = k;
+            posOfOrig[origK] = iPiv;
+        }
+    }
+
+    // Apply the swaps locally using the broadcast winners and the (redundant)
+    // original rows of A
+    Matrix<F> AOrig( A.LockedMatrix() );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            A.SetLocal( i, j, cand(i,j) );
+    for( const auto& entry : origAtPos )
+    {
+        const Int pos = entry.first;
+        if( pos < n || !B.IsLocalRow(pos-n) )
+            continue;
+        const Int orig = entry.second;
+        EL_DEBUG_ONLY(
+          if( orig >= n )
+              LogicError("Displaced row was not from the top of the panel");
+        )
+        const Int iLoc = B.LocalRow(pos-n);
+        for( Int j=0; j<n; ++j )
+            B.SetLocal( iLoc, j, AOrig(orig,j) );
+    }
+
+    // Factor the panel with the chosen pivots
+    LU( A.Matrix() );
+    Trsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT,
+      F(1), A.LockedMatrix(), B.Matrix() );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
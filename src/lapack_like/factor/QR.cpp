@@ -12,6 +12,8 @@
 #include "./QR/BusingerGolub.hpp"
 #include "./QR/Cholesky.hpp"
 #include "./QR/Householder.hpp"
+#include "./QR/CA.hpp"
+#include "./QR/Lookahead.hpp"
 #include "./QR/SolveAfter.hpp"
 #include "./QR/Explicit.hpp"
 
@@ -75,6 +77,24 @@ void QR
     qr::Householder( A, householderScalars, signature );
 }
 
+template<typename F>
+void QR
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.colPiv )
+        LogicError("Column pivoting requires a permutation");
+    if( ctrl.caqr )
+        qr::CA( A, householderScalars, signature );
+    else if( ctrl.lookahead )
+        qr::Lookahead( A, householderScalars, signature );
+    else
+        qr::Householder( A, householderScalars, signature );
+}
+
 // Variants which perform (Businger-Golub) column-pivoting
 // =======================================================
 
@@ -112,6 +132,11 @@ void QR
     AbstractDistMatrix<F>& householderScalars, \
     AbstractDistMatrix<Base<F>>& signature ); \
   template void QR \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature, \
+    const QRCtrl<Base<F>>& ctrl ); \
+  template void QR \
   ( Matrix<F>& A, \
     Matrix<F>& householderScalars, \
     Matrix<Base<F>>& signature, \
@@ -195,10 +220,12 @@ void QR
   template void qr::Cholesky \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& R ); \
-  template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
+  template qr::TreeData<F> qr::TS \
+  ( const AbstractDistMatrix<F>& A, Int flatWidth ); \
   template void qr::ExplicitTS \
   ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R ); \
+    AbstractDistMatrix<F>& R, \
+    Int flatWidth ); \
   template Matrix<F>& qr::ts::RootQR \
   ( const AbstractDistMatrix<F>& A, TreeData<F>& treeData ); \
   template const Matrix<F>& qr::ts::RootQR \
@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_CA_HPP
+#define EL_QR_CA_HPP
+
+namespace El {
+namespace qr {
+
+// Communication-avoiding QR (CAQR): each panel is factored by TSQR within
+// the process columns, which requires O(log r) rather than O(nb log r)
+// messages for an r x c process grid, and the Householder vectors of the
+// panel are then reconstructed from its explicit Q (see Ballard et al.,
+// "Reconstructing Householder vectors from Tall-Skinny QR") so that the
+// result has the same form as that of qr::Householder.
+//
+// With QB1 R11 the TSQR of the panel and S = -sgn(Re(diag(Q11))), the LU
+// factorization
+//
+//   QB1 - | S | = | Y1 | U11
+//         | 0 |   | Y2 |
+//
+// does not require pivoting, and the panel equals
+// (H_0 ... H_{nb-1}) diag(S) | R11 |, where H_i = I - conj(tau_i) y_i y_i^H
+//                            |  0  |
+// and tau_i = -conj(U11(i,i)) S(i).
+template<typename F>
+void CA
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int minDim = Min(m,n);
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    const Grid& g = A.Grid();
+    DistMatrix<F,MC,STAR> AB1_MC_STAR(g);
+    DistMatrix<F,STAR,STAR> R11(g), U11(g), householderScalars1_STAR_STAR(g);
+    DistMatrix<Real,STAR,STAR> sig1_STAR_STAR(g);
+
+    const Int bsize = TunedBlocksize<F>("QR",g);
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         indB( k,    END  ),
+                         ind2( k+nb, END  );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+
+        // Overwrite the panel with its explicit Q from TSQR
+        AB1_MC_STAR = AB1;
+        ExplicitTS( AB1_MC_STAR, R11 );
+
+        // Factor Q11 - S = Y1 U11
+        U11 = AB1_MC_STAR( IR(0,nb), ALL );
+        auto& U11Loc = U11.Matrix();
+        sig1_STAR_STAR.Resize( nb, 1 );
+        householderScalars1_STAR_STAR.Resize( nb, 1 );
+        auto& sig1Loc = sig1_STAR_STAR.Matrix();
+        auto& householderScalars1Loc = householderScalars1_STAR_STAR.Matrix();
+        for( Int i=0; i<nb; ++i )
+        {
+            sig1Loc(i) =
+              ( RealPart(U11Loc(i,i)) >= Real(0) ? Real(-1) : Real(1) );
+            U11Loc(i,i) -= sig1Loc(i);
+        }
+        LU( U11Loc );
+        for( Int i=0; i<nb; ++i )
+            householderScalars1Loc(i) = -Conj(U11Loc(i,i))*sig1Loc(i);
+
+        // Overlay Y with R11 and solve for Y2 := Q21 inv(U11)
+        auto& AB1Loc = AB1_MC_STAR.Matrix();
+        const auto& R11Loc = R11.LockedMatrix();
+        const Int localHeight1 = AB1_MC_STAR.LocalRowOffset(nb);
+        for( Int iLoc=0; iLoc<localHeight1; ++iLoc )
+        {
+            const Int i = AB1_MC_STAR.GlobalRow(iLoc);
+            for( Int j=0; j<nb; ++j )
+                AB1Loc(iLoc,j) = ( j >= i ? R11Loc(i,j) : U11Loc(i,j) );
+        }
+        auto Y2Loc = AB1Loc( IR(localHeight1,END), ALL );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), U11Loc, Y2Loc );
+
+        AB1 = AB1_MC_STAR;
+        householderScalars1 = householderScalars1_STAR_STAR;
+        sig1 = sig1_STAR_STAR;
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_CA_HPP
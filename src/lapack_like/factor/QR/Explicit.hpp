@@ -41,6 +41,10 @@ void ExplicitTriang( AbstractDistMatrix<F>& A, const QRCtrl<Base<F>>& ctrl )
         DistPermutation Omega(A.Grid());
         BusingerGolub( A, householderScalars, signature, Omega, ctrl );
     }
+    else if( ctrl.caqr )
+        CA( A, householderScalars, signature );
+    else if( ctrl.lookahead )
+        Lookahead( A, householderScalars, signature );
     else
         Householder( A, householderScalars, signature );
 
@@ -97,7 +101,7 @@ void ExplicitUnitary
         QR( A, householderScalars, signature, Omega, ctrl );
     }
     else
-        QR( A, householderScalars, signature );
+        QR( A, householderScalars, signature, ctrl );
 
     if( thinQR )
     {
@@ -178,7 +182,7 @@ void Explicit
         QR( A, householderScalars, signature, Omega, ctrl );
     }
     else
-        QR( A, householderScalars, signature );
+        QR( A, householderScalars, signature, ctrl );
 
     const Int m = A.Height();
     const Int n = A.Width();
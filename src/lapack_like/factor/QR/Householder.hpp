@@ -29,7 +29,7 @@ Householder
     householderScalars.Resize( minDim, 1 );
     signature.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("QR");
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -72,7 +72,7 @@ Householder
     householderScalars.Resize( minDim, 1 );
     signature.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>("QR",A.Grid());
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -0,0 +1,157 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_LOOKAHEAD_HPP
+#define EL_QR_LOOKAHEAD_HPP
+
+#include "../../reflect/ApplyPacked/Util.hpp"
+
+namespace El {
+namespace qr {
+
+// Apply the adjoint of a block of Householder transformations, whose unit
+// lower-trapezoidal vectors have been gathered into H_MC_STAR and whose UT
+// transform is defined by SInv_STAR_STAR, followed by diag(sig), to ABot
+template<typename F>
+void ApplyPanelAdjoint
+( const DistMatrix<F,MC,STAR>& H_MC_STAR,
+  const DistMatrix<F,STAR,STAR>& SInv_STAR_STAR,
+  const DistMatrix<Base<F>,STAR,STAR>& sig_STAR_STAR,
+        DistMatrix<F>& ABot )
+{
+    EL_DEBUG_CSE
+    const Grid& g = ABot.Grid();
+    const Int nb = H_MC_STAR.Width();
+    DistMatrix<F,STAR,MR> Z_STAR_MR(g);
+    DistMatrix<F,STAR,VR> Z_STAR_VR(g);
+
+    // Z := inv(SInv) H' ABot
+    Z_STAR_MR.AlignWith( ABot );
+    LocalGemm( ADJOINT, NORMAL, F(1), H_MC_STAR, ABot, Z_STAR_MR );
+    Z_STAR_VR.AlignWith( ABot );
+    Contract( Z_STAR_MR, Z_STAR_VR );
+    LocalTrsm
+    ( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, Z_STAR_VR );
+
+    // ABot := ABot - H Z
+    Z_STAR_MR = Z_STAR_VR;
+    LocalGemm( NORMAL, NORMAL, F(-1), H_MC_STAR, Z_STAR_MR, F(1), ABot );
+
+    auto ATop = ABot( IR(0,nb), ALL );
+    DiagonalScale( LEFT, ADJOINT, sig_STAR_STAR, ATop );
+}
+
+// A pipelined version of the distributed Householder QR factorization. The
+// next panel is updated and factored before the rest of the trailing matrix,
+// and the gather of its Householder vectors to [MC,STAR] is in flight during
+// the bulk of the update.
+template<typename F>
+void Lookahead
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    typedef Base<F> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int minDim = Min(m,n);
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Real,Real,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    const Grid& g = A.Grid();
+    DistMatrix<F> HPan(g);
+    DistMatrix<F,VC,STAR> HPan_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> householderScalars1_STAR_STAR(g);
+    // The panels alternate between two sets of buffers
+    DistMatrix<F,MC,STAR> H_MC_STAR0(g), H_MC_STAR1(g);
+    DistMatrix<F,STAR,STAR> SInv_STAR_STAR0(g), SInv_STAR_STAR1(g);
+    DistMatrix<Real,STAR,STAR> sig_STAR_STAR0(g), sig_STAR_STAR1(g);
+    DistMatrix<F,MC,STAR>* HBufs_MC_STAR[2] = { &H_MC_STAR0, &H_MC_STAR1 };
+    DistMatrix<F,STAR,STAR>* SInvBufs_STAR_STAR[2] =
+      { &SInv_STAR_STAR0, &SInv_STAR_STAR1 };
+    DistMatrix<Real,STAR,STAR>* sigBufs_STAR_STAR[2] =
+      { &sig_STAR_STAR0, &sig_STAR_STAR1 };
+    copy::PendingCopy<F> pending;
+
+    const Int bsize = TunedBlocksize<F>("QR",g);
+
+    // Factor the (fully updated) panel beginning at index k, form its UT
+    // transform, and start the gather of its Householder vectors
+    auto factorPanel = [&]( Int k, Int buf )
+      {
+          const Int nb = Min(bsize,minDim-k);
+          const Range<Int> ind1( k, k+nb ), indB( k, END );
+          auto AB1 = A( indB, ind1 );
+          auto householderScalars1 = householderScalars( ind1, ALL );
+          auto sig1 = signature( ind1, ALL );
+          PanelHouseholder( AB1, householderScalars1, sig1 );
+
+          HPan.AlignWith( AB1 );
+          HPan = AB1;
+          MakeTrapezoidal( LOWER, HPan );
+          FillDiagonal( HPan, F(1) );
+
+          auto& SInv_STAR_STAR = *SInvBufs_STAR_STAR[buf];
+          HPan_VC_STAR = HPan;
+          Zeros( SInv_STAR_STAR, nb, nb );
+          Herk
+          ( LOWER, ADJOINT,
+            Real(1), HPan_VC_STAR.LockedMatrix(),
+            Real(0), SInv_STAR_STAR.Matrix() );
+          El::AllReduce( SInv_STAR_STAR, HPan_VC_STAR.ColComm() );
+          householderScalars1_STAR_STAR = householderScalars1;
+          FixDiagonal
+          ( UNCONJUGATED, householderScalars1_STAR_STAR, SInv_STAR_STAR );
+          *sigBufs_STAR_STAR[buf] = sig1;
+
+          HBufs_MC_STAR[buf]->AlignWith( AB1 );
+          copy::RowAllGather( HPan, *HBufs_MC_STAR[buf], pending );
+      };
+
+    if( minDim > 0 )
+        factorPanel( 0, 0 );
+    for( Int k=0, buf=0; k<minDim; k+=bsize, buf=1-buf )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const Int nbNext = Min(bsize,minDim-k-nb);
+        const Range<Int> indB( k, END ), ind2( k+nb, END );
+        auto AB2 = A( indB, ind2 );
+
+        pending.Finish();
+        const auto& H_MC_STAR = *HBufs_MC_STAR[buf];
+        const auto& SInv_STAR_STAR = *SInvBufs_STAR_STAR[buf];
+        const auto& sig_STAR_STAR = *sigBufs_STAR_STAR[buf];
+        if( nbNext > 0 )
+        {
+            auto AB2Next = AB2( ALL, IR(0,nbNext) );
+            ApplyPanelAdjoint
+            ( H_MC_STAR, SInv_STAR_STAR, sig_STAR_STAR, AB2Next );
+            factorPanel( k+nb, 1-buf );
+        }
+
+        // The bulk of the update overlaps with the gather of the next panel
+        auto AB2Rest = AB2( ALL, IR(nbNext,END) );
+        ApplyPanelAdjoint( H_MC_STAR, SInv_STAR_STAR, sig_STAR_STAR, AB2Rest );
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_LOOKAHEAD_HPP
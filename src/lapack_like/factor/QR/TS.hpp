@@ -13,6 +13,104 @@ namespace El {
 namespace qr {
 namespace ts {
 
+// The number of consecutive processes of 'comm' which share a node, provided
+// that each node holds a contiguous range of ranks and all but the last node
+// hold the same number of them, and one otherwise
+inline Int FlatWidth( mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    mpi::Comm nodeComm;
+    mpi::SplitShared( comm, commRank, nodeComm );
+    const int nodeSize = mpi::Size( nodeComm );
+    const int nodeFirst = mpi::AllReduce( commRank, mpi::MIN, nodeComm );
+    const int nodeLast = mpi::AllReduce( commRank, mpi::MAX, nodeComm );
+    mpi::Free( nodeComm );
+
+    const int width = mpi::AllReduce( nodeSize, mpi::MAX, comm );
+    const int regular =
+      nodeLast-nodeFirst+1 == nodeSize &&
+      nodeFirst % width == 0 &&
+      ( nodeSize == width || nodeLast == commSize-1 );
+    const int allRegular = mpi::AllReduce( regular, mpi::MIN, comm );
+    return ( allRegular ? width : 1 );
+}
+
+// After stage 'stage' of the reduction, each remaining process holds the
+// triangle of the processes in [rank,rank+span)
+inline Int Span( Int stage, Int flatWidth )
+{ return stage < 0 ? 1 : flatWidth << stage; }
+
+inline Int NumStages( Int p, Int flatWidth )
+{
+    Int numStages = 1;
+    while( Span(numStages-1,flatWidth) < p )
+        ++numStages;
+    return numStages;
+}
+
+// The height of the triangle held by the first of the processes in
+// [first,first+span)
+inline Int TriangleHeight
+( const vector<Int>& localHeights, Int first, Int span, Int n )
+{
+    const Int p = localHeights.size();
+    Int height = 0;
+    for( Int q=first; q<Min(first+span,p); ++q )
+        height += localHeights[q];
+    return Min( height, n );
+}
+
+// Only the upper trapezoids of the triangles are exchanged
+inline Int PackedSize( Int height, Int n )
+{
+    if( height >= n )
+        return (n*(n+1))/2;
+    else
+        return (height*(height+1))/2 + (n-height)*height;
+}
+
+template<typename F>
+void PackTriangle( const Matrix<F>& Z, vector<F>& buffer )
+{
+    const Int height = Z.Height();
+    const Int n = Z.Width();
+    buffer.resize( PackedSize(height,n) );
+    Int offset = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        const Int colHeight = Min(j+1,height);
+        MemCopy( &buffer[offset], Z.LockedBuffer(0,j), colHeight );
+        offset += colHeight;
+    }
+}
+
+template<typename F>
+void UnpackTriangle( const vector<F>& buffer, Matrix<F>& Z )
+{
+    const Int height = Z.Height();
+    const Int n = Z.Width();
+    Int offset = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        const Int colHeight = Min(j+1,height);
+        MemCopy( Z.Buffer(0,j), &buffer[offset], colHeight );
+        offset += colHeight;
+    }
+}
+
+template<typename F>
+vector<Int> LocalHeights( const AbstractDistMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    const mpi::Comm colComm = A.ColComm();
+    const Int localHeight = A.LocalHeight();
+    vector<Int> localHeights( mpi::Size(colComm) );
+    mpi::AllGather( &localHeight, 1, localHeights.data(), 1, colComm );
+    return localHeights;
+}
+
 template<typename F>
 void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 {
@@ -28,59 +126,73 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
     if( p == 1 )
         return;
     const Int rank = mpi::Rank( colComm );
-    if( m < p*n )
-        LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = FlooredLog2(p);
-
-    Matrix<F> lastZ;
-    lastZ = treeData.QR0( IR(0,n), IR(0,n) );
-
-    treeData.QRList.resize( logp );
-    treeData.householderScalarsList.resize( logp );
-    treeData.signatureList.resize( logp );
-
-    // Run the binary tree reduction
-    Matrix<F> ZTop(n,n,n), ZBot(n,n,n);
-    for( Int stage=0; stage<logp; ++stage )
+    if( m < n )
+        LogicError("TSQR assumes that the height is at least the width");
+    if( treeData.flatWidth <= 0 )
+        treeData.flatWidth = FlatWidth( colComm );
+    const Int flatWidth = treeData.flatWidth;
+    const auto localHeights = LocalHeights( A );
+    const Int numStages = NumStages( p, flatWidth );
+
+    treeData.QRList.assign( numStages, Matrix<F>() );
+    treeData.householderScalarsList.assign( numStages, Matrix<F>() );
+    treeData.signatureList.assign( numStages, Matrix<Base<F>>() );
+
+    // Start from the R of the local QR, which is short if the local
+    // height is less than the width
+    Int height = Min( A.LocalHeight(), n );
+    Matrix<F> Z;
+    Z = treeData.QR0( IR(0,height), ALL );
+    MakeTrapezoidal( UPPER, Z );
+
+    vector<F> buffer;
+    for( Int stage=0; stage<numStages; ++stage )
     {
-        // Pack, then send and receive n x n matrices
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
-        {
-            ZTop = lastZ;
-            MakeTrapezoidal( UPPER, ZTop );
-            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
-        }
-        else
+        const Int span = Span( stage, flatWidth );
+        const Int childSpan = Span( stage-1, flatWidth );
+        if( rank % span != 0 )
         {
-            ZBot = lastZ;
-            MakeTrapezoidal( UPPER, ZBot );
-            mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm );
+            PackTriangle( Z, buffer );
+            mpi::Send( buffer.data(), buffer.size(), rank-rank%span, colComm );
             break;
         }
+        if( rank+childSpan >= p )
+            continue;
 
+        // Stack our triangle on top of those of our children
+        Int stackedHeight = height;
+        for( Int child=rank+childSpan; child<Min(rank+span,p);
+             child+=childSpan )
+            stackedHeight +=
+              TriangleHeight( localHeights, child, childSpan, n );
         auto& QRFact = treeData.QRList[stage];
         auto& householderScalars = treeData.householderScalarsList[stage];
         auto& signature = treeData.signatureList[stage];
-        QRFact.Resize( 2*n, n, 2*n );
-        householderScalars.Resize( n, 1 );
-        signature.Resize( n, 1 );
-        auto QRFactTop = QRFact( IR(0,n),   IR(0,n) );
-        auto QRFactBot = QRFact( IR(n,2*n), IR(0,n) );
-        QRFactTop = ZTop;
-        QRFactBot = ZBot;
+        Zeros( QRFact, stackedHeight, n );
+        auto QRFactTop = QRFact( IR(0,height), ALL );
+        QRFactTop = Z;
+        Int offset = height;
+        for( Int child=rank+childSpan; child<Min(rank+span,p);
+             child+=childSpan )
+        {
+            const Int childHeight =
+              TriangleHeight( localHeights, child, childSpan, n );
+            buffer.resize( PackedSize(childHeight,n) );
+            mpi::Recv( buffer.data(), buffer.size(), child, colComm );
+            auto QRFactChild = QRFact( IR(offset,offset+childHeight), ALL );
+            UnpackTriangle( buffer, QRFactChild );
+            offset += childHeight;
+        }
+        height = Min( stackedHeight, n );
 
         // Note that the last QR is not performed by this routine, as many
         // higher-level routines, such as TS-SVT, are simplified if the final
         // small matrix is left alone.
-        if( stage < logp-1 )
+        if( stage < numStages-1 )
         {
-            // TODO: Exploit double-triangular structure
             QR( QRFact, householderScalars, signature );
-            lastZ = QRFact( IR(0,n), IR(0,n) );
+            Z = QRFact( IR(0,height), ALL );
+            MakeTrapezoidal( UPPER, Z );
         }
     }
 }
@@ -199,58 +311,71 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
     if( p == 1 )
         return;
     const Int rank = mpi::Rank( colComm );
-    if( m < p*n )
-        LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = FlooredLog2(p);
-
-    // Run the binary tree scatter
-    Matrix<F> Z(2*n,n,2*n), ZHalf(n,n,n);
-    if( rank == 0 )
-        Z = RootQR( A, treeData );
-    auto ZTop = Z( IR(0,n),   IR(0,n) );
-    auto ZBot = Z( IR(n,2*n), IR(0,n) );
-    for( Int revStage=0; revStage<logp; ++revStage )
+    if( m < n )
+        LogicError("TSQR assumes that the height is at least the width");
+    const Int flatWidth = treeData.flatWidth;
+    if( flatWidth <= 0 )
+        LogicError("The tree must be formed by ts::Reduce");
+    const auto localHeights = LocalHeights( A );
+    const Int numStages = NumStages( p, flatWidth );
+
+    // Run the tree scatter in reverse. ZHalf holds the rows of the product
+    // corresponding to the triangle that this process held at each stage.
+    Matrix<F> Z, ZHalf, ZChild;
+    for( Int stage=numStages-1; stage>=0; --stage )
     {
-        const Int stage = (logp-1)-revStage;
-        // Skip this stage if the first stage bits of our rank are not zero
-        if( stage>0 && (Unsigned(rank) & ((Unsigned(1)<<stage)-1)) )
+        const Int span = Span( stage, flatWidth );
+        const Int childSpan = Span( stage-1, flatWidth );
+        // Skip the stages which followed our sending of our triangle
+        if( rank % childSpan != 0 )
             continue;
 
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
+        const Int height = TriangleHeight( localHeights, rank, childSpan, n );
+        if( rank % span != 0 )
         {
-            if( stage < logp-1 )
-            {
-                // Multiply by the current Q
-                ZTop = ZHalf;
-                Zero( ZBot );
-
-                // TODO: Exploit sparsity?
-                ApplyQ
-                ( LEFT, NORMAL,
-                  treeData.QRList[stage],
-                  treeData.householderScalarsList[stage],
-                  treeData.signatureList[stage],
-                  Z );
-            }
-            // Send bottom-half to partner and keep top half
-            ZHalf = ZBot;
-            mpi::Send( ZHalf.LockedBuffer(), n*n, partner, colComm );
-            ZHalf = ZTop;
+            ZHalf.Resize( height, n, Max(height,Int(1)) );
+            mpi::Recv
+            ( ZHalf.Buffer(), height*n, rank-rank%span, colComm );
+            continue;
+        }
+        if( rank+childSpan >= p )
+            continue;
+
+        if( stage == numStages-1 )
+        {
+            Z = RootQR( A, treeData );
         }
         else
         {
-            // Recv top half from partner
-            mpi::Recv( ZHalf.Buffer(), n*n, partner, colComm );
+            const auto& QRFact = treeData.QRList[stage];
+            Zeros( Z, QRFact.Height(), n );
+            auto ZTop = Z( IR(0,ZHalf.Height()), ALL );
+            ZTop = ZHalf;
+            ApplyQ
+            ( LEFT, NORMAL,
+              QRFact,
+              treeData.householderScalarsList[stage],
+              treeData.signatureList[stage],
+              Z );
+        }
+
+        // Keep the top rows and send the rest to the children
+        Int offset = height;
+        for( Int child=rank+childSpan; child<Min(rank+span,p);
+             child+=childSpan )
+        {
+            const Int childHeight =
+              TriangleHeight( localHeights, child, childSpan, n );
+            ZChild = Z( IR(offset,offset+childHeight), ALL );
+            mpi::Send( ZChild.LockedBuffer(), childHeight*n, child, colComm );
+            offset += childHeight;
         }
+        ZHalf = Z( IR(0,height), ALL );
     }
 
     // Apply the initial Q
     Zero( A );
-    auto ATop = A.Matrix()( IR(0,n), IR(0,n) );
+    auto ATop = A.Matrix()( IR(0,ZHalf.Height()), ALL );
     ATop = ZHalf;
 
     // TODO: Exploit sparsity
@@ -316,11 +441,12 @@ FormQ( AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 } // namespace ts
 
 template<typename F>
-TreeData<F> TS( const AbstractDistMatrix<F>& A )
+TreeData<F> TS( const AbstractDistMatrix<F>& A, Int flatWidth )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
     TreeData<F> treeData;
+    treeData.flatWidth = flatWidth;
     treeData.QR0 = A.LockedMatrix();
     QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
 
@@ -338,9 +464,10 @@ TreeData<F> TS( const AbstractDistMatrix<F>& A )
 }
 
 template<typename F>
-void ExplicitTS( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R )
+void ExplicitTS
+( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R, Int flatWidth )
 {
-    auto treeData = TS( A );
+    auto treeData = TS( A, flatWidth );
     Copy( ts::FormR( A, treeData ), R );
     ts::FormQ( A, treeData );
 }
@@ -229,11 +229,19 @@ BlackBox
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    // TODO(poulson): Extend interface to support accepting ctrl.tridiagCtrl
-    herm_tridiag::ExplicitCondensed( uplo, A );
-
-    auto d = GetRealPartOfDiagonal(A);
-    auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
+    Matrix<Real> d;
+    Matrix<F> dSub;
+    if( ctrl.tridiagCtrl.twoStage )
+    {
+        herm_tridiag::TwoStage
+        ( uplo, A, d, dSub, ctrl.tridiagCtrl.bandwidth );
+    }
+    else
+    {
+        herm_tridiag::ExplicitCondensed( uplo, A );
+        d = GetRealPartOfDiagonal(A);
+        dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
+    }
     info.tridiagEigInfo =
       HermitianTridiagEig( d, dSub, w, ctrl.tridiagEigCtrl );
 
@@ -549,7 +557,19 @@ BlackBox
     EL_DEBUG_CSE
     HermitianEigInfo info;
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
+    if( ctrl.tridiagCtrl.twoStage )
+    {
+        Matrix<Base<F>> d;
+        Matrix<F> dSub;
+        herm_tridiag::TwoStageQ<F> transform;
+        herm_tridiag::TwoStage
+        ( uplo, A, d, dSub, transform, ctrl.tridiagCtrl.bandwidth );
+        info.tridiagEigInfo =
+          HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
+        herm_tridiag::ApplyQ( transform, Q );
+        return info;
+    }
+
     Matrix<F> householderScalars;
     HermitianTridiag( uplo, A, householderScalars );
 
@@ -14,6 +14,7 @@
 #include "./Pseudospectra/IRA.hpp"
 #include "./Pseudospectra/IRL.hpp"
 #include "./Pseudospectra/Analytic.hpp"
+#include "./Pseudospectra/Chunked.hpp"
 
 // For one-norm pseudospectra. An adaptation of the more robust algorithm of
 // Higham and Tisseur will hopefully be implemented soon.
@@ -57,17 +58,7 @@ Matrix<Int> TriangularSpectralCloud
 
     psCtrl.schur = true;
     if( psCtrl.norm == PS_TWO_NORM )
-    {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( U, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( U, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( U, shifts, invNorms, psCtrl );
-    }
+        return pspec::TwoNorm( U, shifts, invNorms, psCtrl );
     else
         return pspec::HagerHigham( U, shifts, invNorms, psCtrl );
         // Q is assumed to be the identity
@@ -110,17 +101,7 @@ Matrix<Int> TriangularSpectralCloud
 
     psCtrl.schur = true;
     if( psCtrl.norm == PS_TWO_NORM )
-    {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( U, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( U, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( U, shifts, invNorms, psCtrl );
-    }
+        return pspec::TwoNorm( U, shifts, invNorms, psCtrl );
     else
     {
         // Force Q to be complex as cheaply as possible
@@ -161,7 +142,7 @@ Matrix<Int> QuasiTriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
-    return pspec::IRA( U, shifts, invNorms, psCtrl );
+    return pspec::TwoNorm( U, shifts, invNorms, psCtrl );
 }
 
 template<typename Real>
@@ -196,7 +177,7 @@ Matrix<Int> QuasiTriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
-    return pspec::IRA( U, shifts, invNorms, psCtrl );
+    return pspec::TwoNorm( U, shifts, invNorms, psCtrl );
 }
 
 template<typename Field>
@@ -218,17 +199,7 @@ Matrix<Int> HessenbergSpectralCloud
     //       triangular version of SpectralCloud?
     psCtrl.schur = false;
     if( psCtrl.norm == PS_TWO_NORM )
-    {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( H, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( H, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( H, shifts, invNorms, psCtrl );
-    }
+        return pspec::TwoNorm( H, shifts, invNorms, psCtrl );
     else
         return pspec::HagerHigham( H, shifts, invNorms, psCtrl );
         // Q is assumed to be the identity
@@ -254,17 +225,7 @@ Matrix<Int> HessenbergSpectralCloud
     //       triangular version of SpectralCloud?
     psCtrl.schur = false;
     if( psCtrl.norm == PS_TWO_NORM )
-    {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( H, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( H, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( H, shifts, invNorms, psCtrl );
-    }
+        return pspec::TwoNorm( H, shifts, invNorms, psCtrl );
     else
     {
         // Force Q to be complex as cheaply as possible
@@ -316,17 +277,7 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
 
     psCtrl.schur = true;
     if( psCtrl.norm == PS_TWO_NORM )
-    {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( U, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( U, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( U, shifts, invNorms, psCtrl );
-    }
+        return pspec::TwoNorm( U, shifts, invNorms, psCtrl );
     else
         return pspec::HagerHigham( U, shifts, invNorms, psCtrl );
 }
@@ -374,17 +325,7 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
 
     psCtrl.schur = true;
     if( psCtrl.norm == PS_TWO_NORM )
-    {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( U, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( U, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( U, shifts, invNorms, psCtrl );
-    }
+        return pspec::TwoNorm( U, shifts, invNorms, psCtrl );
     else
     {
         // Force 'Q' to be complex and in a [MC,MR] distribution as cheaply
@@ -437,7 +378,7 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
-    return pspec::IRA( U, shifts, invNorms, psCtrl );
+    return pspec::TwoNorm( U, shifts, invNorms, psCtrl );
 }
 
 template<typename Real>
@@ -483,7 +424,7 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     psCtrl.schur = true;
     if( psCtrl.norm == PS_ONE_NORM )
         LogicError("This option is not yet written");
-    return pspec::IRA( U, shifts, invNorms, psCtrl );
+    return pspec::TwoNorm( U, shifts, invNorms, psCtrl );
 }
 
 template<typename Field>
@@ -509,17 +450,7 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     //       to TriangularSpectralCloud
     psCtrl.schur = false;
     if( psCtrl.norm == PS_TWO_NORM )
-    {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( H, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( H, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( H, shifts, invNorms, psCtrl );
-    }
+        return pspec::TwoNorm( H, shifts, invNorms, psCtrl );
     else
         return pspec::HagerHigham( H, shifts, invNorms, psCtrl );
 }
@@ -548,17 +479,7 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     //       to TriangularSpectralCloud
     psCtrl.schur = false;
     if( psCtrl.norm == PS_TWO_NORM )
-    {
-        if( psCtrl.arnoldi )
-        {
-            if( psCtrl.basisSize > 1 )
-                return pspec::IRA( H, shifts, invNorms, psCtrl );
-            else
-                return pspec::Lanczos( H, shifts, invNorms, psCtrl );
-        }
-        else
-            return pspec::Power( H, shifts, invNorms, psCtrl );
-    }
+        return pspec::TwoNorm( H, shifts, invNorms, psCtrl );
     else
     {
         // Force 'Q' to be complex and in a [MC,MR] distribution
@@ -0,0 +1,260 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_CHUNKED_HPP
+#define EL_PSEUDOSPECTRA_CHUNKED_HPP
+
+namespace El {
+namespace pspec {
+
+// The two-norm drivers iterate on all of their shifts in lock-step
+template<typename Real>
+Matrix<Int> TwoNormDriver
+( const Matrix<Complex<Real>>& U,
+  const Matrix<Complex<Real>>& shifts,
+        Matrix<Real>& invNorms,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    if( psCtrl.arnoldi )
+    {
+        if( psCtrl.basisSize > 1 )
+            return IRA( U, shifts, invNorms, psCtrl );
+        else
+            return Lanczos( U, shifts, invNorms, psCtrl );
+    }
+    else
+        return Power( U, shifts, invNorms, psCtrl );
+}
+
+template<typename Real>
+Matrix<Int> TwoNormDriver
+( const Matrix<Real>& U,
+  const Matrix<Complex<Real>>& shifts,
+        Matrix<Real>& invNorms,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    return IRA( U, shifts, invNorms, psCtrl );
+}
+
+template<typename Real>
+DistMatrix<Int,VR,STAR> TwoNormDriver
+( const DistMatrix<Complex<Real>>& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        AbstractDistMatrix<Real>& invNorms,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    if( psCtrl.arnoldi )
+    {
+        if( psCtrl.basisSize > 1 )
+            return IRA( U, shifts, invNorms, psCtrl );
+        else
+            return Lanczos( U, shifts, invNorms, psCtrl );
+    }
+    else
+        return Power( U, shifts, invNorms, psCtrl );
+}
+
+template<typename Real>
+DistMatrix<Int,VR,STAR> TwoNormDriver
+( const DistMatrix<Real>& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        AbstractDistMatrix<Real>& invNorms,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    return IRA( U, shifts, invNorms, psCtrl );
+}
+
+// Run the two-norm driver on chunks of psCtrl.shiftChunkSize shifts, each of
+// which is iterated (and deflated) independently. The chunks are dealt out
+// dynamically to the OpenMP threads so that a thread which finishes a quickly
+// converging chunk moves on to the remaining unconverged ones.
+template<typename F,typename Real>
+Matrix<Int> TwoNorm
+( const Matrix<F>& U,
+  const Matrix<Complex<Real>>& shifts,
+        Matrix<Real>& invNorms,
+        PseudospecCtrl<Real> psCtrl )
+{
+    EL_DEBUG_CSE
+    const Int numShifts = shifts.Height();
+    const Int chunkSize = psCtrl.shiftChunkSize;
+    if( chunkSize <= 0 )
+        return TwoNormDriver( U, shifts, invNorms, psCtrl );
+
+    const Int numChunks = (numShifts+chunkSize-1) / chunkSize;
+    Matrix<Int> itCounts( numShifts, 1 );
+    invNorms.Resize( numShifts, 1 );
+
+    // The snapshots are only meaningful for the full set of shifts
+    PseudospecCtrl<Real> chunkCtrl( psCtrl );
+    chunkCtrl.snapCtrl = SnapshotCtrl();
+    chunkCtrl.chunkCallback = nullptr;
+
+#ifdef EL_HYBRID
+    #pragma omp parallel for schedule(dynamic,1)
+#endif
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int first = chunk*chunkSize;
+        const Int last = Min(first+chunkSize,numShifts);
+        const IR chunkInd( first, last );
+        auto shiftsChunk = shifts( chunkInd, ALL );
+        Matrix<Real> invNormsChunk;
+        auto itCountsChunk =
+          TwoNormDriver( U, shiftsChunk, invNormsChunk, chunkCtrl );
+
+        auto invNormsDest = invNorms( chunkInd, ALL );
+        auto itCountsDest = itCounts( chunkInd, ALL );
+        invNormsDest = invNormsChunk;
+        itCountsDest = itCountsChunk;
+        if( psCtrl.chunkCallback )
+        {
+#ifdef EL_HYBRID
+            #pragma omp critical
+#endif
+            psCtrl.chunkCallback( first, invNormsChunk, itCountsChunk );
+        }
+    }
+    FinalSnapshot( invNorms, itCounts, psCtrl.snapCtrl );
+    return itCounts;
+}
+
+// Form the copy of the replicated matrix A owned by the grid of ATeam
+template<typename F>
+void TeamCopy( const DistMatrix<F,STAR,STAR>& A, DistMatrix<F>& ATeam )
+{
+    EL_DEBUG_CSE
+    ATeam.Resize( A.Height(), A.Width() );
+    const auto& ALoc = A.LockedMatrix();
+    auto& ATeamLoc = ATeam.Matrix();
+    const Int localHeight = ATeam.LocalHeight();
+    const Int localWidth = ATeam.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = ATeam.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            ATeamLoc(iLoc,jLoc) = ALoc(ATeam.GlobalRow(iLoc),j);
+    }
+}
+
+// The distributed analogue of the above, where the chunks of shifts are
+// dealt out cyclically to psCtrl.numShiftTeams teams of processes, each of
+// which holds its own copy of U. Within a team, the active shifts of a chunk
+// are redistributed over the process columns after each deflation.
+template<typename F,typename Real>
+DistMatrix<Int,VR,STAR> TwoNorm
+( const DistMatrix<F>& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        AbstractDistMatrix<Real>& invNorms,
+        PseudospecCtrl<Real> psCtrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& g = U.Grid();
+    const Int numShifts = shifts.Height();
+    const Int numTeams = Max( Min(psCtrl.numShiftTeams,Int(g.Size())), 1 );
+    Int chunkSize = psCtrl.shiftChunkSize;
+    if( chunkSize <= 0 )
+    {
+        if( numTeams == 1 )
+            return TwoNormDriver( U, shifts, invNorms, psCtrl );
+        chunkSize = Max( (numShifts+numTeams-1)/numTeams, Int(1) );
+    }
+    const Int numChunks = (numShifts+chunkSize-1) / chunkSize;
+
+    PseudospecCtrl<Real> chunkCtrl( psCtrl );
+    chunkCtrl.snapCtrl = SnapshotCtrl();
+    chunkCtrl.chunkCallback = nullptr;
+
+    // Each team is a contiguous range of the ranks of the grid; the teams
+    // receive a copy of U from a replica on every process
+    const int commRank = mpi::Rank( g.Comm() );
+    const int team = (Int(commRank)*numTeams) / g.Size();
+    unique_ptr<Grid> teamGrid;
+    DistMatrix<F> UTeamCopy;
+    if( numTeams > 1 )
+    {
+        mpi::Comm teamComm;
+        mpi::Split( g.Comm(), team, commRank, teamComm );
+        teamGrid.reset( new Grid(teamComm) );
+        mpi::Free( teamComm );
+
+        DistMatrix<F,STAR,STAR> U_STAR_STAR( U );
+        UTeamCopy.SetGrid( *teamGrid );
+        TeamCopy( U_STAR_STAR, UTeamCopy );
+    }
+    const DistMatrix<F>& UTeam = ( numTeams > 1 ? UTeamCopy : U );
+    const Grid& tg = UTeam.Grid();
+
+    DistMatrix<C,STAR,STAR> shifts_STAR_STAR( shifts );
+    const auto& shiftsLoc = shifts_STAR_STAR.LockedMatrix();
+
+    // Only the root of each team contributes to the (summed) results
+    const bool teamRoot = ( tg.Rank() == 0 );
+    Matrix<Real> invNormsLoc;
+    Matrix<Int> itCountsLoc;
+    Zeros( invNormsLoc, numShifts, 1 );
+    Zeros( itCountsLoc, numShifts, 1 );
+    for( Int chunk=team; chunk<numChunks; chunk+=numTeams )
+    {
+        const Int first = chunk*chunkSize;
+        const Int last = Min(first+chunkSize,numShifts);
+        const IR chunkInd( first, last );
+
+        DistMatrix<C,VR,STAR> shiftsChunk( last-first, 1, tg );
+        auto& shiftsChunkLoc = shiftsChunk.Matrix();
+        for( Int iLoc=0; iLoc<shiftsChunk.LocalHeight(); ++iLoc )
+            shiftsChunkLoc(iLoc) = shiftsLoc(first+shiftsChunk.GlobalRow(iLoc));
+
+        DistMatrix<Real,VR,STAR> invNormsChunk( tg );
+        auto itCountsChunk =
+          TwoNormDriver( UTeam, shiftsChunk, invNormsChunk, chunkCtrl );
+
+        DistMatrix<Real,STAR,STAR> invNormsChunk_STAR_STAR( invNormsChunk );
+        DistMatrix<Int,STAR,STAR> itCountsChunk_STAR_STAR( itCountsChunk );
+        if( teamRoot )
+        {
+            auto invNormsDest = invNormsLoc( chunkInd, ALL );
+            auto itCountsDest = itCountsLoc( chunkInd, ALL );
+            invNormsDest = invNormsChunk_STAR_STAR.LockedMatrix();
+            itCountsDest = itCountsChunk_STAR_STAR.LockedMatrix();
+        }
+        if( psCtrl.chunkCallback )
+            psCtrl.chunkCallback
+            ( first,
+              invNormsChunk_STAR_STAR.LockedMatrix(),
+              itCountsChunk_STAR_STAR.LockedMatrix() );
+    }
+    mpi::AllReduce( invNormsLoc.Buffer(), numShifts, mpi::SUM, g.Comm() );
+    mpi::AllReduce( itCountsLoc.Buffer(), numShifts, mpi::SUM, g.Comm() );
+
+    DistMatrix<Real,VR,STAR> invNormsVR( g );
+    DistMatrix<Int,VR,STAR> itCounts( g );
+    invNormsVR.AlignWith( shifts );
+    itCounts.AlignWith( shifts );
+    invNormsVR.Resize( numShifts, 1 );
+    itCounts.Resize( numShifts, 1 );
+    for( Int iLoc=0; iLoc<itCounts.LocalHeight(); ++iLoc )
+    {
+        const Int i = itCounts.GlobalRow(iLoc);
+        invNormsVR.SetLocal( iLoc, 0, invNormsLoc(i) );
+        itCounts.SetLocal( iLoc, 0, itCountsLoc(i) );
+    }
+    Copy( invNormsVR, invNorms );
+    FinalSnapshot( invNormsVR, itCounts, psCtrl.snapCtrl );
+    return itCounts;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_CHUNKED_HPP
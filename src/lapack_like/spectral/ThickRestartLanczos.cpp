@@ -0,0 +1,501 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// The basis vectors are stored as the local rows of a column-distributed
+// block (all of the rows for sequential matrices), so that inner products
+// only require a local Gemm followed by a summation over 'comm'.
+
+template<typename Field>
+Base<Field> GlobalNorm( const Matrix<Field>& W, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real localNorm = FrobeniusNorm( W );
+    Real normSquared = localNorm*localNorm;
+    normSquared = mpi::AllReduce( normSquared, comm );
+    return Sqrt( normSquared );
+}
+
+// W := (I - V V^H) W, with two passes of classical Gram-Schmidt, and
+// C := C + V^H W_orig
+template<typename Field>
+void ProjectOut
+( const Matrix<Field>& V,
+        Matrix<Field>& W,
+        Matrix<Field>& C,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    if( V.Width() == 0 )
+        return;
+    Matrix<Field> D;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), V, W, D );
+        AllReduce( D, comm );
+        Gemm( NORMAL, NORMAL, Field(-1), V, D, Field(1), W );
+        C += D;
+    }
+}
+
+template<typename Field>
+void RandomOrthonormalColumn
+( const Matrix<Field>& V,
+        Matrix<Field>& w,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Field> C;
+    while( true )
+    {
+        MakeGaussian( w );
+        Zeros( C, V.Width(), 1 );
+        ProjectOut( V, w, C, comm );
+        const Real norm = GlobalNorm( w, comm );
+        if( norm > Real(1)/2 )
+        {
+            w *= Real(1)/norm;
+            return;
+        }
+    }
+}
+
+// Orthonormalize W against the orthonormal columns of V and then against
+// itself, so that
+//
+//   W_orig = V H + W R,
+//
+// where R is upper-triangular. Columns of W which (numerically) lie in the
+// span of the previous vectors are replaced with random orthonormal vectors,
+// and the corresponding diagonal entries of R are set to zero.
+template<typename Field>
+void BlockOrthonormalize
+( const Matrix<Field>& V,
+        Matrix<Field>& W,
+        Matrix<Field>& H,
+        Matrix<Field>& R,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int b = W.Width();
+    Zeros( H, V.Width(), b );
+    Zeros( R, b, b );
+
+    vector<Real> origNorms( b );
+    for( Int j=0; j<b; ++j )
+        origNorms[j] = GlobalNorm( W(ALL,IR(j)), comm );
+    ProjectOut( V, W, H, comm );
+
+    // Attempt two passes of Cholesky QR, which are only used if the Gramian
+    // is comfortably positive-definite
+    bool blockSuccess = true;
+    Matrix<Field> G, S;
+    Identity( R, b, b );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Zeros( G, b, b );
+        Herk( UPPER, ADJOINT, Real(1), W, Real(0), G );
+        AllReduce( G, comm );
+        Real minDiag=limits::Max<Real>(), maxDiag=0;
+        for( Int j=0; j<b; ++j )
+        {
+            minDiag = Min( minDiag, RealPart(G(j,j)) );
+            maxDiag = Max( maxDiag, RealPart(G(j,j)) );
+        }
+        if( pass == 0 )
+        {
+            Real minOrigNorm = limits::Max<Real>();
+            for( Int j=0; j<b; ++j )
+                minOrigNorm = Min( minOrigNorm, origNorms[j] );
+            if( minDiag <= Sqrt(eps)*minOrigNorm*minOrigNorm )
+            {
+                blockSuccess = false;
+                break;
+            }
+        }
+        try { Cholesky( UPPER, G ); }
+        catch( std::exception& ) { blockSuccess = false; break; }
+        Real minPivot=limits::Max<Real>(), maxPivot=0;
+        for( Int j=0; j<b; ++j )
+        {
+            minPivot = Min( minPivot, RealPart(G(j,j)) );
+            maxPivot = Max( maxPivot, RealPart(G(j,j)) );
+        }
+        if( minPivot <= Pow(eps,Real(0.25))*maxPivot )
+        {
+            blockSuccess = false;
+            break;
+        }
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), G, W );
+        S = R;
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), G, S );
+        R = S;
+    }
+    if( blockSuccess )
+        return;
+
+    // Fall back to a column-by-column Gram-Schmidt process which can detect
+    // linear dependence (W has already been projected against V once)
+    Zeros( R, b, b );
+    Matrix<Field> HCol, RCol;
+    for( Int j=0; j<b; ++j )
+    {
+        auto w = W(ALL,IR(j));
+        auto WPrev = W(ALL,IR(0,j));
+        Zeros( HCol, V.Width(), 1 );
+        Zeros( RCol, j, 1 );
+        ProjectOut( V, w, HCol, comm );
+        ProjectOut( WPrev, w, RCol, comm );
+        auto hCol = H(ALL,IR(j));
+        hCol += HCol;
+        auto rCol = R(IR(0,j),IR(j));
+        rCol = RCol;
+
+        const Real norm = GlobalNorm( w, comm );
+        if( norm > Sqrt(eps)*origNorms[j] && norm > 0 )
+        {
+            R(j,j) = norm;
+            w *= Real(1)/norm;
+        }
+        else
+        {
+            Matrix<Field> VExt;
+            VExt.Resize( V.Height(), V.Width()+j );
+            auto VExtLeft = VExt(ALL,IR(0,V.Width()));
+            auto VExtRight = VExt(ALL,IR(V.Width(),END));
+            VExtLeft = V;
+            VExtRight = WPrev;
+            Matrix<Field> wRand( w.Height(), 1 );
+            RandomOrthonormalColumn( VExt, wRand, comm );
+            w = wRand;
+        }
+    }
+}
+
+// The Ritz values of the operator in the order of preference of the target
+template<typename Real>
+vector<Int> TargetOrder
+( const Matrix<Real>& theta, LanczosTarget target )
+{
+    EL_DEBUG_CSE
+    const Int m = theta.Height();
+    vector<Int> order( m );
+    for( Int j=0; j<m; ++j )
+        order[j] = j;
+    if( target == LANCZOS_SMALLEST )
+        std::stable_sort
+        ( order.begin(), order.end(),
+          [&]( Int i, Int j ) { return theta(i) < theta(j); } );
+    else if( target == LANCZOS_LARGEST )
+        std::stable_sort
+        ( order.begin(), order.end(),
+          [&]( Int i, Int j ) { return theta(i) > theta(j); } );
+    else
+        std::stable_sort
+        ( order.begin(), order.end(),
+          [&]( Int i, Int j ) { return Abs(theta(i)) > Abs(theta(j)); } );
+    return order;
+}
+
+// Run the thick-restart Lanczos process upon the Hermitian operator
+// 'applyOp', which maps the local rows of a block of vectors to the local
+// rows of the result, and return the wanted Ritz values and the local rows
+// of the corresponding Ritz vectors.
+template<typename Field,class ApplyOpType>
+Int ThickRestart
+(       Int n,
+        Int localHeight,
+  const ApplyOpType& applyOp,
+        mpi::Comm comm,
+        Matrix<Base<Field>>& theta,
+        Matrix<Field>& XLoc,
+  const ThickRestartLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int numEigs = ctrl.numEigs;
+    const Int b = ctrl.blockSize;
+    if( numEigs < 1 || b < 1 )
+        LogicError("Invalid number of eigenpairs or block size");
+    Int m = ctrl.basisSize;
+    if( m == 0 )
+        m = Max( 2*numEigs+b, Int(20) );
+    m = b*((m+b-1)/b);
+    // Leave room for the residual block
+    if( m+b > n )
+        m = b*((n-b)/b);
+    if( m < numEigs+b )
+        LogicError
+        ("Krylov basis size of ",m," is too small for ",numEigs,
+         " eigenpairs with a block size of ",b," (n=",n,")");
+    const bool progress = ctrl.progress && mpi::Rank(comm) == 0;
+
+    // The first m columns of V hold the basis and the last b columns hold the
+    // next block, which satisfies
+    //
+    //   Op V(:,0:m) = V(:,0:m) H + V(:,m:m+b) B E_m^H.
+    //
+    Matrix<Field> V, H, B;
+    Zeros( V, localHeight, m+b );
+    Zeros( H, m, m );
+    {
+        auto V0 = V(ALL,IR(0,b));
+        MakeGaussian( V0 );
+        Matrix<Field> HEmpty, R;
+        Matrix<Field> VEmpty( localHeight, 0 );
+        BlockOrthonormalize( VEmpty, V0, HEmpty, R, comm );
+    }
+
+    Matrix<Field> W, HCol, R, HColAdj, RAdj, HRitz, Y, YLast, BY, YKeep, VKeep;
+    Matrix<Real> thetaAll;
+    vector<Int> order;
+    Int k=0, numLocked=0, numConverged=0;
+    Real opNormEst=0;
+    for( Int restart=0; restart<=ctrl.maxRestarts; ++restart )
+    {
+        // Expand the basis from k to m vectors
+        for( Int j=k; j<m; j+=b )
+        {
+            auto VBasis = V(ALL,IR(0,j+b));
+            applyOp( V(ALL,IR(j,j+b)), W );
+            BlockOrthonormalize( VBasis, W, HCol, R, comm );
+            // Deflate the locked Ritz vectors
+            for( Int jCol=0; jCol<b; ++jCol )
+                for( Int i=0; i<numLocked; ++i )
+                    HCol(i,jCol) = 0;
+            // Keep H exactly Hermitian
+            auto HDiag = HCol(IR(j,j+b),ALL);
+            MakeHermitian( UPPER, HDiag );
+
+            auto HColBlock = H(IR(0,j+b),IR(j,j+b));
+            HColBlock = HCol;
+            Adjoint( HCol, HColAdj );
+            auto HRowBlock = H(IR(j,j+b),IR(0,j+b));
+            HRowBlock = HColAdj;
+
+            auto VNext = V(ALL,IR(j+b,j+2*b));
+            VNext = W;
+            if( j+b < m )
+            {
+                auto HSub = H(IR(j+b,j+2*b),IR(j,j+b));
+                HSub = R;
+                Adjoint( R, RAdj );
+                auto HSuper = H(IR(j,j+b),IR(j+b,j+2*b));
+                HSuper = RAdj;
+            }
+            else
+                B = R;
+        }
+
+        // Rayleigh-Ritz
+        HRitz = H;
+        HermitianEig( LOWER, HRitz, thetaAll, Y );
+        order = TargetOrder( thetaAll, ctrl.target );
+
+        // The residual norm of Ritz pair i is || B Y(m-b:m,i) ||_2, which is
+        // measured against the largest Ritz value seen so far (a lower bound
+        // on the two-norm of the operator) so that eigenvalues near zero can
+        // converge
+        for( Int i=0; i<m; ++i )
+            opNormEst = Max( opNormEst, Abs(thetaAll(i)) );
+        const Real thresh = ctrl.tol*opNormEst;
+        YLast = Y(IR(m-b,m),ALL);
+        Gemm( NORMAL, NORMAL, Field(1), B, YLast, BY );
+        numConverged = 0;
+        while( numConverged < numEigs )
+        {
+            const Int i = order[numConverged];
+            if( FrobeniusNorm(BY(ALL,IR(i))) > thresh )
+                break;
+            ++numConverged;
+        }
+        if( progress )
+            Output
+            ("Restart ",restart,": ",numConverged," of ",numEigs,
+             " eigenpairs converged");
+        if( numConverged == numEigs || restart == ctrl.maxRestarts )
+            break;
+
+        // Keep the most desirable Ritz vectors, leaving space for at least
+        // one new block
+        Int numKeep = Min( m-b, numEigs+(m-numEigs)/2 );
+        numKeep = m - b*Max( Int(1), (m-numKeep)/b );
+        Zeros( YKeep, m, numKeep );
+        for( Int jKeep=0; jKeep<numKeep; ++jKeep )
+        {
+            auto yKeep = YKeep(ALL,IR(jKeep));
+            yKeep = Y(ALL,IR(order[jKeep]));
+        }
+        Gemm( NORMAL, NORMAL, Field(1), V(ALL,IR(0,m)), YKeep, VKeep );
+        auto VKeepDest = V(ALL,IR(0,numKeep));
+        VKeepDest = VKeep;
+        {
+            auto VResid = V(ALL,IR(m,m+b));
+            auto VResidDest = V(ALL,IR(numKeep,numKeep+b));
+            VResidDest = VResid;
+        }
+        Zeros( H, m, m );
+        for( Int jKeep=0; jKeep<numKeep; ++jKeep )
+            H(jKeep,jKeep) = thetaAll(order[jKeep]);
+        k = numKeep;
+        numLocked = numConverged;
+    }
+
+    Zeros( theta, numEigs, 1 );
+    Zeros( YKeep, m, numEigs );
+    for( Int j=0; j<numEigs; ++j )
+    {
+        theta(j) = thetaAll(order[j]);
+        auto yKeep = YKeep(ALL,IR(j));
+        yKeep = Y(ALL,IR(order[j]));
+    }
+    Gemm( NORMAL, NORMAL, Field(1), V(ALL,IR(0,m)), YKeep, XLoc );
+    return numConverged;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+Int ThickRestartLanczos
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const ThickRestartLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    Int numConverged;
+    if( ctrl.target == LANCZOS_NEAREST_SHIFT )
+    {
+        SparseMatrix<Field> AShifted( A );
+        ShiftDiagonal( AShifted, Field(-ctrl.shift) );
+        SparseLDLFactorization<Field> sparseLDLFact;
+        const bool hermitian = true;
+        sparseLDLFact.Initialize( AShifted, hermitian );
+        sparseLDLFact.Factor( LDL_INTRAPIV_1D );
+        auto applyInverse =
+          [&]( const Matrix<Field>& Y, Matrix<Field>& Z )
+          {
+              Z = Y;
+              sparseLDLFact.Solve( Z );
+          };
+        numConverged = ThickRestart
+          ( n, n, applyInverse, mpi::COMM_SELF, w, X, ctrl );
+        // Map the Ritz values of (A - shift I)^{-1} back to those of A
+        for( Int j=0; j<w.Height(); ++j )
+            w(j) = ctrl.shift + Real(1)/w(j);
+    }
+    else
+    {
+        auto applyA =
+          [&]( const Matrix<Field>& Y, Matrix<Field>& Z )
+          {
+              Zeros( Z, n, Y.Width() );
+              Multiply( NORMAL, Field(1), A, Y, Field(0), Z );
+          };
+        numConverged = ThickRestart
+          ( n, n, applyA, mpi::COMM_SELF, w, X, ctrl );
+    }
+    return numConverged;
+}
+
+template<typename Field>
+Int ThickRestartLanczos
+( const DistSparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const ThickRestartLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+
+    // The block vectors are redistributed into the same row distribution as
+    // the (conforming) DistMultiVec's used by the sparse kernels
+    DistMultiVec<Field> YDist(grid), ZDist(grid);
+    YDist.Resize( n, 1 );
+    const Int localHeight = YDist.LocalHeight();
+
+    Int numConverged;
+    X.SetGrid( grid );
+    X.Resize( n, ctrl.numEigs );
+    if( ctrl.target == LANCZOS_NEAREST_SHIFT )
+    {
+        DistSparseMatrix<Field> AShifted( A );
+        ShiftDiagonal( AShifted, Field(-ctrl.shift) );
+        DistSparseLDLFactorization<Field> sparseLDLFact;
+        const bool hermitian = true;
+        sparseLDLFact.Initialize( AShifted, hermitian );
+        sparseLDLFact.Factor( LDL_INTRAPIV_1D );
+        auto applyInverse =
+          [&]( const Matrix<Field>& Y, Matrix<Field>& Z )
+          {
+              YDist.Resize( n, Y.Width() );
+              YDist.Matrix() = Y;
+              sparseLDLFact.Solve( YDist );
+              Z = YDist.Matrix();
+          };
+        numConverged = ThickRestart
+          ( n, localHeight, applyInverse, comm, w, X.Matrix(), ctrl );
+        for( Int j=0; j<w.Height(); ++j )
+            w(j) = ctrl.shift + Real(1)/w(j);
+    }
+    else
+    {
+        auto applyA =
+          [&]( const Matrix<Field>& Y, Matrix<Field>& Z )
+          {
+              YDist.Resize( n, Y.Width() );
+              YDist.Matrix() = Y;
+              Zeros( ZDist, n, Y.Width() );
+              Multiply( NORMAL, Field(1), A, YDist, Field(0), ZDist );
+              Z = ZDist.Matrix();
+          };
+        numConverged = ThickRestart
+          ( n, localHeight, applyA, comm, w, X.Matrix(), ctrl );
+    }
+    return numConverged;
+}
+
+#define PROTO(Field) \
+  template Int ThickRestartLanczos \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& X, \
+    const ThickRestartLanczosCtrl<Base<Field>>& ctrl ); \
+  template Int ThickRestartLanczos \
+  ( const DistSparseMatrix<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          DistMultiVec<Field>& X, \
+    const ThickRestartLanczosCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
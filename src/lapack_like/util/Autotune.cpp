@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// Returns the fastest time (over all processes in the grid) of several
+// repetitions of 'setup' followed by a timed 'run'
+template<typename SetupFunctor,typename RunFunctor>
+double TimeBest
+( const Grid& grid, Int numReps,
+  const SetupFunctor& setup, const RunFunctor& run )
+{
+    double bestTime = limits::Infinity<double>();
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        setup();
+        mpi::Barrier( grid.Comm() );
+        const double startTime = mpi::Time();
+        run();
+        mpi::Barrier( grid.Comm() );
+        bestTime = Min( bestTime, mpi::Time()-startTime );
+    }
+    // Ensure that every process makes the same decision
+    return mpi::AllReduce( bestTime, mpi::MAX, grid.Comm() );
+}
+
+template<typename Field,typename SetupFunctor,typename RunFunctor>
+void TuneBlocksize
+( const string& routine, const Grid& grid, const AutotuneCtrl& ctrl,
+  const SetupFunctor& setup, const RunFunctor& run )
+{
+    EL_DEBUG_CSE
+    if( ctrl.blocksizes.empty() )
+        LogicError("No candidate blocksizes were provided");
+    Int bestBlocksize = ctrl.blocksizes[0];
+    double bestTime = limits::Infinity<double>();
+    for( const Int blocksize : ctrl.blocksizes )
+    {
+        // Explicitly pushed blocksizes take precedence over tuned values
+        PushBlocksizeStack( blocksize );
+        const double time = TimeBest( grid, ctrl.numReps, setup, run );
+        PopBlocksizeStack();
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output(routine," with blocksize ",blocksize,": ",time," seconds");
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestBlocksize = blocksize;
+        }
+    }
+    SetTunedBlocksize
+    ( routine, TypeName<Field>(), grid.Height(), grid.Width(), bestBlocksize );
+}
+
+// Returns the smallest candidate weight, w, such that the 'challenger'
+// variant is faster than the 'incumbent' for products whose inner dimension
+// is w times the outer dimensions. If no such weight exists, twice the
+// largest candidate is returned.
+template<typename Field>
+double TuneGemmWeight
+( const string& name, const Grid& grid, const AutotuneCtrl& ctrl,
+  GemmAlgorithm incumbent, GemmAlgorithm challenger )
+{
+    EL_DEBUG_CSE
+    const Int s = ctrl.gemmSize;
+    DistMatrix<Field> A(grid), B(grid), C(grid);
+    double maxWeight = 1;
+    for( const double weight : ctrl.gemmWeights )
+    {
+        maxWeight = Max( maxWeight, weight );
+        const Int k = Max( Int(weight*s), Int(1) );
+        Uniform( A, s, k );
+        Uniform( B, k, s );
+        auto setup = [&]() { Zeros( C, s, s ); };
+        auto runWith = [&]( GemmAlgorithm alg )
+          { return [&,alg]()
+            { Gemm( NORMAL, NORMAL, Field(1), A, B, Field(0), C, alg ); }; };
+        const double incumbentTime =
+          TimeBest( grid, ctrl.numReps, setup, runWith(incumbent) );
+        const double challengerTime =
+          TimeBest( grid, ctrl.numReps, setup, runWith(challenger) );
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output
+            (name," with weight ",weight,": ",incumbentTime," vs. ",
+             challengerTime," seconds");
+        if( challengerTime < incumbentTime )
+            return weight;
+    }
+    return 2*maxWeight;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void Autotune( const Grid& grid, const AutotuneCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = ctrl.factorSize;
+    const string typeName = TypeName<Field>();
+    DistMatrix<Field> A(grid), AOrig(grid);
+
+    // A diagonally-dominant Hermitian matrix is positive-definite
+    Uniform( AOrig, n, n );
+    MakeHermitian( LOWER, AOrig );
+    ShiftDiagonal( AOrig, Field(n) );
+    auto setup = [&]() { A = AOrig; };
+
+    TuneBlocksize<Field>
+    ( "Cholesky", grid, ctrl, setup, [&]() { Cholesky( LOWER, A ); } );
+
+    DistPermutation P(grid);
+    TuneBlocksize<Field>
+    ( "LU", grid, ctrl, setup, [&]() { LU( A, P ); } );
+
+    DistMatrix<Field,MD,STAR> householderScalars(grid);
+    DistMatrix<Base<Field>,MD,STAR> signature(grid);
+    TuneBlocksize<Field>
+    ( "QR", grid, ctrl, setup,
+      [&]() { QR( A, householderScalars, signature ); } );
+
+    // Products with a large inner dimension favor keeping the smaller of
+    // A and B stationary, and, eventually, forming the result via dot
+    // products
+    const double weightTowardsC =
+      TuneGemmWeight<Field>
+      ( "GemmWeightTowardsC", grid, ctrl, GEMM_SUMMA_C, GEMM_SUMMA_B );
+    SetTunedParameter
+    ( "GemmWeightTowardsC", typeName, grid.Height(), grid.Width(),
+      weightTowardsC );
+    const double weightAwayFromDot =
+      TuneGemmWeight<Field>
+      ( "GemmWeightAwayFromDot", grid, ctrl, GEMM_SUMMA_B, GEMM_SUMMA_DOT );
+    SetTunedParameter
+    ( "GemmWeightAwayFromDot", typeName, grid.Height(), grid.Width(),
+      Max(weightAwayFromDot,weightTowardsC) );
+}
+
+#define PROTO(Field) \
+  template void Autotune<Field>( const Grid& grid, const AutotuneCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -12,12 +12,71 @@
 
 #ifdef EL_HAVE_PARMETIS
 # include "parmetis.h"
-#else
+#elif defined(EL_HAVE_METIS)
 # include "metis.h"
 #endif
 
 namespace El {
 
+namespace {
+
+// Computes a vertex separator of the given (self-connection free) adjacency
+// structure, with 'part' set to 0 or 1 for the two halves and 2 for the
+// separator
+void SequentialSeparator
+( const vector<Int>& xAdj,
+  const vector<Int>& adjacency,
+        vector<Int>& part,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSources = xAdj.size()-1;
+#ifdef EL_HAVE_METIS
+    if( ctrl.useMETIS )
+    {
+        if( xAdj[numSources] == 0 )
+        {
+            // METIS does not handle graphs without edges
+            part.resize( numSources );
+            for( Int i=0; i<numSources; ++i )
+                part[i] = ( i <= numSources/2 ? 0 : 1 );
+            return;
+        }
+
+        // Since idx_t might be different than Int
+        vector<idx_t> xAdj_idx_t( xAdj.begin(), xAdj.end() );
+        vector<idx_t> adjacency_idx_t( adjacency.begin(), adjacency.end() );
+
+        // Call METIS_ComputeVertexSeparator, which is meant for ParMETIS
+        idx_t nvtxs = numSources;
+        idx_t options[METIS_NOPTIONS];
+        METIS_SetDefaultOptions( options );
+        options[METIS_OPTION_NSEPS] = ctrl.numSeqSeps;
+        vector<idx_t> part_idx_t(numSources);
+        idx_t sepSize;
+        METIS_ComputeVertexSeparator
+        ( &nvtxs, xAdj_idx_t.data(), adjacency_idx_t.data(), NULL, options,
+          &sepSize, part_idx_t.data() );
+        part.assign( part_idx_t.begin(), part_idx_t.end() );
+        return;
+    }
+#endif
+    MultilevelSeparator( xAdj, adjacency, part, ctrl );
+}
+
+// Whether the separators are computed by (Par)METIS rather than by the
+// built-in multilevel engine
+bool UseMETIS( const BisectCtrl& ctrl )
+{
+#ifdef EL_HAVE_METIS
+    return ctrl.useMETIS;
+#else
+    return false;
+#endif
+}
+
+} // anonymous namespace
+
 Int Bisect
 ( const Graph& graph,
   Graph& leftChild,
@@ -26,9 +85,9 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
-#ifdef EL_HAVE_METIS
-    // METIS assumes that there are no self-connections or connections 
-    // outside the sources, so we must manually remove them from our graph
+    // The separator engines assume that there are no self-connections or
+    // connections outside the sources, so we must manually remove them from
+    // our graph
     const Int numSources = graph.NumSources();
     const Int numEdges = graph.NumEdges();
     const Int* sourceBuf = graph.LockedSourceBuffer();
@@ -39,8 +98,8 @@ Int Bisect
             ++numValidEdges;
 
     // Fill our connectivity (ignoring self and too-large connections)
-    vector<idx_t> xAdj( numSources+1 );
-    vector<idx_t> adjacency( Max(numValidEdges,1) );
+    vector<Int> xAdj( numSources+1 );
+    vector<Int> adjacency( Max(numValidEdges,1) );
     Int validCounter=0;
     Int sourceOff=0;
     Int prevSource=-1;
@@ -63,16 +122,8 @@ Int Bisect
     while( sourceOff <= numSources)
     { xAdj[sourceOff++] = validCounter; }
 
-    // Call METIS_ComputeVertexSeparator, which is meant to be used by ParMETIS
-    idx_t nvtxs = numSources;
-    idx_t options[METIS_NOPTIONS];
-    METIS_SetDefaultOptions( options );
-    options[METIS_OPTION_NSEPS] = ctrl.numSeqSeps;
-    vector<idx_t> part(numSources);
-    idx_t sepSize;
-    METIS_ComputeVertexSeparator
-    ( &nvtxs, xAdj.data(), adjacency.data(), NULL, options, 
-      &sepSize, part.data() );
+    vector<Int> part;
+    SequentialSeparator( xAdj, adjacency, part, ctrl );
     
     Int sizes[3] = { 0, 0, 0 };
     for( Int s=0; s<numSources; ++s ) 
@@ -89,10 +140,6 @@ Int Bisect
     BuildChildrenFromPerm
     ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
     return sizes[2];
-#else
-    LogicError("METIS interface was not available");
-    return -1;
-#endif
 }
 
 Int Bisect
@@ -104,7 +151,6 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
-#ifdef EL_HAVE_METIS
     const Grid& grid = graph.Grid();
     const int commSize = grid.Size();
     const int commRank = grid.Rank();
@@ -113,8 +159,9 @@ Int Bisect
         ("This routine assumes at least two processes are used, "
          "otherwise one child will be lost");
 
-    // (Par)METIS assumes that there are no self-connections or connections 
-    // outside the sources, so we must manually remove them from our graph
+    // The separator engines assume that there are no self-connections or
+    // connections outside the sources, so we must manually remove them from
+    // our graph
     const Int numSources = graph.NumSources();
     const Int numLocalEdges = graph.NumLocalEdges();
     const Int* sourceBuf = graph.LockedSourceBuffer();
@@ -128,8 +175,8 @@ Int Bisect
     const Int blocksize = graph.Blocksize();
     const Int numLocalSources = graph.NumLocalSources();
     const Int firstLocalSource = graph.FirstLocalSource();
-    vector<idx_t> xAdj( numLocalSources+1 );
-    vector<idx_t> adjacency( Max(numLocalValidEdges,1) );
+    vector<Int> xAdj( numLocalSources+1 );
+    vector<Int> adjacency( Max(numLocalValidEdges,1) );
     Int validCounter=0;
     Int sourceOff=0;
     Int prevSource=firstLocalSource-1;
@@ -152,9 +199,72 @@ Int Bisect
     while( sourceOff <= numLocalSources)
     { xAdj[sourceOff++] = validCounter; }
 
-    vector<idx_t> sizes(3);
-    if( ctrl.sequential )
+    vector<Int> sizes(3);
+#ifdef EL_HAVE_PARMETIS
+    if( !ctrl.sequential && ctrl.useMETIS )
     {
+        // Describe the source distribution
+        vector<idx_t> vtxDist( commSize+1 );
+        for( int i=0; i<commSize; ++i )
+            vtxDist[i] = i*blocksize;
+        vtxDist[commSize] = graph.NumSources();
+
+        // Create space for the result
+        perm.SetGrid( grid );
+        perm.Resize( numSources );
+
+        // Since idx_t might be different than Int
+        vector<idx_t> xAdj_idx_t( xAdj.begin(), xAdj.end() );
+        vector<idx_t> adjacency_idx_t( adjacency.begin(), adjacency.end() );
+
+        vector<idx_t> perm_idx_t( perm.NumLocalSources() );
+        vector<idx_t> sizes_idx_t( 3 );
+        // Use the custom ParMETIS interface
+        idx_t nseqseps = ctrl.numSeqSeps;
+        idx_t nparseps = ctrl.numDistSeps;
+        real_t imbalance = ctrl.maxImbalance;
+        mpi::Comm comm = grid.Comm();
+        ParMETIS_ComputeVertexSeparator
+        ( vtxDist.data(), xAdj_idx_t.data(), adjacency_idx_t.data(),
+          &nparseps, &nseqseps, &imbalance, NULL, perm_idx_t.data(),
+          sizes_idx_t.data(), &comm.comm );
+
+        std::copy( perm_idx_t.begin(), perm_idx_t.end(), perm.Buffer() );
+        std::copy( sizes_idx_t.begin(), sizes_idx_t.end(), sizes.begin() );
+    }
+    else
+#endif
+    if( !UseMETIS(ctrl) )
+    {
+        // The built-in engine only gathers the coarsest graph
+        adjacency.resize( validCounter );
+        vector<Int> part;
+        MultilevelSeparator
+        ( xAdj, adjacency, firstLocalSource, numSources, part, grid.Comm(),
+          ctrl );
+
+        Int localSizes[3] = { 0, 0, 0 };
+        for( Int s=0; s<numLocalSources; ++s )
+            ++localSizes[part[s]];
+        Int offsets[3];
+        for( Int j=0; j<3; ++j )
+            offsets[j] = mpi::Scan( localSizes[j], grid.Comm() ) -
+                         localSizes[j];
+        mpi::AllReduce( localSizes, 3, grid.Comm() );
+        offsets[1] += localSizes[0];
+        offsets[2] += localSizes[0] + localSizes[1];
+        for( Int j=0; j<3; ++j )
+            sizes[j] = localSizes[j];
+
+        perm.SetGrid( grid );
+        perm.Resize( numSources );
+        for( Int s=0; s<numLocalSources; ++s )
+            perm.SetLocal( s, offsets[part[s]]++ );
+    }
+    else
+    {
+        // Without ParMETIS, METIS bisects the graph on the root process
+
         // Gather the number of local valid edges on the root process
         vector<Int> edgeSizes( commSize ), edgeOffs;
         mpi::AllGather
@@ -171,7 +281,7 @@ Int Bisect
         for( int q=0; q<commSize; ++q )
             maxLocalValidEdges = Max( maxLocalValidEdges, edgeSizes[q] );
         adjacency.resize( Max(maxLocalValidEdges,1) );
-        vector<idx_t> globalAdj;
+        vector<Int> globalAdj;
         if( commRank == 0 )
             globalAdj.resize( maxLocalValidEdges*commSize, 0 );
         mpi::Gather
@@ -191,7 +301,7 @@ Int Bisect
         }
 
         // Set up the global xAdj vector
-        vector<idx_t> globalXAdj;
+        vector<Int> globalXAdj;
         if( commRank == 0 )
             globalXAdj.resize( numSources+1 );
         // For now, simply loop over the processes for the receives
@@ -223,31 +333,8 @@ Int Bisect
         vector<Int> seqPerm;
         if( commRank == 0 )
         {
-            // Call METIS_ComputeVertexSeparator, which is meant for ParMETIS
-            idx_t nvtxs = numSources;
-            idx_t options[METIS_NOPTIONS];
-            METIS_SetDefaultOptions( options );
-            options[METIS_OPTION_NSEPS] = ctrl.numSeqSeps;
-            vector<idx_t> part(numSources);
-            idx_t sepSize;
-
-            if( globalAdj.size() > 0 )
-            {
-                METIS_ComputeVertexSeparator
-                ( &nvtxs, globalXAdj.data(), globalAdj.data(), NULL, options,
-                  &sepSize, part.data() );
-            } 
-            else
-            {
-                sepSize = 0;
-                for( Int i=0; i<numSources; ++i )
-                {
-                    if( i <= numSources/2 )
-                        part[i] = 0;
-                    else
-                        part[i] = 1;
-                } 
-            }
+            vector<Int> part;
+            SequentialSeparator( globalXAdj, globalAdj, part, ctrl );
 
             for( Int j=0; j<3; ++j )
                 sizes[j] = 0;
@@ -285,47 +372,12 @@ Int Bisect
         }
 
         // Broadcast the sizes information from the root
-        mpi::Broadcast
-        ( reinterpret_cast<byte*>(sizes.data()), 3*sizeof(idx_t), 0,
-          grid.Comm() );
-    }
-    else
-    {
-#ifdef EL_HAVE_PARMETIS
-        // Describe the source distribution
-        vector<idx_t> vtxDist( commSize+1 );
-        for( int i=0; i<commSize; ++i )
-            vtxDist[i] = i*blocksize;
-        vtxDist[commSize] = graph.NumSources();
-
-        // Create space for the result
-        perm.SetGrid( grid );
-        perm.Resize( numSources );
-
-        vector<idx_t> perm_idx_t( perm.NumLocalSources() );
-        // Use the custom ParMETIS interface
-        idx_t nseqseps = ctrl.numSeqSeps;
-        idx_t nparseps = ctrl.numDistSeps;
-        real_t imbalance = 1.1;
-        mpi::Comm comm = grid.Comm();
-        ParMETIS_ComputeVertexSeparator
-        ( vtxDist.data(), xAdj.data(), adjacency.data(), &nparseps, &nseqseps, 
-          &imbalance, NULL, perm_idx_t.data(), sizes.data(), &comm.comm );
-
-        // Since idx_t might be different than Int
-        std::copy( perm_idx_t.begin(), perm_idx_t.end(), perm.Buffer() );
-#else
-        LogicError("ParMETIS was not available");
-#endif
+        mpi::Broadcast( sizes.data(), 3, 0, grid.Comm() );
     }
     EL_DEBUG_ONLY(EnsurePermutation( perm ))
     BuildChildFromPerm
     ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child );
     return sizes[2];
-#else
-    LogicError("METIS was not available");
-    return -1;
-#endif
 }
 
 void EnsurePermutation( const vector<Int>& map )
@@ -0,0 +1,1074 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <queue>
+#include <tuple>
+
+// A self-contained multilevel vertex-separator engine in the spirit of
+// METIS's node bisection:
+//
+//  1. The graph is repeatedly coarsened via (randomized) heavy-edge matching,
+//  2. the coarsest graph is split via greedy graph growing followed by
+//     Fiduccia-Mattheyses (FM) refinement of the edge cut, and the cut edges
+//     are then covered by a greedily-chosen vertex separator, and
+//  3. the separator is projected back through each level and improved using
+//     the vertex-separator variant of FM refinement.
+//
+// As with METIS, the graph is assumed to be symmetric and free of
+// self-connections. The parameters of each phase are members of BisectCtrl.
+//
+// Distributed graphs are first coarsened in parallel, with each process only
+// matching the vertices it owns, until the graph is small enough to be
+// gathered onto the root process and split with the sequential engine. The
+// separator is then projected back and refined in parallel.
+
+namespace El {
+
+namespace {
+
+struct MultilevelGraph
+{
+    Int numVertices=0;
+    Int totalWeight=0;
+    vector<Int> offsets;
+    vector<Int> targets;
+    vector<Int> edgeWeights;
+    vector<Int> vertexWeights;
+};
+
+// A lazily-updated max-heap of (gain,vertex) pairs: stale entries are
+// discarded when they reach the top
+typedef std::priority_queue<std::pair<Int,Int>> GainHeap;
+
+void RandomOrder( Int n, std::mt19937& gen, vector<Int>& order )
+{
+    order.resize( n );
+    for( Int i=0; i<n; ++i )
+        order[i] = i;
+    std::shuffle( order.begin(), order.end(), gen );
+}
+
+bool Coarsen
+( const MultilevelGraph& fine,
+        MultilevelGraph& coarse,
+        vector<Int>& coarseMap,
+        std::mt19937& gen,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = fine.numVertices;
+
+    // Avoid forming coarse vertices so heavy that balance becomes impossible
+    const Int maxVertexWeight =
+      Max( Int(1), Int(1.5*fine.totalWeight/ctrl.coarsenTarget) );
+
+    // Visit the vertices in a random order and match each with the unmatched
+    // neighbor it shares the heaviest edge with
+    vector<Int> order;
+    RandomOrder( n, gen, order );
+    vector<Int> match( n, -1 );
+    for( const Int v : order )
+    {
+        if( match[v] != -1 )
+            continue;
+        Int best=v, bestWeight=-1;
+        for( Int e=fine.offsets[v]; e<fine.offsets[v+1]; ++e )
+        {
+            const Int u = fine.targets[e];
+            if( match[u] == -1 && u != v && fine.edgeWeights[e] > bestWeight &&
+                fine.vertexWeights[v]+fine.vertexWeights[u] <= maxVertexWeight )
+            {
+                best = u;
+                bestWeight = fine.edgeWeights[e];
+            }
+        }
+        match[v] = best;
+        match[best] = v;
+    }
+
+    // Number the coarse vertices in the order of their first fine vertex
+    coarseMap.assign( n, -1 );
+    Int numCoarse = 0;
+    for( Int v=0; v<n; ++v )
+    {
+        if( coarseMap[v] == -1 )
+        {
+            coarseMap[v] = numCoarse;
+            coarseMap[match[v]] = numCoarse;
+            ++numCoarse;
+        }
+    }
+    if( numCoarse > ctrl.coarsenRatio*n )
+        return false;
+
+    // Form the coarse graph, merging parallel edges
+    coarse.numVertices = numCoarse;
+    coarse.totalWeight = fine.totalWeight;
+    coarse.offsets.resize( numCoarse+1 );
+    coarse.vertexWeights.resize( numCoarse );
+    coarse.targets.clear();
+    coarse.edgeWeights.clear();
+    coarse.targets.reserve( fine.targets.size() );
+    coarse.edgeWeights.reserve( fine.targets.size() );
+    vector<Int> position( numCoarse, -1 );
+    for( Int v=0; v<n; ++v )
+    {
+        const Int u = match[v];
+        if( u < v )
+            continue;
+        const Int c = coarseMap[v];
+        const Int start = coarse.targets.size();
+        coarse.offsets[c] = start;
+        coarse.vertexWeights[c] = fine.vertexWeights[v];
+        if( u != v )
+            coarse.vertexWeights[c] += fine.vertexWeights[u];
+        for( const Int w : { v, u } )
+        {
+            for( Int e=fine.offsets[w]; e<fine.offsets[w+1]; ++e )
+            {
+                const Int cTarget = coarseMap[fine.targets[e]];
+                if( cTarget == c )
+                    continue;
+                if( position[cTarget] == -1 )
+                {
+                    position[cTarget] = coarse.targets.size();
+                    coarse.targets.push_back( cTarget );
+                    coarse.edgeWeights.push_back( fine.edgeWeights[e] );
+                }
+                else
+                {
+                    const Int pos = position[cTarget];
+                    coarse.edgeWeights[pos] += fine.edgeWeights[e];
+                }
+            }
+            if( u == v )
+                break;
+        }
+        const Int end = coarse.targets.size();
+        for( Int e=start; e<end; ++e )
+            position[coarse.targets[e]] = -1;
+    }
+    coarse.offsets[numCoarse] = coarse.targets.size();
+    return true;
+}
+
+// Grow part 0 from a random seed vertex, always absorbing the vertex which
+// most decreases the edge cut, until it holds half of the weight
+void GrowBisection
+( const MultilevelGraph& graph, vector<Int>& part, std::mt19937& gen )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.numVertices;
+    part.assign( n, 1 );
+
+    // The decrease in the edge cut from moving each vertex into part 0
+    vector<Int> gain( n, 0 );
+    for( Int v=0; v<n; ++v )
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            gain[v] -= graph.edgeWeights[e];
+
+    vector<Int> order;
+    RandomOrder( n, gen, order );
+    Int nextSeed = 0;
+
+    GainHeap heap;
+    const Int targetWeight = graph.totalWeight / 2;
+    Int weight = 0;
+    while( weight < targetWeight )
+    {
+        Int v = -1;
+        while( !heap.empty() )
+        {
+            const auto top = heap.top();
+            heap.pop();
+            if( part[top.second] == 1 && gain[top.second] == top.first )
+            {
+                v = top.second;
+                break;
+            }
+        }
+        if( v == -1 )
+        {
+            // Start a new region (the graph is disconnected)
+            while( nextSeed < n && part[order[nextSeed]] != 1 )
+                ++nextSeed;
+            if( nextSeed == n )
+                break;
+            v = order[nextSeed];
+        }
+
+        // Stop if absorbing this vertex would overshoot by more than
+        // stopping short
+        const Int vWeight = graph.vertexWeights[v];
+        if( weight > 0 && weight+vWeight-targetWeight > targetWeight-weight )
+            break;
+
+        part[v] = 0;
+        weight += vWeight;
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            const Int u = graph.targets[e];
+            if( part[u] == 1 )
+            {
+                gain[u] += 2*graph.edgeWeights[e];
+                heap.push( std::make_pair(gain[u],u) );
+            }
+        }
+    }
+}
+
+Int EdgeCut( const MultilevelGraph& graph, const vector<Int>& part )
+{
+    Int cut = 0;
+    for( Int v=0; v<graph.numVertices; ++v )
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            if( part[graph.targets[e]] != part[v] )
+                cut += graph.edgeWeights[e];
+    return cut/2;
+}
+
+// Returns the amount by which the heavier half exceeds its allowance
+Int Overweight( Int weight0, Int weight1, double maxImbalance )
+{
+    const Int allowed = Int(maxImbalance*(weight0+weight1)/2);
+    return Max( Max(weight0,weight1)-allowed, Int(0) );
+}
+
+// Fiduccia-Mattheyses refinement of a two-way edge cut
+void RefineEdgeBisection
+( const MultilevelGraph& graph, vector<Int>& part, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.numVertices;
+    const Int maxStall = Max( Int(50), n/50 );
+    vector<Int> gain( n );
+    vector<char> locked( n );
+    vector<Int> moves;
+    for( Int pass=0; pass<ctrl.maxRefinePasses; ++pass )
+    {
+        Int weights[2] = { 0, 0 };
+        GainHeap heaps[2];
+        for( Int v=0; v<n; ++v )
+        {
+            weights[part[v]] += graph.vertexWeights[v];
+            gain[v] = 0;
+            bool boundary = false;
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                if( part[graph.targets[e]] != part[v] )
+                {
+                    gain[v] += graph.edgeWeights[e];
+                    boundary = true;
+                }
+                else
+                    gain[v] -= graph.edgeWeights[e];
+            }
+            if( boundary )
+                heaps[part[v]].push( std::make_pair(gain[v],v) );
+        }
+        std::fill( locked.begin(), locked.end(), 0 );
+        moves.resize( 0 );
+
+        auto peek = [&]( Int side )
+        {
+            auto& heap = heaps[side];
+            while( !heap.empty() )
+            {
+                const auto top = heap.top();
+                const Int v = top.second;
+                if( !locked[v] && part[v] == side && gain[v] == top.first )
+                    return v;
+                heap.pop();
+            }
+            return Int(-1);
+        };
+
+        Int cut = EdgeCut( graph, part );
+        Int bestOverweight =
+          Overweight( weights[0], weights[1], ctrl.maxImbalance );
+        Int bestCut = cut;
+        Int bestImbalance = Abs( weights[0]-weights[1] );
+        Int numBestMoves = 0;
+        Int stall = 0;
+        while( stall < maxStall )
+        {
+            // Choose the highest-gain move which does not worsen the balance
+            // beyond the allowance
+            Int v = -1;
+            for( Int side=0; side<2; ++side )
+            {
+                const Int u = peek( side );
+                if( u == -1 )
+                    continue;
+                const Int uWeight = graph.vertexWeights[u];
+                const Int newSource = weights[side]-uWeight;
+                const Int newDest = weights[1-side]+uWeight;
+                if( Overweight(newSource,newDest,ctrl.maxImbalance) > 0 &&
+                    newDest >= weights[side] )
+                    continue;
+                if( v == -1 || gain[u] > gain[v] )
+                    v = u;
+            }
+            if( v == -1 )
+                break;
+
+            const Int side = part[v];
+            heaps[side].pop();
+            part[v] = 1-side;
+            locked[v] = 1;
+            moves.push_back( v );
+            weights[side] -= graph.vertexWeights[v];
+            weights[1-side] += graph.vertexWeights[v];
+            cut -= gain[v];
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                const Int u = graph.targets[e];
+                if( part[u] == part[v] )
+                    gain[u] -= 2*graph.edgeWeights[e];
+                else
+                    gain[u] += 2*graph.edgeWeights[e];
+                if( !locked[u] )
+                    heaps[part[u]].push( std::make_pair(gain[u],u) );
+            }
+
+            const Int overweight =
+              Overweight( weights[0], weights[1], ctrl.maxImbalance );
+            const Int imbalance = Abs( weights[0]-weights[1] );
+            if( std::make_tuple(overweight,cut,imbalance) <
+                std::make_tuple(bestOverweight,bestCut,bestImbalance) )
+            {
+                bestOverweight = overweight;
+                bestCut = cut;
+                bestImbalance = imbalance;
+                numBestMoves = moves.size();
+                stall = 0;
+            }
+            else
+                ++stall;
+        }
+
+        // Roll back the moves made after the best state
+        for( Int k=moves.size()-1; k>=numBestMoves; --k )
+            part[moves[k]] = 1-part[moves[k]];
+        if( numBestMoves == 0 )
+            break;
+    }
+}
+
+// Greedily cover the cut edges of a two-way partition with vertices,
+// preferring those incident to the most uncovered cut edges
+void EdgeToVertexSeparator( const MultilevelGraph& graph, vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.numVertices;
+    vector<Int> cutDegree( n, 0 );
+    GainHeap heap;
+    for( Int v=0; v<n; ++v )
+    {
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            if( part[graph.targets[e]] != part[v] )
+                ++cutDegree[v];
+        if( cutDegree[v] > 0 )
+            heap.push( std::make_pair(cutDegree[v],v) );
+    }
+    while( !heap.empty() )
+    {
+        const auto top = heap.top();
+        heap.pop();
+        const Int v = top.second;
+        if( part[v] == 2 || cutDegree[v] != top.first || cutDegree[v] == 0 )
+            continue;
+        const Int side = part[v];
+        part[v] = 2;
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            const Int u = graph.targets[e];
+            if( part[u] == 1-side )
+            {
+                --cutDegree[u];
+                if( cutDegree[u] > 0 )
+                    heap.push( std::make_pair(cutDegree[u],u) );
+            }
+        }
+    }
+}
+
+// Fiduccia-Mattheyses refinement of a vertex separator: moving a separator
+// vertex into one half pulls its neighbors from the other half into the
+// separator, and the gain of the move is the resulting decrease in the
+// separator weight
+void RefineSeparator
+( const MultilevelGraph& graph, vector<Int>& part, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = graph.numVertices;
+    const Int maxStall = Max( Int(50), n/50 );
+    vector<Int> gains[2] = { vector<Int>(n), vector<Int>(n) };
+    vector<char> locked( n );
+    vector<std::pair<Int,Int>> log;
+    vector<Int> touched;
+
+    auto computeGains = [&]( Int v )
+    {
+        gains[0][v] = gains[1][v] = graph.vertexWeights[v];
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            const Int u = graph.targets[e];
+            if( part[u] != 2 )
+                gains[1-part[u]][v] -= graph.vertexWeights[u];
+        }
+    };
+
+    for( Int pass=0; pass<ctrl.maxRefinePasses; ++pass )
+    {
+        Int weights[3] = { 0, 0, 0 };
+        GainHeap heaps[2];
+        for( Int v=0; v<n; ++v )
+        {
+            weights[part[v]] += graph.vertexWeights[v];
+            if( part[v] == 2 )
+            {
+                computeGains( v );
+                heaps[0].push( std::make_pair(gains[0][v],v) );
+                heaps[1].push( std::make_pair(gains[1][v],v) );
+            }
+        }
+        std::fill( locked.begin(), locked.end(), 0 );
+        log.resize( 0 );
+
+        auto peek = [&]( Int side )
+        {
+            auto& heap = heaps[side];
+            while( !heap.empty() )
+            {
+                const auto top = heap.top();
+                const Int v = top.second;
+                if( !locked[v] && part[v] == 2 && gains[side][v] == top.first )
+                    return v;
+                heap.pop();
+            }
+            return Int(-1);
+        };
+
+        Int bestOverweight =
+          Overweight( weights[0], weights[1], ctrl.maxImbalance );
+        Int bestSepWeight = weights[2];
+        Int bestImbalance = Abs( weights[0]-weights[1] );
+        Int bestLogSize = 0;
+        Int stall = 0;
+        while( stall < maxStall )
+        {
+            // Choose the highest-gain move which does not worsen the balance
+            // beyond the allowance, preferring moves into the lighter half
+            Int v=-1, side=-1;
+            for( Int s=0; s<2; ++s )
+            {
+                const Int u = peek( s );
+                if( u == -1 )
+                    continue;
+                const Int uWeight = graph.vertexWeights[u];
+                const Int pulledWeight = uWeight - gains[s][u];
+                const Int newDest = weights[s] + uWeight;
+                const Int newOther = weights[1-s] - pulledWeight;
+                if( Overweight(newDest,newOther,ctrl.maxImbalance) > 0 &&
+                    newDest > weights[1-s] )
+                    continue;
+                if( v == -1 || gains[s][u] > gains[side][v] ||
+                    (gains[s][u] == gains[side][v] &&
+                     weights[s] < weights[side]) )
+                {
+                    v = u;
+                    side = s;
+                }
+            }
+            if( v == -1 )
+                break;
+
+            // Move v into 'side' and pull its neighbors from the other half
+            // into the separator
+            heaps[side].pop();
+            locked[v] = 1;
+            log.push_back( std::make_pair(v,Int(2)) );
+            part[v] = side;
+            weights[2] -= graph.vertexWeights[v];
+            weights[side] += graph.vertexWeights[v];
+            touched.resize( 0 );
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                const Int u = graph.targets[e];
+                if( part[u] == 2 )
+                {
+                    touched.push_back( u );
+                }
+                else if( part[u] == 1-side )
+                {
+                    log.push_back( std::make_pair(u,1-side) );
+                    part[u] = 2;
+                    weights[1-side] -= graph.vertexWeights[u];
+                    weights[2] += graph.vertexWeights[u];
+                    touched.push_back( u );
+                    for( Int f=graph.offsets[u]; f<graph.offsets[u+1]; ++f )
+                        if( part[graph.targets[f]] == 2 )
+                            touched.push_back( graph.targets[f] );
+                }
+            }
+            for( const Int u : touched )
+            {
+                if( locked[u] || part[u] != 2 )
+                    continue;
+                computeGains( u );
+                heaps[0].push( std::make_pair(gains[0][u],u) );
+                heaps[1].push( std::make_pair(gains[1][u],u) );
+            }
+
+            const Int overweight =
+              Overweight( weights[0], weights[1], ctrl.maxImbalance );
+            const Int imbalance = Abs( weights[0]-weights[1] );
+            if( std::make_tuple(overweight,weights[2],imbalance) <
+                std::make_tuple(bestOverweight,bestSepWeight,bestImbalance) )
+            {
+                bestOverweight = overweight;
+                bestSepWeight = weights[2];
+                bestImbalance = imbalance;
+                bestLogSize = log.size();
+                stall = 0;
+            }
+            else
+                ++stall;
+        }
+
+        // Roll back the changes made after the best state
+        for( Int k=log.size()-1; k>=bestLogSize; --k )
+            part[log[k].first] = log[k].second;
+        if( bestLogSize == 0 )
+            break;
+    }
+}
+
+// Returns the (overweight,separator weight,imbalance) triplet used to rank
+// candidate separators
+std::tuple<Int,Int,Int>
+SeparatorQuality
+( const MultilevelGraph& graph, const vector<Int>& part,
+  const BisectCtrl& ctrl )
+{
+    Int weights[3] = { 0, 0, 0 };
+    for( Int v=0; v<graph.numVertices; ++v )
+        weights[part[v]] += graph.vertexWeights[v];
+    return std::make_tuple
+      ( Overweight(weights[0],weights[1],ctrl.maxImbalance), weights[2],
+        Abs(weights[0]-weights[1]) );
+}
+
+void MultilevelSeparator
+( const MultilevelGraph& graph, vector<Int>& part, std::mt19937& gen,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    // Coarsen
+    vector<unique_ptr<MultilevelGraph>> levels;
+    vector<vector<Int>> coarseMaps;
+    const MultilevelGraph* current = &graph;
+    while( current->numVertices > ctrl.coarsenTarget )
+    {
+        unique_ptr<MultilevelGraph> coarse( new MultilevelGraph );
+        vector<Int> coarseMap;
+        if( !Coarsen( *current, *coarse, coarseMap, gen, ctrl ) )
+            break;
+        levels.emplace_back( std::move(coarse) );
+        coarseMaps.emplace_back( std::move(coarseMap) );
+        current = levels.back().get();
+    }
+
+    // Partition the coarsest graph, keeping the best of several growths
+    vector<Int> trialPart;
+    for( Int trial=0; trial<Max(ctrl.numGrowTrials,Int(1)); ++trial )
+    {
+        GrowBisection( *current, trialPart, gen );
+        RefineEdgeBisection( *current, trialPart, ctrl );
+        EdgeToVertexSeparator( *current, trialPart );
+        RefineSeparator( *current, trialPart, ctrl );
+        if( trial == 0 ||
+            SeparatorQuality(*current,trialPart,ctrl) <
+            SeparatorQuality(*current,part,ctrl) )
+            part = trialPart;
+    }
+
+    // Project the separator back to the original graph, refining as we go
+    for( Int level=levels.size()-1; level>=0; --level )
+    {
+        const MultilevelGraph& fine = ( level == 0 ? graph : *levels[level-1] );
+        const auto& coarseMap = coarseMaps[level];
+        vector<Int> finePart( fine.numVertices );
+        for( Int v=0; v<fine.numVertices; ++v )
+            finePart[v] = part[coarseMap[v]];
+        part = std::move( finePart );
+        RefineSeparator( fine, part, ctrl );
+    }
+}
+
+// The best of 'ctrl.numSeqSeps' independent multilevel separators
+void BestSeparator
+( const MultilevelGraph& graph, vector<Int>& part, std::mt19937& gen,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    vector<Int> trialPart;
+    for( Int trial=0; trial<Max(ctrl.numSeqSeps,Int(1)); ++trial )
+    {
+        MultilevelSeparator( graph, trialPart, gen, ctrl );
+        if( trial == 0 ||
+            SeparatorQuality(graph,trialPart,ctrl) <
+            SeparatorQuality(graph,part,ctrl) )
+            part = trialPart;
+    }
+}
+
+// Distributed graphs
+// ==================
+
+// The local portion of a graph whose vertices are distributed in contiguous
+// blocks, with adjacencies in terms of global vertex indices
+struct DistMultilevelGraph
+{
+    // Process q owns the vertices [vtxDist[q],vtxDist[q+1])
+    vector<Int> vtxDist;
+    Int totalWeight=0;
+    Int firstLocal=0, numLocal=0;
+    vector<Int> offsets;
+    vector<Int> targets;
+    vector<Int> edgeWeights;
+    vector<Int> vertexWeights;
+
+    Int NumVertices() const { return vtxDist.back(); }
+    bool IsLocal( Int v ) const
+    { return v >= firstLocal && v < firstLocal+numLocal; }
+};
+
+// Fetches the values associated with the nonlocal neighbors (ghosts) of the
+// local vertices from their owners
+struct GhostExchange
+{
+    // The sorted global indices of the ghosts
+    vector<Int> ghosts;
+    // The local vertices whose values the other processes request
+    vector<Int> requested;
+    vector<int> ghostSizes, ghostOffs, requestedSizes, requestedOffs;
+
+    void Setup( const DistMultilevelGraph& graph, mpi::Comm comm )
+    {
+        EL_DEBUG_CSE
+        const int commSize = mpi::Size( comm );
+        ghosts.resize( 0 );
+        for( const Int v : graph.targets )
+            if( !graph.IsLocal(v) )
+                ghosts.push_back( v );
+        std::sort( ghosts.begin(), ghosts.end() );
+        ghosts.erase
+        ( std::unique( ghosts.begin(), ghosts.end() ), ghosts.end() );
+
+        // Since the ghosts are sorted, those of each owner are contiguous
+        ghostSizes.assign( commSize, 0 );
+        for( const Int v : ghosts )
+        {
+            const int owner =
+              std::upper_bound
+              ( graph.vtxDist.begin(), graph.vtxDist.end(), v ) -
+              graph.vtxDist.begin() - 1;
+            ++ghostSizes[owner];
+        }
+        requestedSizes.resize( commSize );
+        mpi::AllToAll
+        ( ghostSizes.data(), 1, requestedSizes.data(), 1, comm );
+        Scan( ghostSizes, ghostOffs );
+        const int numRequested = Scan( requestedSizes, requestedOffs );
+        requested.resize( numRequested );
+        mpi::AllToAll
+        ( ghosts.data(), ghostSizes.data(), ghostOffs.data(),
+          requested.data(), requestedSizes.data(), requestedOffs.data(),
+          comm );
+        for( Int& v : requested )
+            v -= graph.firstLocal;
+    }
+
+    // Given the values of the local vertices, return those of the ghosts
+    void Fetch
+    ( const vector<Int>& localValues, vector<Int>& ghostValues,
+      mpi::Comm comm ) const
+    {
+        EL_DEBUG_CSE
+        vector<Int> sendValues( requested.size() );
+        for( size_t i=0; i<requested.size(); ++i )
+            sendValues[i] = localValues[requested[i]];
+        ghostValues.resize( ghosts.size() );
+        mpi::AllToAll
+        ( sendValues.data(), requestedSizes.data(), requestedOffs.data(),
+          ghostValues.data(), ghostSizes.data(), ghostOffs.data(), comm );
+    }
+
+    // The value of a (local or ghost) vertex
+    Int Value
+    ( const DistMultilevelGraph& graph, Int v,
+      const vector<Int>& localValues, const vector<Int>& ghostValues ) const
+    {
+        if( graph.IsLocal(v) )
+            return localValues[v-graph.firstLocal];
+        const Int index =
+          std::lower_bound( ghosts.begin(), ghosts.end(), v ) -
+          ghosts.begin();
+        return ghostValues[index];
+    }
+};
+
+// Coarsen via heavy-edge matching restricted to pairs of vertices owned by
+// the same process, so that each coarse vertex has a single owner. The local
+// coarse vertices are numbered in the order of their first fine vertex.
+bool Coarsen
+( const DistMultilevelGraph& fine,
+  const GhostExchange& exchange,
+        DistMultilevelGraph& coarse,
+        vector<Int>& coarseMap,
+        std::mt19937& gen,
+        mpi::Comm comm,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int n = fine.numLocal;
+    const Int maxVertexWeight =
+      Max( Int(1), Int(1.5*fine.totalWeight/ctrl.coarsenTarget) );
+
+    vector<Int> order;
+    RandomOrder( n, gen, order );
+    vector<Int> match( n, -1 );
+    for( const Int v : order )
+    {
+        if( match[v] != -1 )
+            continue;
+        Int best=v, bestWeight=-1;
+        for( Int e=fine.offsets[v]; e<fine.offsets[v+1]; ++e )
+        {
+            if( !fine.IsLocal(fine.targets[e]) )
+                continue;
+            const Int u = fine.targets[e] - fine.firstLocal;
+            if( match[u] == -1 && u != v && fine.edgeWeights[e] > bestWeight &&
+                fine.vertexWeights[v]+fine.vertexWeights[u] <= maxVertexWeight )
+            {
+                best = u;
+                bestWeight = fine.edgeWeights[e];
+            }
+        }
+        match[v] = best;
+        match[best] = v;
+    }
+
+    coarseMap.assign( n, -1 );
+    Int numCoarseLocal = 0;
+    for( Int v=0; v<n; ++v )
+    {
+        if( coarseMap[v] == -1 )
+        {
+            coarseMap[v] = numCoarseLocal;
+            coarseMap[match[v]] = numCoarseLocal;
+            ++numCoarseLocal;
+        }
+    }
+    vector<Int> numCoarseLocals( commSize );
+    mpi::AllGather( &numCoarseLocal, 1, numCoarseLocals.data(), 1, comm );
+    coarse.vtxDist.resize( commSize+1 );
+    coarse.vtxDist[0] = 0;
+    for( int q=0; q<commSize; ++q )
+        coarse.vtxDist[q+1] = coarse.vtxDist[q] + numCoarseLocals[q];
+    if( coarse.NumVertices() > ctrl.coarsenRatio*fine.NumVertices() )
+        return false;
+    coarse.totalWeight = fine.totalWeight;
+    coarse.firstLocal = coarse.vtxDist[commRank];
+    coarse.numLocal = numCoarseLocal;
+
+    // The global coarse indices of the local and ghost vertices
+    vector<Int> globalCoarseMap( n ), ghostCoarseMap;
+    for( Int v=0; v<n; ++v )
+        globalCoarseMap[v] = coarse.firstLocal + coarseMap[v];
+    exchange.Fetch( globalCoarseMap, ghostCoarseMap, comm );
+
+    // Form the local coarse adjacencies, merging parallel edges
+    coarse.offsets.resize( numCoarseLocal+1 );
+    coarse.vertexWeights.resize( numCoarseLocal );
+    coarse.targets.clear();
+    coarse.edgeWeights.clear();
+    coarse.targets.reserve( fine.targets.size() );
+    coarse.edgeWeights.reserve( fine.targets.size() );
+    vector<std::pair<Int,Int>> edges;
+    for( Int v=0; v<n; ++v )
+    {
+        const Int u = match[v];
+        if( u < v )
+            continue;
+        const Int c = coarseMap[v];
+        coarse.offsets[c] = coarse.targets.size();
+        coarse.vertexWeights[c] = fine.vertexWeights[v];
+        if( u != v )
+            coarse.vertexWeights[c] += fine.vertexWeights[u];
+        edges.resize( 0 );
+        for( const Int w : { v, u } )
+        {
+            for( Int e=fine.offsets[w]; e<fine.offsets[w+1]; ++e )
+            {
+                const Int cTarget =
+                  exchange.Value
+                  ( fine, fine.targets[e], globalCoarseMap, ghostCoarseMap );
+                if( cTarget != coarse.firstLocal+c )
+                    edges.emplace_back( cTarget, fine.edgeWeights[e] );
+            }
+            if( u == v )
+                break;
+        }
+        std::sort( edges.begin(), edges.end() );
+        for( size_t k=0; k<edges.size(); ++k )
+        {
+            if( k > 0 && edges[k].first == edges[k-1].first )
+                coarse.edgeWeights.back() += edges[k].second;
+            else
+            {
+                coarse.targets.push_back( edges[k].first );
+                coarse.edgeWeights.push_back( edges[k].second );
+            }
+        }
+    }
+    coarse.offsets[numCoarseLocal] = coarse.targets.size();
+    return true;
+}
+
+// Gather a (coarse) distributed graph onto the root process
+void GatherGraph
+( const DistMultilevelGraph& distGraph, MultilevelGraph& graph,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numLocal = distGraph.numLocal;
+    const Int numLocalEdges = distGraph.targets.size();
+
+    vector<int> vertexSizes( commSize ), vertexOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        vertexSizes[q] = distGraph.vtxDist[q+1] - distGraph.vtxDist[q];
+        vertexOffs[q] = distGraph.vtxDist[q];
+    }
+    vector<Int> numLocalEdgesList( commSize );
+    mpi::AllGather( &numLocalEdges, 1, numLocalEdgesList.data(), 1, comm );
+    vector<int> edgeSizes( commSize ), edgeOffs;
+    for( int q=0; q<commSize; ++q )
+        edgeSizes[q] = numLocalEdgesList[q];
+    const Int numEdges = Scan( edgeSizes, edgeOffs );
+
+    vector<Int> degrees( numLocal ), allDegrees;
+    for( Int v=0; v<numLocal; ++v )
+        degrees[v] = distGraph.offsets[v+1] - distGraph.offsets[v];
+    const Int numVertices = distGraph.NumVertices();
+    if( commRank == 0 )
+    {
+        graph.numVertices = numVertices;
+        graph.totalWeight = distGraph.totalWeight;
+        graph.offsets.resize( numVertices+1 );
+        graph.vertexWeights.resize( numVertices );
+        graph.targets.resize( numEdges );
+        graph.edgeWeights.resize( numEdges );
+        allDegrees.resize( numVertices );
+    }
+    mpi::Gather
+    ( degrees.data(), numLocal, allDegrees.data(),
+      vertexSizes.data(), vertexOffs.data(), 0, comm );
+    mpi::Gather
+    ( distGraph.vertexWeights.data(), numLocal, graph.vertexWeights.data(),
+      vertexSizes.data(), vertexOffs.data(), 0, comm );
+    mpi::Gather
+    ( distGraph.targets.data(), numLocalEdges, graph.targets.data(),
+      edgeSizes.data(), edgeOffs.data(), 0, comm );
+    mpi::Gather
+    ( distGraph.edgeWeights.data(), numLocalEdges, graph.edgeWeights.data(),
+      edgeSizes.data(), edgeOffs.data(), 0, comm );
+    if( commRank == 0 )
+    {
+        graph.offsets[0] = 0;
+        for( Int v=0; v<numVertices; ++v )
+            graph.offsets[v+1] = graph.offsets[v] + allDegrees[v];
+    }
+}
+
+// Shrink a vertex separator by moving each separator vertex without
+// neighbors in one half into that half. All of the (simultaneous) moves of a
+// sweep are into the same half so that they cannot connect the two halves,
+// and each process may only use its share of the growth which the balance
+// constraint allows.
+void RefineSeparator
+( const DistMultilevelGraph& graph,
+  const GhostExchange& exchange,
+        vector<Int>& part,
+        mpi::Comm comm,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    vector<Int> ghostPart;
+    for( Int pass=0; pass<ctrl.maxRefinePasses; ++pass )
+    {
+        Int movedWeight = 0;
+        for( Int sweep=0; sweep<2; ++sweep )
+        {
+            Int weights[3] = { 0, 0, 0 };
+            for( Int v=0; v<graph.numLocal; ++v )
+                weights[part[v]] += graph.vertexWeights[v];
+            mpi::AllReduce( weights, 3, comm );
+
+            // Grow the lighter half first
+            const bool lighterFirst = ( weights[0] <= weights[1] );
+            const Int side = ( lighterFirst == (sweep == 0) ? 0 : 1 );
+            const Int allowed =
+              Int(ctrl.maxImbalance*(weights[0]+weights[1])/2);
+            Int budget = Max( allowed-weights[side], Int(0) ) / commSize;
+
+            exchange.Fetch( part, ghostPart, comm );
+            for( Int v=0; v<graph.numLocal; ++v )
+            {
+                const Int vWeight = graph.vertexWeights[v];
+                if( part[v] != 2 || vWeight > budget )
+                    continue;
+                bool touchesOther = false;
+                for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+                {
+                    const Int uPart =
+                      exchange.Value
+                      ( graph, graph.targets[e], part, ghostPart );
+                    if( uPart == 1-side )
+                    {
+                        touchesOther = true;
+                        break;
+                    }
+                }
+                if( !touchesOther )
+                {
+                    part[v] = side;
+                    budget -= vWeight;
+                    movedWeight += vWeight;
+                }
+            }
+        }
+        if( mpi::AllReduce( movedWeight, comm ) == 0 )
+            break;
+    }
+}
+
+} // anonymous namespace
+
+void MultilevelSeparator
+( const vector<Int>& offsets,
+  const vector<Int>& targets,
+        vector<Int>& part,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSources = offsets.size()-1;
+    MultilevelGraph graph;
+    graph.numVertices = numSources;
+    graph.totalWeight = numSources;
+    graph.offsets = offsets;
+    graph.targets = targets;
+    graph.targets.resize( offsets[numSources] );
+    graph.edgeWeights.assign( offsets[numSources], 1 );
+    graph.vertexWeights.assign( numSources, 1 );
+
+    std::mt19937 gen( ctrl.seed );
+    BestSeparator( graph, part, gen, ctrl );
+}
+
+void MultilevelSeparator
+( const vector<Int>& localOffsets,
+  const vector<Int>& localTargets,
+        Int firstLocalSource,
+        Int numSources,
+        vector<Int>& localPart,
+        mpi::Comm comm,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numLocalSources = localOffsets.size()-1;
+
+    typedef std::pair<DistMultilevelGraph,GhostExchange> Level;
+    vector<unique_ptr<Level>> levels;
+    levels.emplace_back( new Level );
+    {
+        DistMultilevelGraph& graph = levels.back()->first;
+        graph.vtxDist.resize( commSize+1 );
+        mpi::AllGather
+        ( &firstLocalSource, 1, graph.vtxDist.data(), 1, comm );
+        graph.vtxDist[commSize] = numSources;
+        graph.totalWeight = numSources;
+        graph.firstLocal = firstLocalSource;
+        graph.numLocal = numLocalSources;
+        graph.offsets = localOffsets;
+        graph.targets = localTargets;
+        graph.targets.resize( localOffsets[numLocalSources] );
+        graph.edgeWeights.assign( localOffsets[numLocalSources], 1 );
+        graph.vertexWeights.assign( numLocalSources, 1 );
+        levels.back()->second.Setup( graph, comm );
+    }
+
+    // Coarsen in parallel until the graph is no larger than the average
+    // local portion of the original graph (or coarsening stalls)
+    std::mt19937 gen( ctrl.seed+commRank );
+    const Int gatherTarget = Max( ctrl.coarsenTarget, numSources/commSize );
+    vector<vector<Int>> coarseMaps;
+    while( levels.back()->first.NumVertices() > gatherTarget )
+    {
+        unique_ptr<Level> coarse( new Level );
+        vector<Int> coarseMap;
+        if( !Coarsen
+            ( levels.back()->first, levels.back()->second, coarse->first,
+              coarseMap, gen, comm, ctrl ) )
+            break;
+        coarse->second.Setup( coarse->first, comm );
+        levels.emplace_back( std::move(coarse) );
+        coarseMaps.emplace_back( std::move(coarseMap) );
+    }
+
+    // Split the coarsest graph on the root process and broadcast the result
+    const DistMultilevelGraph& coarsest = levels.back()->first;
+    MultilevelGraph gatheredGraph;
+    GatherGraph( coarsest, gatheredGraph, comm );
+    vector<Int> gatheredPart( coarsest.NumVertices() );
+    if( commRank == 0 )
+    {
+        std::mt19937 rootGen( ctrl.seed );
+        BestSeparator( gatheredGraph, gatheredPart, rootGen, ctrl );
+    }
+    mpi::Broadcast( gatheredPart.data(), gatheredPart.size(), 0, comm );
+    localPart.assign
+    ( gatheredPart.begin()+coarsest.firstLocal,
+      gatheredPart.begin()+coarsest.firstLocal+coarsest.numLocal );
+
+    // Project the separator back to the original graph, refining as we go
+    for( Int level=coarseMaps.size()-1; level>=0; --level )
+    {
+        const auto& coarseMap = coarseMaps[level];
+        vector<Int> finePart( coarseMap.size() );
+        for( size_t v=0; v<coarseMap.size(); ++v )
+            finePart[v] = localPart[coarseMap[v]];
+        localPart = std::move( finePart );
+        RefineSeparator
+        ( levels[level]->first, levels[level]->second, localPart, comm, ctrl );
+    }
+}
+
+} // namespace El
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterFill.hpp"
+
 namespace El {
 
 template<typename T>
@@ -30,14 +32,26 @@ void Bernoulli( Matrix<T>& A, Int m, Int n, double p )
     EntrywiseFill( A, function<T()>(doubleCoin) );
 }
 
+namespace {
+
 template<typename T>
-void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
+EnableIf<IsBlasScalar<T>>
+DistBernoulli( AbstractDistMatrix<T>& A, double p )
+{
+    const double q = 1-p;
+    auto doubleCoin = [=]( const RandomKey& key, Int i, Int j ) -> T
+    {
+        const double alpha = CounterSampleUniform<double>( key, i, j );
+        if( alpha < q ) return T(0);
+        else            return T(1);
+    };
+    CounterFill( A, doubleCoin );
+}
+
+template<typename T>
+DisableIf<IsBlasScalar<T>>
+DistBernoulli( AbstractDistMatrix<T>& A, double p )
 {
-    EL_DEBUG_CSE
-    if( p < 0. || p > 1. )
-        LogicError
-        ("Invalid choice of parameter p for Bernoulli distribution: ",p);
-    A.Resize( m, n );
     const double q = 1-p;
     auto doubleCoin = [=]() -> T
     {
@@ -48,6 +62,19 @@ void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
     EntrywiseFill( A, function<T()>(doubleCoin) );
 }
 
+} // anonymous namespace
+
+template<typename T>
+void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
+{
+    EL_DEBUG_CSE
+    if( p < 0. || p > 1. )
+        LogicError
+        ("Invalid choice of parameter p for Bernoulli distribution: ",p);
+    A.Resize( m, n );
+    DistBernoulli( A, p );
+}
+
 #define PROTO(T) \
   template void Bernoulli( Matrix<T>& A, Int m, Int n, double p ); \
   template void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p );
@@ -0,0 +1,58 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_RANDOM_INDEPENDENT_COUNTERFILL_HPP
+#define EL_MATRICES_RANDOM_INDEPENDENT_COUNTERFILL_HPP
+
+namespace El {
+
+// Fill each local entry of A with sample(key,i,j), where (i,j) are the global
+// indices of the entry and key is a fresh counter-based stream. Since each
+// entry only depends upon the key and its indices, every process (including
+// each redundant copy) generates its own entries without communication, and
+// the result is independent of the distribution and the process grid.
+//
+// NOTE: All processes in the viewing communicator of the grid must call this
+// routine, as the root of that communicator draws the key and broadcasts it.
+// Processes which have filled different sequences of matrices (e.g., on
+// different subgrids) therefore still agree upon the key.
+template<typename T,class SampleFunctor>
+void CounterFill( AbstractDistMatrix<T>& A, const SampleFunctor& sample )
+{
+    EL_DEBUG_CSE
+    mpi::Comm viewingComm = A.Grid().ViewingComm();
+    RandomKey key;
+    if( mpi::Rank(viewingComm) == 0 )
+        key = NewRandomStream();
+    mpi::Broadcast( key.word, 2, 0, viewingComm );
+    if( !A.Participating() )
+        return;
+
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<Int> globalRows( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    const Int* globalRowBuf = globalRows.data();
+
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        T* ACol = &ABuf[jLoc*ALDim];
+        EL_SIMD
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            ACol[iLoc] = sample( key, globalRowBuf[iLoc], j );
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_MATRICES_RANDOM_INDEPENDENT_COUNTERFILL_HPP
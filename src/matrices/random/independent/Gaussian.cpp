@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterFill.hpp"
+
 namespace El {
 
 // Draw each entry from a normal PDF
@@ -21,15 +23,37 @@ void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
 
+namespace {
+
+// Standard floating-point entries are drawn from counter-based streams so that
+// the result is reproducible across distributions and process grids
 template<typename F>
-void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+EnableIf<IsBlasScalar<F>>
+DistGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{
+    auto sampleNormal = [=]( const RandomKey& key, Int i, Int j )
+      { return CounterSampleNormal( key, i, j, mean, stddev ); };
+    CounterFill( A, sampleNormal );
+}
+
+template<typename F>
+DisableIf<IsBlasScalar<F>>
+DistGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
-    EL_DEBUG_CSE
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
 }
 
+} // anonymous namespace
+
+template<typename F>
+void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{
+    EL_DEBUG_CSE
+    DistGaussian( A, mean, stddev );
+}
+
 template<typename F>
 void MakeGaussian( DistMultiVec<F>& A, F mean, Base<F> stddev )
 {
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterFill.hpp"
+
 namespace El {
 
 template<typename T>
@@ -27,16 +29,41 @@ void ThreeValued( Matrix<T>& A, Int m, Int n, double p )
     EntrywiseFill( A, function<T()>(tripleCoin) );
 }
 
+namespace {
+
 template<typename T>
-void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p )
+EnableIf<IsBlasScalar<T>>
+DistThreeValued( AbstractDistMatrix<T>& A, double p )
+{
+    auto tripleCoin = [=]( const RandomKey& key, Int i, Int j ) -> T
+    {
+        const double alpha = CounterSampleUniform<double>( key, i, j );
+        if( alpha < p/2 ) return T(-1);
+        else if( alpha < p ) return T(1);
+        else return T(0);
+    };
+    CounterFill( A, tripleCoin );
+}
+
+template<typename T>
+DisableIf<IsBlasScalar<T>>
+DistThreeValued( AbstractDistMatrix<T>& A, double p )
 {
-    EL_DEBUG_CSE
-    A.Resize( m, n );
     if( A.RedundantRank() == 0 )
         ThreeValued( A.Matrix(), A.LocalHeight(), A.LocalWidth(), p );
     Broadcast( A, A.RedundantComm(), 0 );
 }
 
+} // anonymous namespace
+
+template<typename T>
+void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p )
+{
+    EL_DEBUG_CSE
+    A.Resize( m, n );
+    DistThreeValued( A, p );
+}
+
 #define PROTO(T) \
   template void ThreeValued \
   ( Matrix<T>& A, Int m, Int n, double p ); \
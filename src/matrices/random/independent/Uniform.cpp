@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterFill.hpp"
+
 namespace El {
 
 // Draw each entry from a uniform PDF over a closed ball.
@@ -30,15 +32,35 @@ void Uniform( Matrix<T>& A, Int m, Int n, T center, Base<T> radius )
     MakeUniform( A, center, radius );
 }
 
+namespace {
+
 template<typename T>
-void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+EnableIf<IsBlasScalar<T>>
+DistUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{
+    auto sampleBall = [=]( const RandomKey& key, Int i, Int j )
+      { return CounterSampleBall( key, i, j, center, radius ); };
+    CounterFill( A, sampleBall );
+}
+
+template<typename T>
+DisableIf<IsBlasScalar<T>>
+DistUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
-    EL_DEBUG_CSE
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
 }
 
+} // anonymous namespace
+
+template<typename T>
+void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{
+    EL_DEBUG_CSE
+    DistUniform( A, center, radius );
+}
+
 template<typename T>
 void Uniform( AbstractDistMatrix<T>& A, Int m, Int n, T center, Base<T> radius )
 {
@@ -59,7 +59,7 @@ void ADMM
     const Real tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    Matrix<Field> E, Y;
+    Matrix<Field> E, Y, LBasis;
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -90,7 +90,10 @@ void ADMM
         L -= S;
         Axpy( Field(1)/beta, Y, L );
         Int rank;
-        if( ctrl.usePivQR )
+        if( ctrl.useRandomizedSVT )
+            rank = svt::Randomized
+            ( L, Real(1)/beta, LBasis, ctrl.randomizedSVTCtrl );
+        else if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
         else
             rank = SVT( L, Real(1)/beta );
@@ -165,7 +168,7 @@ void ADMM
     const Real tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    DistMatrix<Field> E( M.Grid() ), Y( M.Grid() );
+    DistMatrix<Field> E( M.Grid() ), Y( M.Grid() ), LBasis( M.Grid() );
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -196,7 +199,10 @@ void ADMM
         L -= S;
         Axpy( Field(1)/beta, Y, L );
         Int rank;
-        if( ctrl.usePivQR )
+        if( ctrl.useRandomizedSVT )
+            rank = svt::Randomized
+            ( L, Real(1)/beta, LBasis, ctrl.randomizedSVTCtrl );
+        else if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
         else
             rank = SVT( L, Real(1)/beta );
@@ -285,7 +291,7 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    Matrix<Field> LLast, SLast, E;
+    Matrix<Field> LLast, SLast, E, LBasis;
     while( true )
     {
         ++numIts;
@@ -309,7 +315,10 @@ void ALM
             L = M;
             L -= S;
             Axpy( Field(1)/beta, Y, L );
-            if( ctrl.usePivQR )
+            if( ctrl.useRandomizedSVT )
+                rank = svt::Randomized
+                ( L, Real(1)/beta, LBasis, ctrl.randomizedSVTCtrl );
+            else if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
             else
                 rank = SVT( L, Real(1)/beta );
@@ -434,7 +443,8 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    DistMatrix<Field> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() );
+    DistMatrix<Field> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() ),
+      LBasis( M.Grid() );
     while( true )
     {
         ++numIts;
@@ -458,7 +468,10 @@ void ALM
             L = M;
             L -= S;
             Axpy( Field(1)/beta, Y, L );
-            if( ctrl.usePivQR )
+            if( ctrl.useRandomizedSVT )
+                rank = svt::Randomized
+                ( L, Real(1)/beta, LBasis, ctrl.randomizedSVTCtrl );
+            else if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
             else
                 rank = SVT( L, Real(1)/beta );
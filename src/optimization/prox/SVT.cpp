@@ -12,6 +12,7 @@
 #include "./SVT/Cross.hpp"
 #include "./SVT/PivotedQR.hpp"
 #include "./SVT/TSQR.hpp"
+#include "./SVT/Randomized.hpp"
 
 namespace El {
 
@@ -72,6 +73,10 @@ Int SVT( DistMatrix<Field,U,STAR>& A, const Base<Field>& tau, bool relative )
   template Int SVT \
   ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, \
     Int relaxedRank, bool relative ); \
+  template Int svt::Normal \
+  ( Matrix<Field>& A, const Base<Field>& tau, bool relative ); \
+  template Int svt::Normal \
+  ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, bool relative ); \
   template Int svt::Cross \
   ( Matrix<Field>& A, const Base<Field>& tau, bool relative ); \
   template Int svt::Cross \
@@ -85,6 +90,13 @@ Int SVT( DistMatrix<Field,U,STAR>& A, const Base<Field>& tau, bool relative )
     bool relative ); \
   template Int svt::TSQR \
   ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, bool relative ); \
+  template Int svt::Randomized \
+  ( Matrix<Field>& A, const Base<Field>& tau, Matrix<Field>& Q, \
+    const svt::RandomizedCtrl& ctrl, bool relative ); \
+  template Int svt::Randomized \
+  ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, \
+    AbstractDistMatrix<Field>& Q, \
+    const svt::RandomizedCtrl& ctrl, bool relative ); \
   PROTO_DIST(Field,MC  ) \
   PROTO_DIST(Field,MD  ) \
   PROTO_DIST(Field,MR  ) \
@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVT_RANDOMIZED_HPP
+#define EL_SVT_RANDOMIZED_HPP
+
+namespace El {
+namespace svt {
+
+// Threshold the SVD of Q^H A, where Q is an orthonormal basis for a sketch of
+// the range of A (see Halko, Martinsson, and Tropp, "Finding structure with
+// randomness"). The sketch is seeded with A A^H times the left singular
+// vectors retained by the previous call, plus ctrl.oversample Gaussian
+// columns, and is doubled in width for as long as every singular value it
+// captures survives the threshold.
+
+template<typename Field>
+Int Randomized
+( Matrix<Field>& A,
+  const Base<Field>& tau,
+  Matrix<Field>& Q,
+  const RandomizedCtrl& ctrl,
+  bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+    {
+        Q.Resize( m, 0 );
+        return 0;
+    }
+
+    Int numWarm = ( Q.Height() == m ? Min(Q.Width(),minDim) : 0 );
+    Int width =
+      Min( (numWarm > 0 ? numWarm : ctrl.initialRank)+ctrl.oversample,
+           minDim );
+    width = Max( width, numWarm );
+
+    Matrix<Field> Y, Z, Omega, B, U, V;
+    Matrix<Real> s;
+    while( true )
+    {
+        Y.Resize( m, width );
+        if( numWarm > 0 )
+        {
+            auto YWarm = Y( ALL, IR(0,numWarm) );
+            auto QWarm = Q( ALL, IR(0,numWarm) );
+            Gemm( ADJOINT, NORMAL, Field(1), A, QWarm, Z );
+            Gemm( NORMAL, NORMAL, Field(1), A, Z, Field(0), YWarm );
+        }
+        if( width > numWarm )
+        {
+            auto YNew = Y( ALL, IR(numWarm,width) );
+            Gaussian( Omega, n, width-numWarm );
+            Gemm( NORMAL, NORMAL, Field(1), A, Omega, Field(0), YNew );
+        }
+        for( Int it=0; it<ctrl.numPowerIts; ++it )
+        {
+            qr::ExplicitUnitary( Y );
+            Gemm( ADJOINT, NORMAL, Field(1), A, Y, Z );
+            qr::ExplicitUnitary( Z );
+            Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+        }
+        qr::ExplicitUnitary( Y );
+
+        Gemm( ADJOINT, NORMAL, Field(1), Y, A, B );
+        SVD( B, U, s, V );
+
+        const Real thresh = ( relative ? tau*s(0) : tau );
+        if( width == minDim || s(width-1) <= thresh )
+            break;
+
+        // Every captured singular value survives, so some may be missing
+        Gemm( NORMAL, NORMAL, Field(1), Y, U, Q );
+        numWarm = width;
+        width = Min( 2*width, minDim );
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+    if( rank == 0 )
+    {
+        Zero( A );
+        Q.Resize( m, 0 );
+        return 0;
+    }
+    auto URank = U( ALL, IR(0,rank) );
+    auto VRank = V( ALL, IR(0,rank) );
+    auto sRank = s( IR(0,rank), ALL );
+    Gemm( NORMAL, NORMAL, Field(1), Y, URank, Q );
+    Matrix<Field> QScaled( Q );
+    DiagonalScale( RIGHT, NORMAL, sRank, QScaled );
+    Gemm( NORMAL, ADJOINT, Field(1), QScaled, VRank, Field(0), A );
+
+    return rank;
+}
+
+template<typename Field>
+Int Randomized
+( AbstractDistMatrix<Field>& APre,
+  const Base<Field>& tau,
+  AbstractDistMatrix<Field>& QPre,
+  const RandomizedCtrl& ctrl,
+  bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre ), QProx( QPre );
+    auto& A = AProx.Get();
+    auto& Q = QProx.Get();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+    {
+        Q.Resize( m, 0 );
+        return 0;
+    }
+
+    Int numWarm = ( Q.Height() == m ? Min(Q.Width(),minDim) : 0 );
+    Int width =
+      Min( (numWarm > 0 ? numWarm : ctrl.initialRank)+ctrl.oversample,
+           minDim );
+    width = Max( width, numWarm );
+
+    const Grid& g = A.Grid();
+    DistMatrix<Field> Y(g), Z(g), Omega(g), B(g), U(g), V(g);
+    DistMatrix<Real,STAR,STAR> s(g);
+    while( true )
+    {
+        Y.Resize( m, width );
+        if( numWarm > 0 )
+        {
+            auto YWarm = Y( ALL, IR(0,numWarm) );
+            auto QWarm = Q( ALL, IR(0,numWarm) );
+            Gemm( ADJOINT, NORMAL, Field(1), A, QWarm, Z );
+            Gemm( NORMAL, NORMAL, Field(1), A, Z, Field(0), YWarm );
+        }
+        if( width > numWarm )
+        {
+            auto YNew = Y( ALL, IR(numWarm,width) );
+            Gaussian( Omega, n, width-numWarm );
+            Gemm( NORMAL, NORMAL, Field(1), A, Omega, Field(0), YNew );
+        }
+        for( Int it=0; it<ctrl.numPowerIts; ++it )
+        {
+            qr::ExplicitUnitary( Y );
+            Gemm( ADJOINT, NORMAL, Field(1), A, Y, Z );
+            qr::ExplicitUnitary( Z );
+            Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+        }
+        qr::ExplicitUnitary( Y );
+
+        Gemm( ADJOINT, NORMAL, Field(1), Y, A, B );
+        SVD( B, U, s, V );
+
+        const auto& sLoc = s.LockedMatrix();
+        const Real thresh = ( relative ? tau*sLoc(0) : tau );
+        if( width == minDim || sLoc(width-1) <= thresh )
+            break;
+
+        // Every captured singular value survives, so some may be missing
+        Gemm( NORMAL, NORMAL, Field(1), Y, U, Q );
+        numWarm = width;
+        width = Min( 2*width, minDim );
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s.LockedMatrix() );
+    if( rank == 0 )
+    {
+        Zero( A );
+        Q.Resize( m, 0 );
+        return 0;
+    }
+    auto URank = U( ALL, IR(0,rank) );
+    auto VRank = V( ALL, IR(0,rank) );
+    auto sRank = s( IR(0,rank), ALL );
+    Gemm( NORMAL, NORMAL, Field(1), Y, URank, Q );
+    DistMatrix<Field> QScaled( Q );
+    DiagonalScale( RIGHT, NORMAL, sRank, QScaled );
+    Gemm( NORMAL, ADJOINT, Field(1), QScaled, VRank, Field(0), A );
+
+    return rank;
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_RANDOMIZED_HPP
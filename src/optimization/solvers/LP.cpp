@@ -206,6 +206,20 @@ void LP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void LP
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        SparseIPMSession<Real>& session,
+  const lp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == LP_MEHROTRA )
+        lp::direct::Mehrotra( problem, solution, session, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void LP
@@ -433,6 +447,11 @@ void LP
           DirectLPSolution<Matrix<Real>>& solution, \
     const lp::direct::Ctrl<Real>& ctrl ); \
   template void LP \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+          SparseIPMSession<Real>& session, \
+    const lp::direct::Ctrl<Real>& ctrl ); \
+  template void LP \
   ( const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
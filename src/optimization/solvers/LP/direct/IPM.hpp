@@ -29,6 +29,12 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 template<typename Real>
 void Mehrotra
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        SparseIPMSession<Real>& session,
+  const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
+template<typename Real>
+void Mehrotra
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         DirectLPSolution<DistMultiVec<Real>>& solution,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
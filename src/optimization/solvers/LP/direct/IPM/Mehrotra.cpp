@@ -216,15 +216,41 @@ void Equilibrate
         DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& equilibratedProblem,
         DirectLPSolution<Matrix<Real>>& equilibratedSolution,
         SparseDirectLPEquilibration<Real>& equilibration,
+        SparseIPMSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    equilibratedProblem = problem;
+    equilibratedProblem.b = problem.b;
+    equilibratedProblem.c = problem.c;
     equilibratedSolution = solution;
 
-    RuizEquil
-    ( equilibratedProblem.A,
-      equilibration.rowScale, equilibration.colScale, ctrl.print );
+    if( session.equilibrated )
+    {
+        equilibratedProblem.A = session.AEquil;
+        equilibration.rowScale = session.rowScale;
+        equilibration.colScale = session.colScale;
+        ++session.numEquilibrationReuses;
+        session.timeSaved +=
+          session.equilibrationTime / session.numEquilibrations;
+    }
+    else
+    {
+        Timer timer;
+        timer.Start();
+        equilibratedProblem.A = problem.A;
+        RuizEquil
+        ( equilibratedProblem.A,
+          equilibration.rowScale, equilibration.colScale, ctrl.print );
+        session.equilibrationTime += timer.Stop();
+        ++session.numEquilibrations;
+        if( session.reuseEquilibration )
+        {
+            session.AEquil = equilibratedProblem.A;
+            session.rowScale = equilibration.rowScale;
+            session.colScale = equilibration.colScale;
+            session.equilibrated = true;
+        }
+    }
 
     DiagonalSolve
     ( LEFT, NORMAL, equilibration.rowScale, equilibratedProblem.b );
@@ -1360,6 +1386,7 @@ template<typename Real>
 void EquilibratedMehrotra
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
+        SparseIPMSession<Real>& session,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
@@ -1394,25 +1421,36 @@ void EquilibratedMehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    SparseLDLFactorization<Real> sparseLDLFact;
+    SparseLDLFactorization<Real>& sparseLDLFact = session.sparseLDLFact;
+    SparseProduct<Real> normalProduct;
+    // A warm start is blended with the standard initial point
+    DirectLPSolution<Matrix<Real>> warmSolution;
+    if( session.warmStarted )
+        warmSolution = solution;
+    const bool primalInit = ctrl.primalInit && !session.warmStarted;
+    const bool dualInit = ctrl.dualInit && !session.warmStarted;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
-        ( problem, solution, sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+        ( problem, solution, session,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
     else
     {
-        SparseLDLFactorization<Real> augmentedSparseLDLFact;
+        SparseIPMSession<Real> augmentedSession;
         Initialize
-        ( problem, solution, augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+        ( problem, solution, augmentedSession,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    if( session.warmStarted )
+        session.BlendWarmStart
+        ( warmSolution.x, warmSolution.y, warmSolution.z,
+          solution.x, solution.y, solution.z );
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -1454,6 +1492,8 @@ void EquilibratedMehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        session.numIterations = numIts;
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( solution.x );
@@ -1588,11 +1628,9 @@ void EquilibratedMehrotra
 
                 if( numIts == 0 &&
                     (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                     (primalInit && dualInit)) )
                 {
-                    const bool hermitian = true;
-                    const BisectCtrl bisectCtrl;
-                    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    session.Analyze( J );
                 }
                 else
                 {
@@ -1631,11 +1669,9 @@ void EquilibratedMehrotra
         {
             // Construct the KKT system
             // ------------------------
-            // TODO(poulson): Apply updates to a matrix of explicit zeros
-            // (with the correct sparsity pattern)
             NormalKKT
             ( problem.A, gammaPerm, deltaPerm,
-              solution.x, solution.z, J, false );
+              solution.x, solution.z, J, normalProduct, false );
             NormalKKTRHS
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
@@ -1647,9 +1683,7 @@ void EquilibratedMehrotra
             {
                 if( numIts == 0 )
                 {
-                    const bool hermitian = true;
-                    const BisectCtrl bisectCtrl;
-                    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    session.Analyze( J );
                 }
                 else
                 {
@@ -1875,9 +1909,21 @@ template<typename Real>
 void Mehrotra
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
-  const MehrotraCtrl<Real>& ctrl )
+        SparseIPMSession<Real>& session,
+  const MehrotraCtrl<Real>& ctrlIn )
 {
     EL_DEBUG_CSE
+    const SparseMatrix<Real> Q;
+    session.Prepare( Q, problem.A, ctrlIn.system );
+
+    MehrotraCtrl<Real> ctrl( ctrlIn );
+    if( !ctrl.primalInit && !ctrl.dualInit &&
+        session.WarmStart( solution.x, solution.y, solution.z ) )
+    {
+        ctrl.primalInit = true;
+        ctrl.dualInit = true;
+    }
+
     if( ctrl.outerEquil )
     {
         DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> equilibratedProblem;
@@ -1885,14 +1931,19 @@ void Mehrotra
         SparseDirectLPEquilibration<Real> equilibration;
         Equilibrate
         ( problem, solution,
-          equilibratedProblem, equilibratedSolution, equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+          equilibratedProblem, equilibratedSolution, equilibration,
+          session, ctrl );
+        EquilibratedMehrotra
+        ( equilibratedProblem, equilibratedSolution, session, ctrl );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        EquilibratedMehrotra( problem, solution, session, ctrl );
     }
+    session.Finish( solution.x, solution.y, solution.z );
+    if( ctrl.time )
+        session.PrintStats();
     if( ctrl.print )
     {
         const Real primObj = Dot(problem.c,solution.x);
@@ -1912,6 +1963,20 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseIPMSession<Real> session;
+    session.reuseAnalysis = false;
+    session.reuseEquilibration = false;
+    session.warmStart = false;
+    Mehrotra( problem, solution, session, ctrl );
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void Mehrotra
@@ -1986,6 +2051,7 @@ void EquilibratedMehrotra
     }
 
     DistSparseLDLFactorization<Real> sparseLDLFact;
+    DistSparseProduct<Real> normalProduct;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -2263,10 +2329,9 @@ void EquilibratedMehrotra
         {
             // Assemble the KKT system
             // -----------------------
-            // TODO(poulson): Apply updates on top of explicit zeros
             NormalKKT
             ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
-              J, false );
+              J, normalProduct, false );
             NormalKKTRHS
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
@@ -2642,6 +2707,11 @@ void Mehrotra
           DirectLPSolution<Matrix<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+          SparseIPMSession<Real>& session, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
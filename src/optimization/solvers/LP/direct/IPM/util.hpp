@@ -29,7 +29,7 @@ template<typename Real>
 void Initialize
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
-        SparseLDLFactorization<Real>& sparseLDLFact,
+        SparseIPMSession<Real>& session,
   bool primalInit, bool dualInit, bool standardShift,
   const RegSolveCtrl<Real>& solveCtrl );
 template<typename Real>
@@ -156,6 +156,28 @@ void NormalKKT
   const DistMultiVec<Real>& z,
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
+// Variants which only form the sparsity pattern of J upon the first call with
+// a given product, and which overwrite the values of J in place afterwards
+template<typename Real>
+void NormalKKT
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+        SparseProduct<Real>& product,
+  bool onlyLower=true );
+template<typename Real>
+void NormalKKT
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        DistSparseProduct<Real>& product,
+  bool onlyLower=true );
 
 template<typename Real>
 void NormalKKTRHS
@@ -299,7 +299,7 @@ template<typename Real>
 void Initialize
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
-        SparseLDLFactorization<Real>& sparseLDLFact,
+        SparseIPMSession<Real>& session,
   bool primalInit,
   bool dualInit,
   bool standardShift,
@@ -311,7 +311,7 @@ void Initialize
     Q.Resize( n, n );
     qp::direct::Initialize
     ( Q, problem.A, problem.b, problem.c, solution.x, solution.y, solution.z,
-      sparseLDLFact,
+      session,
       primalInit, dualInit, standardShift, solveCtrl );
 }
 
@@ -351,7 +351,7 @@ void Initialize
   template void Initialize \
   ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
           DirectLPSolution<Matrix<Real>>& solution, \
-          SparseLDLFactorization<Real>& sparseLDLFact, \
+          SparseIPMSession<Real>& session, \
     bool primalInit, \
     bool dualInit, \
     bool standardShift, \
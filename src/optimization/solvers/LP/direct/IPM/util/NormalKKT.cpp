@@ -143,6 +143,7 @@ void NormalKKT
   const Matrix<Real>& x,
   const Matrix<Real>& z,
         SparseMatrix<Real>& J,
+        SparseProduct<Real>& product,
   bool onlyLower )
 {
     EL_DEBUG_CSE
@@ -151,36 +152,51 @@ void NormalKKT
     // TODO(poulson): Expose this value as a parameter
     const Real inflateRatio = Pow(limits::Epsilon<Real>(),Real(0.83));
 
-    // dInv := sqrt( (z ./ x) .+ gamma^2 )
-    // ===================================
-    Matrix<Real> dInv;
-    dInv.Resize( n, 1 );
+    // d := 1 ./ ( (z ./ x) .+ gamma^2 ), the diagonal of D^2
+    // ======================================================
+    Matrix<Real> d;
+    d.Resize( n, 1 );
     for( Int i=0; i<n; ++i )
-        dInv(i) = Sqrt(z(i)/x(i) + gamma*gamma);
+        d(i) = 1/(z(i)/x(i) + gamma*gamma);
 
     // Form A D^2 A^T + delta^2 I
     // ==========================
-    SparseMatrix<Real> G;
-    // TODO(poulson): Avoid forming this within an inner loop...
-    Transpose( A, G );
-    DiagonalSolve( LEFT, NORMAL, dInv, G );
-    Zeros( J, m, m );
-    ShiftDiagonal( J, delta*delta );
-    Syrk( LOWER, TRANSPOSE, Real(1), G, Real(1), J );
+    // Only the first call forms the sparsity pattern of J; subsequent calls
+    // overwrite its values in place
+    if( !product.Initialized() )
+    {
+        if( onlyLower )
+            product.InitializeSyrk( LOWER, A, J );
+        else
+            product.InitializeSyrk( A, J );
+    }
+    product.Syrk( Real(1), A, d, J );
 
-    // Inflate the diagonal in a small relative sense
-    // ==============================================
+    // Shift and then inflate the diagonal in a small relative sense
+    // =============================================================
     // TODO(poulson): Create EntrywiseMapDiagonal and replace this with it
     Real* valBuf = J.ValueBuffer();
     for( Int i=0; i<m; ++i )
     {
         const Int e = J.Offset( i, i );
-        const Real diagAbs = Abs(valBuf[e]);
+        const Real diagAbs = Abs(valBuf[e]+delta*delta);
         valBuf[e] = (1+inflateRatio)*diagAbs;
     }
+}
 
-    if( !onlyLower )
-        MakeSymmetric( LOWER, J );
+template<typename Real>
+void NormalKKT
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+  bool onlyLower )
+{
+    EL_DEBUG_CSE
+    SparseProduct<Real> product;
+    NormalKKT( A, gamma, delta, x, z, J, product, onlyLower );
 }
 
 template<typename Real>
@@ -191,10 +207,10 @@ void NormalKKT
   const DistMultiVec<Real>& x,
   const DistMultiVec<Real>& z,
         DistSparseMatrix<Real>& J,
+        DistSparseProduct<Real>& product,
   bool onlyLower )
 {
     EL_DEBUG_CSE
-    const Int m = A.Height();
     const Int n = A.Width();
     const Grid& grid = A.Grid();
     if( !mpi::Congruent( grid.Comm(), x.Grid().Comm() ) )
@@ -208,27 +224,31 @@ void NormalKKT
     auto& xLoc = x.LockedMatrix();
     auto& zLoc = z.LockedMatrix();
 
-    // dInv := sqrt( (z ./ x) .+ gamma^2 )
-    // ===================================
-    DistMultiVec<Real> dInv(grid);
-    dInv.Resize( n, 1 );
-    auto& dInvLoc = dInv.Matrix();
-    const Int dInvLocalHeight = dInv.LocalHeight();
-    for( Int iLoc=0; iLoc<dInvLocalHeight; ++iLoc )
-        dInvLoc(iLoc) = Sqrt(zLoc(iLoc)/xLoc(iLoc) + gamma*gamma);
+    // d := 1 ./ ( (z ./ x) .+ gamma^2 ), the diagonal of D^2
+    // ======================================================
+    DistMultiVec<Real> d(grid);
+    d.Resize( n, 1 );
+    auto& dLoc = d.Matrix();
+    const Int dLocalHeight = d.LocalHeight();
+    for( Int iLoc=0; iLoc<dLocalHeight; ++iLoc )
+        dLoc(iLoc) = 1/(zLoc(iLoc)/xLoc(iLoc) + gamma*gamma);
 
     // Form A D^2 A^T + delta^2 I
     // ==========================
-    DistSparseMatrix<Real> G(grid);
-    // TODO: Avoid forming this within an inner loop...
-    Transpose( A, G );
-    DiagonalSolve( LEFT, NORMAL, dInv, G );
-    Zeros( J, m, m );
-    ShiftDiagonal( J, delta*delta );
-    Syrk( LOWER, TRANSPOSE, Real(1), G, Real(1), J );
+    // Only the first call forms the sparsity pattern of J (and the
+    // communication pattern needed to form it); subsequent calls overwrite
+    // its values in place
+    if( !product.Initialized() )
+    {
+        if( onlyLower )
+            product.InitializeSyrk( LOWER, A, J );
+        else
+            product.InitializeSyrk( A, J );
+    }
+    product.Syrk( Real(1), A, d, J );
 
-    // Inflate the diagonal in a small relative sense
-    // ==============================================
+    // Shift and then inflate the diagonal in a small relative sense
+    // =============================================================
     // TODO: Create EntrywiseMapDiagonal and replace this with it
     Real* valBuf = J.ValueBuffer();
     const Int JLocalHeight = J.LocalHeight();
@@ -236,12 +256,24 @@ void NormalKKT
     {
         const Int i = J.GlobalRow(iLoc);
         const Int e = J.Offset( iLoc, i );
-        const Real diagAbs = Abs(valBuf[e]);
+        const Real diagAbs = Abs(valBuf[e]+delta*delta);
         valBuf[e] = (1+inflateRatio)*diagAbs;
     }
+}
 
-    if( !onlyLower )
-        MakeSymmetric( LOWER, J );
+template<typename Real>
+void NormalKKT
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower )
+{
+    EL_DEBUG_CSE
+    DistSparseProduct<Real> product;
+    NormalKKT( A, gamma, delta, x, z, J, product, onlyLower );
 }
 
 template<typename Real>
@@ -629,6 +661,22 @@ void ExpandNormalSolution
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
           DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void NormalKKT \
+  ( const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          SparseMatrix<Real>& J, \
+          SparseProduct<Real>& product, bool onlyLower ); \
+  template void NormalKKT \
+  ( const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J, \
+          DistSparseProduct<Real>& product, bool onlyLower ); \
   template void NormalKKTRHS \
   ( const Matrix<Real>& A, \
           Real gamma, \
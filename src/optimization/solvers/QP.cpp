@@ -68,6 +68,26 @@ void QP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void QP
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        SparseIPMSession<Real>& session,
+  const qp::direct::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == QP_MEHROTRA )
+        qp::direct::Mehrotra
+        ( Q, A, b, c, x, y, z, session, ctrl.mehrotraCtrl );
+    else
+        LogicError("Unsupported solver");
+}
+
 template<typename Real>
 void QP
 ( const DistSparseMatrix<Real>& Q,
@@ -201,6 +221,16 @@ void QP
           Matrix<Real>& z, \
     const qp::direct::Ctrl<Real>& ctrl ); \
   template void QP \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          SparseIPMSession<Real>& session, \
+    const qp::direct::Ctrl<Real>& ctrl ); \
+  template void QP \
   ( const DistSparseMatrix<Real>& Q, \
     const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
@@ -761,30 +761,64 @@ void Mehrotra
         Matrix<Real>& x,
         Matrix<Real>& y,
         Matrix<Real>& z,
-  const MehrotraCtrl<Real>& ctrl )
+        SparseIPMSession<Real>& session,
+  const MehrotraCtrl<Real>& ctrlIn )
 {
     EL_DEBUG_CSE
+    session.Prepare( QPre, APre, ctrlIn.system );
+    MehrotraCtrl<Real> ctrl( ctrlIn );
+    if( !ctrl.primalInit && !ctrl.dualInit && session.WarmStart( x, y, z ) )
+    {
+        ctrl.primalInit = true;
+        ctrl.dualInit = true;
+    }
 
     // Equilibrate the QP by diagonally scaling A
-    auto Q = QPre;
-    auto A = APre;
+    SparseMatrix<Real> Q, A;
     auto b = bPre;
     auto c = cPre;
-    const Int m = A.Height();
-    const Int n = A.Width();
+    const Int m = APre.Height();
+    const Int n = APre.Width();
     const Int degree = n;
     Matrix<Real> dRow, dCol;
     if( ctrl.outerEquil )
     {
-        RuizEquil( A, dRow, dCol, ctrl.print );
+        if( session.equilibrated )
+        {
+            Q = session.QEquil;
+            A = session.AEquil;
+            dRow = session.rowScale;
+            dCol = session.colScale;
+            ++session.numEquilibrationReuses;
+            session.timeSaved +=
+              session.equilibrationTime / session.numEquilibrations;
+        }
+        else
+        {
+            Timer timer;
+            timer.Start();
+            Q = QPre;
+            A = APre;
+            RuizEquil( A, dRow, dCol, ctrl.print );
+            // TODO(poulson): Replace with SymmetricDiagonalSolve
+            {
+                DiagonalSolve( LEFT, NORMAL, dCol, Q );
+                DiagonalSolve( RIGHT, NORMAL, dCol, Q );
+            }
+            session.equilibrationTime += timer.Stop();
+            ++session.numEquilibrations;
+            if( session.reuseEquilibration )
+            {
+                session.QEquil = Q;
+                session.AEquil = A;
+                session.rowScale = dRow;
+                session.colScale = dCol;
+                session.equilibrated = true;
+            }
+        }
 
         DiagonalSolve( LEFT, NORMAL, dRow, b );
         DiagonalSolve( LEFT, NORMAL, dCol, c );
-        // TODO(poulson): Replace with SymmetricDiagonalSolve
-        {
-            DiagonalSolve( LEFT, NORMAL, dCol, Q );
-            DiagonalSolve( RIGHT, NORMAL, dCol, Q );
-        }
         if( ctrl.primalInit )
             DiagonalScale( LEFT, NORMAL, dCol, x );
         if( ctrl.dualInit )
@@ -795,6 +829,8 @@ void Mehrotra
     }
     else
     {
+        Q = QPre;
+        A = APre;
         Ones( dRow, m, 1 );
         Ones( dCol, n, 1 );
     }
@@ -812,28 +848,40 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    SparseLDLFactorization<Real> sparseLDLFact;
+    SparseLDLFactorization<Real>& sparseLDLFact = session.sparseLDLFact;
+    // A warm start is blended with the standard initial point
+    Matrix<Real> xWarm, yWarm, zWarm;
+    if( session.warmStarted )
+    {
+        xWarm = x;
+        yWarm = y;
+        zWarm = z;
+    }
+    const bool primalInit = ctrl.primalInit && !session.warmStarted;
+    const bool dualInit = ctrl.dualInit && !session.warmStarted;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
-    // TODO(poulson): Add permanent regularization and cache J metadata
+    // TODO(poulson): Add permanent regularization
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
         ( Q, A, b, c, x, y, z,
-          sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          session,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
     else
     {
-        SparseLDLFactorization<Real> augmentedSparseLDLFact;
+        SparseIPMSession<Real> augmentedSession;
         Initialize
         ( Q, A, b, c, x, y, z,
-          augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+          augmentedSession,
+          primalInit, dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    if( session.warmStarted )
+        session.BlendWarmStart( xWarm, yWarm, zWarm, x, y, z );
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -870,6 +918,8 @@ void Mehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        session.numIterations = numIts;
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -984,11 +1034,9 @@ void Mehrotra
 
                 if( numIts == 0 &&
                     (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit) ) )
+                     (primalInit && dualInit) ) )
                 {
-                    const bool hermitian = true;
-                    const BisectCtrl bisectCtrl;
-                    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    session.Analyze( J );
                 }
                 else
                 {
@@ -1182,6 +1230,28 @@ void Mehrotra
         DiagonalSolve( LEFT, NORMAL, dRow, y );
         DiagonalScale( LEFT, NORMAL, dCol, z );
     }
+    session.Finish( x, y, z );
+    if( ctrl.time )
+        session.PrintStats();
+}
+
+template<typename Real>
+void Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseIPMSession<Real> session;
+    session.reuseAnalysis = false;
+    session.reuseEquilibration = false;
+    session.warmStart = false;
+    Mehrotra( Q, A, b, c, x, y, z, session, ctrl );
 }
 
 template<typename Real>
@@ -1706,6 +1776,16 @@ void Mehrotra
           Matrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          SparseIPMSession<Real>& session, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const DistSparseMatrix<Real>& Q, \
     const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
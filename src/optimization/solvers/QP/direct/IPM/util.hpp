@@ -43,7 +43,7 @@ void Initialize
         Matrix<Real>& x,
         Matrix<Real>& y,
         Matrix<Real>& z,
-        SparseLDLFactorization<Real>& sparseLDLFact,
+        SparseIPMSession<Real>& session,
   bool primalInit, bool dualInit, bool standardShift,
   const RegSolveCtrl<Real>& solveCtrl );
 template<typename Real>
@@ -295,7 +295,7 @@ void Initialize
         Matrix<Real>& x,
         Matrix<Real>& y,
         Matrix<Real>& z,
-        SparseLDLFactorization<Real>& sparseLDLFact,
+        SparseIPMSession<Real>& session,
   bool primalInit, bool dualInit, bool standardShift,
   const RegSolveCtrl<Real>& solveCtrl )
 {
@@ -346,10 +346,8 @@ void Initialize
     }
     UpdateRealPartOfDiagonal( J, Real(1), reg );
 
-    const bool hermitian = true;
-    const BisectCtrl bisectCtrl;
-    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
-    sparseLDLFact.Factor( LDL_2D );
+    session.Analyze( J );
+    session.sparseLDLFact.Factor( LDL_2D );
 
     // Compute the proposed step from the KKT system
     // ---------------------------------------------
@@ -370,7 +368,7 @@ void Initialize
         AugmentedKKTRHS( ones, rc, rb, rmu, d );
 
         reg_ldl::RegularizedSolveAfter
-        ( JOrig, reg, sparseLDLFact, d,
+        ( JOrig, reg, session.sparseLDLFact, d,
           solveCtrl.relTol, solveCtrl.maxRefineIts, solveCtrl.progress );
 
         ExpandAugmentedSolution( ones, ones, rmu, d, x, u, v );
@@ -386,7 +384,7 @@ void Initialize
         AugmentedKKTRHS( ones, rc, rb, rmu, d );
 
         reg_ldl::RegularizedSolveAfter
-        ( JOrig, reg, sparseLDLFact, d,
+        ( JOrig, reg, session.sparseLDLFact, d,
           solveCtrl.relTol, solveCtrl.maxRefineIts, solveCtrl.progress );
 
         ExpandAugmentedSolution( ones, ones, rmu, d, z, y, u );
@@ -595,7 +593,7 @@ void Initialize
           Matrix<Real>& x, \
           Matrix<Real>& y, \
           Matrix<Real>& z, \
-          SparseLDLFactorization<Real>& sparseLDLFact, \
+          SparseIPMSession<Real>& session, \
     bool primalInit, bool dualInit, bool standardShift, \
     const RegSolveCtrl<Real>& solveCtrl ); \
   template void Initialize \
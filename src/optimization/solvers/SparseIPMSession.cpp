@@ -0,0 +1,188 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+template<typename Real>
+bool SamePattern( const SparseMatrix<Real>& A, const SparseMatrix<Real>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.NumEntries() != B.NumEntries() )
+        return false;
+    const Int height = A.Height();
+    const Int numEntries = A.NumEntries();
+    if( height == 0 )
+        return true;
+    return std::equal
+      ( A.LockedOffsetBuffer(), A.LockedOffsetBuffer()+height+1,
+        B.LockedOffsetBuffer() ) &&
+      std::equal
+      ( A.LockedTargetBuffer(), A.LockedTargetBuffer()+numEntries,
+        B.LockedTargetBuffer() );
+}
+
+template<typename Real>
+bool SameValues( const SparseMatrix<Real>& A, const SparseMatrix<Real>& B )
+{
+    return std::equal
+      ( A.LockedValueBuffer(), A.LockedValueBuffer()+A.NumEntries(),
+        B.LockedValueBuffer() );
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void SparseIPMSession<Real>::Clear()
+{
+    EL_DEBUG_CSE
+    analyzed = false;
+    equilibrated = false;
+    haveSolution = false;
+    warmStarted = false;
+    QOrig.Empty();
+    AOrig.Empty();
+    QEquil.Empty();
+    AEquil.Empty();
+    rowScale.Empty();
+    colScale.Empty();
+    x.Empty();
+    y.Empty();
+    z.Empty();
+}
+
+template<typename Real>
+void SparseIPMSession<Real>::Prepare
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+        KKTSystem newSystem )
+{
+    EL_DEBUG_CSE
+    warmStarted = false;
+    const bool samePattern =
+      SamePattern( Q, QOrig ) && SamePattern( A, AOrig );
+    const bool sameValues =
+      samePattern && SameValues( Q, QOrig ) && SameValues( A, AOrig );
+
+    if( !reuseAnalysis || !samePattern || newSystem != system )
+        analyzed = false;
+    if( !reuseEquilibration || !sameValues )
+        equilibrated = false;
+    if( x.Height() != A.Width() || y.Height() != A.Height() )
+        haveSolution = false;
+    system = newSystem;
+
+    if( (reuseAnalysis || reuseEquilibration) && !sameValues )
+    {
+        QOrig = Q;
+        AOrig = A;
+    }
+}
+
+template<typename Real>
+void SparseIPMSession<Real>::Analyze( const SparseMatrix<Real>& J )
+{
+    EL_DEBUG_CSE
+    if( analyzed )
+    {
+        sparseLDLFact.ChangeNonzeroValues( J );
+        ++numAnalysisReuses;
+        timeSaved += analysisTime / numAnalyses;
+        return;
+    }
+    Timer timer;
+    timer.Start();
+    const bool hermitian = true;
+    const BisectCtrl bisectCtrl;
+    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    analysisTime += timer.Stop();
+    ++numAnalyses;
+    analyzed = reuseAnalysis;
+}
+
+template<typename Real>
+bool SparseIPMSession<Real>::WarmStart
+( Matrix<Real>& xInit, Matrix<Real>& yInit, Matrix<Real>& zInit )
+{
+    EL_DEBUG_CSE
+    if( !warmStart || !haveSolution )
+        return false;
+    xInit = x;
+    yInit = y;
+    zInit = z;
+    warmStarted = true;
+    ++numWarmStarts;
+    return true;
+}
+
+template<typename Real>
+void SparseIPMSession<Real>::BlendWarmStart
+( const Matrix<Real>& xPrev, const Matrix<Real>& yPrev,
+  const Matrix<Real>& zPrev,
+        Matrix<Real>& xInit, Matrix<Real>& yInit,
+        Matrix<Real>& zInit ) const
+{
+    EL_DEBUG_CSE
+    if( warmStartWeight < Real(0) || warmStartWeight >= Real(1) )
+        LogicError("The warm-start weight must lie in [0,1)");
+    xInit *= Real(1)-warmStartWeight;
+    yInit *= Real(1)-warmStartWeight;
+    zInit *= Real(1)-warmStartWeight;
+    Axpy( warmStartWeight, xPrev, xInit );
+    Axpy( warmStartWeight, yPrev, yInit );
+    Axpy( warmStartWeight, zPrev, zInit );
+}
+
+template<typename Real>
+void SparseIPMSession<Real>::Finish
+( const Matrix<Real>& xSol, const Matrix<Real>& ySol,
+  const Matrix<Real>& zSol )
+{
+    EL_DEBUG_CSE
+    ++numSolves;
+    warmStarted = false;
+    if( warmStart )
+    {
+        x = xSol;
+        y = ySol;
+        z = zSol;
+        haveSolution = true;
+    }
+}
+
+template<typename Real>
+void SparseIPMSession<Real>::PrintStats() const
+{
+    EL_DEBUG_CSE
+    Output("Sparse IPM session after ",numSolves," solves:");
+    Output
+    ("  ",numAnalyses," analyses in ",analysisTime," [sec], ",
+     numAnalysisReuses," reused");
+    Output
+    ("  ",numEquilibrations," equilibrations in ",equilibrationTime,
+     " [sec], ",numEquilibrationReuses," reused");
+    Output("  ",numWarmStarts," warm starts");
+    Output("  ",numIterations," iterations in the latest solve");
+    Output("  estimated time saved: ",timeSaved," [sec]");
+}
+
+#define PROTO(Real) \
+  template struct SparseIPMSession<Real>;
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Deterministic entries so that every process can form the sequential
+// reference without any communication. Each row has a band near the diagonal
+// (which is mostly interior to its owner) as well as a few long-range entries
+// (which are owned by other processes).
+template<typename T>
+T MatrixEntry( Int i, Int j )
+{ return T(i-2*j+1) / T(i+j+3); }
+
+template<typename T>
+T VectorEntry( Int i, Int k )
+{ return T(3*i+k+1) / T(i+5*k+2); }
+
+void Columns( Int i, Int m, Int n, vector<Int>& cols )
+{
+    cols.clear();
+    const Int iScaled = (i*n) / Max(m,Int(1));
+    for( Int s=-1; s<=1; ++s )
+        if( iScaled+s >= 0 && iScaled+s < n )
+            cols.push_back( iScaled+s );
+    if( i % 3 == 0 )
+        cols.push_back( (7*i+n/2) % n );
+    if( i % 5 == 0 )
+        cols.push_back( (13*i+1) % n );
+}
+
+template<typename T>
+void TestDistMultiply
+( Orientation orientation, Int m, Int n, Int numRHS, const Grid& grid )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    OutputFromRoot
+    (grid.Comm(),"Testing ",orientation==NORMAL?"NORMAL":
+     (orientation==TRANSPOSE?"TRANSPOSE":"ADJOINT")," with ",numRHS,
+     " right-hand sides and ",TypeName<T>());
+
+    const Int xHeight = ( orientation==NORMAL ? n : m );
+    const Int yHeight = ( orientation==NORMAL ? m : n );
+    const T alpha = T(3)/T(2);
+    const T beta = T(-1)/T(2);
+
+    vector<Int> cols;
+    SparseMatrix<T> ASeq( m, n );
+    DistSparseMatrix<T> A( m, n, grid );
+    for( Int i=0; i<m; ++i )
+    {
+        Columns( i, m, n, cols );
+        for( const Int& j : cols )
+            ASeq.QueueUpdate( i, j, MatrixEntry<T>(i,j) );
+    }
+    ASeq.ProcessQueues();
+    const Int firstLocalRow = A.FirstLocalRow();
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        Columns( firstLocalRow+iLoc, m, n, cols );
+        for( const Int& j : cols )
+            A.QueueLocalUpdate
+            ( iLoc, j, MatrixEntry<T>(firstLocalRow+iLoc,j) );
+    }
+    A.ProcessQueues();
+
+    Matrix<T> XSeq( xHeight, numRHS ), YSeq( yHeight, numRHS );
+    for( Int k=0; k<numRHS; ++k )
+    {
+        for( Int i=0; i<xHeight; ++i )
+            XSeq(i,k) = VectorEntry<T>(i,k);
+        for( Int i=0; i<yHeight; ++i )
+            YSeq(i,k) = VectorEntry<T>(i+1,k);
+    }
+    DistMultiVec<T> X( xHeight, numRHS, grid ), Y( yHeight, numRHS, grid );
+    for( Int iLoc=0; iLoc<X.LocalHeight(); ++iLoc )
+        for( Int k=0; k<numRHS; ++k )
+            X.SetLocal( iLoc, k, XSeq(X.GlobalRow(iLoc),k) );
+    for( Int iLoc=0; iLoc<Y.LocalHeight(); ++iLoc )
+        for( Int k=0; k<numRHS; ++k )
+            Y.SetLocal( iLoc, k, YSeq(Y.GlobalRow(iLoc),k) );
+
+    Multiply( orientation, alpha, ASeq, XSeq, beta, YSeq );
+    // Multiply twice to exercise the cached communication metadata
+    DistMultiVec<T> YCopy( Y );
+    Multiply( orientation, alpha, A, X, beta, YCopy );
+    Multiply( orientation, alpha, A, X, beta, Y );
+
+    Real localError = 0;
+    for( Int iLoc=0; iLoc<Y.LocalHeight(); ++iLoc )
+        for( Int k=0; k<numRHS; ++k )
+        {
+            const T yRef = YSeq(Y.GlobalRow(iLoc),k);
+            localError =
+              Max( localError, Abs(Y.GetLocal(iLoc,k)-yRef) );
+            localError =
+              Max( localError, Abs(YCopy.GetLocal(iLoc,k)-yRef) );
+        }
+    const Real error = mpi::AllReduce( localError, mpi::MAX, grid.Comm() );
+    const Real tol = 100*limits::Epsilon<Real>()*Max(MaxNorm(YSeq),Real(1));
+    if( error > tol )
+    {
+        OutputFromRoot(grid.Comm(),"max error = ",error," > ",tol);
+        RuntimeError("Distributed and sequential products differ");
+    }
+    else
+        OutputFromRoot(grid.Comm(),"Test passed");
+}
+
+template<typename T>
+void TestAll( Int m, Int n, const Grid& grid )
+{
+    for( const Int numRHS : { 1, 5 } )
+    {
+        TestDistMultiply<T>( NORMAL, m, n, numRHS, grid );
+        TestDistMultiply<T>( TRANSPOSE, m, n, numRHS, grid );
+        TestDistMultiply<T>( ADJOINT, m, n, numRHS, grid );
+    }
+}
+
+void RunTests( Int m, Int n, const Grid& grid )
+{
+    PushIndent();
+    TestAll<float>( m, n, grid );
+    TestAll<Complex<float>>( m, n, grid );
+    TestAll<double>( m, n, grid );
+    TestAll<Complex<double>>( m, n, grid );
+#ifdef EL_HAVE_QD
+    TestAll<DoubleDouble>( m, n, grid );
+    TestAll<Complex<QuadDouble>>( m, n, grid );
+#endif
+#ifdef EL_HAVE_QUAD
+    TestAll<Quad>( m, n, grid );
+#endif
+#ifdef EL_HAVE_MPC
+    TestAll<BigFloat>( m, n, grid );
+#endif
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",200);
+        const Int n = Input("--n","width of matrix",150);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        OutputFromRoot(comm,"Testing ",m," x ",n," matrix");
+        RunTests( m, n, grid );
+        OutputFromRoot(comm,"Testing ",n," x ",m," matrix");
+        RunTests( n, m, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+    return 0;
+}
@@ -165,6 +165,37 @@ void TestGemm
             ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
         PopIndent();
     }
+
+    // Test the emulation of the product via exact double-precision slices
+    OutputFromRoot(g.Comm(),"Ozaki Algorithm:");
+    PushIndent();
+    C = COrig;
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_OZAKI );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    OutputFromRoot(g.Comm(),"Finished in ",runTime," seconds");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+    {
+        TestAssociativity
+        ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+        DistMatrix<T> CRef( COrig );
+        Gemm( orientA, orientB, alpha, A, B, beta, CRef );
+        CRef -= C;
+        const Base<T> errorNorm = MaxNorm( CRef );
+        const Base<T> scale =
+          Abs(alpha)*k*MaxNorm(A)*MaxNorm(B) + Abs(beta)*MaxNorm(COrig);
+        const Base<T> tol = 10*k*limits::Epsilon<Base<T>>()*scale;
+        OutputFromRoot
+        (g.Comm(),"|| C_Ozaki - C_SUMMA ||_max = ",errorNorm);
+        if( errorNorm > tol )
+            RuntimeError(errorNorm," > ",tol);
+    }
+    PopIndent();
+
     PopIndent();
 }
 
@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Every entry is a distinct integer which is exactly representable in single
+// precision so that misplaced entries are caught even after a conversion
+template<typename T>
+T UniqueEntry( Int i, Int j, Int height ) { return T(i+j*height); }
+
+template<typename T>
+void Fill( AbstractDistMatrix<T>& A, Int height, Int width )
+{
+    A.Resize( height, width );
+    if( !A.Participating() )
+        return;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc,
+              UniqueEntry<T>(A.GlobalRow(iLoc),A.GlobalCol(jLoc),height) );
+}
+
+// Redistribute A into B with the general-purpose algorithm and check every
+// entry of B. Returns the number of column panels used.
+template<typename S,typename T>
+Int TestCopy
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B,
+  const string& msg )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int panelWidth = copy::RedistPanelWidth( A, B );
+    const Int numPanels = (width+panelWidth-1) / panelWidth;
+    OutputFromRoot(comm,msg," (",numPanels," panels)");
+
+    copy::GeneralPurpose( A, B );
+    if( B.Height() != height || B.Width() != width )
+        LogicError(msg,": B was ",B.Height()," x ",B.Width());
+    Int numWrong = 0;
+    if( B.Participating() )
+        for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+            for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+                if( B.GetLocal(iLoc,jLoc) !=
+                    UniqueEntry<T>(B.GlobalRow(iLoc),B.GlobalCol(jLoc),height) )
+                    ++numWrong;
+    numWrong = mpi::AllReduce( numWrong, comm );
+    if( numWrong != 0 )
+        LogicError(msg,": ",numWrong," entries were wrong");
+    return numPanels;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",1200);
+        const Int n = Input("--width","width of matrix",1000);
+        const Int mb = Input("--blockHeight","height of dist block",13);
+        const Int nb = Input("--blockWidth","width of dist block",7);
+        ProcessInput();
+        PrintInputReport();
+
+        // The default grid, its transpose-ordered counterpart, and a
+        // row of the first half of the processes
+        const Grid grid( comm );
+        const Grid rowMajorGrid( comm, ROW_MAJOR );
+        const int subSize = Max( commSize/2, 1 );
+        vector<int> subRanks( subSize );
+        for( int q=0; q<subSize; ++q )
+            subRanks[q] = q;
+        mpi::Group group, subGroup;
+        mpi::CommGroup( comm, group );
+        mpi::Incl( group, subSize, subRanks.data(), subGroup );
+        const Grid subGrid( comm, subGroup, 1 );
+
+        Int maxPanels = 0;
+
+        // Mismatched element distributions on the same grid
+        DistMatrix<double,VC,STAR> A_VC_STAR( grid );
+        A_VC_STAR.Align( 1 % grid.Size(), 0 );
+        Fill( A_VC_STAR, m, n );
+        DistMatrix<double,STAR,VR> B_STAR_VR( grid );
+        maxPanels = Max
+        ( maxPanels,
+          TestCopy( A_VC_STAR, B_STAR_VR, "[VC,STAR] -> [STAR,VR]" ) );
+
+        // Element to block (with cuts) and back on grids of different orders
+        DistMatrix<double> A_MC_MR( grid );
+        A_MC_MR.Align( grid.Height()-1, 0 );
+        Fill( A_MC_MR, m, n );
+        DistMatrix<double,MC,MR,BLOCK> B_MC_MR_BLOCK( rowMajorGrid );
+        B_MC_MR_BLOCK.Align
+        ( mb, nb, 0, rowMajorGrid.Width()-1, mb/2, nb/3 );
+        maxPanels = Max
+        ( maxPanels,
+          TestCopy
+          ( A_MC_MR, B_MC_MR_BLOCK,
+            "[MC,MR] -> [MC,MR,BLOCK] on a row-major grid" ) );
+        DistMatrix<double,MR,MC> B_MR_MC( grid );
+        maxPanels = Max
+        ( maxPanels,
+          TestCopy
+          ( B_MC_MR_BLOCK, B_MR_MC,
+            "[MC,MR,BLOCK] on a row-major grid -> [MR,MC]" ) );
+
+        // Onto and off of a subset of the processes, converting precisions
+        DistMatrix<double,STAR,STAR> A_STAR_STAR( grid );
+        Fill( A_STAR_STAR, m, n );
+        DistMatrix<float,MC,MR> B_Sub( subGrid );
+        maxPanels = Max
+        ( maxPanels,
+          TestCopy
+          ( A_STAR_STAR, B_Sub,
+            "[STAR,STAR] -> [MC,MR] (float) on a subgrid" ) );
+        DistMatrix<double,VR,STAR,BLOCK> B_VR_STAR_BLOCK( grid );
+        B_VR_STAR_BLOCK.Align( mb, 1, 0, 0 );
+        maxPanels = Max
+        ( maxPanels,
+          TestCopy
+          ( B_Sub, B_VR_STAR_BLOCK,
+            "[MC,MR] (float) on a subgrid -> [VR,STAR,BLOCK]" ) );
+
+        if( maxPanels < 2 )
+            LogicError
+            ("No redistribution spanned more than one panel of ",
+             copy::generalPurposeMaxEntries," entries");
+        OutputFromRoot(comm,"Test passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The column of the t'th pseudo-random nonzero of row i of an m x n matrix;
+// the rows have irregular lengths so that the row blocks are unbalanced
+// unless they account for the nonzeros
+Int NonzeroColumn( Int i, Int t, Int n ) { return (i*131+t*t*17+t) % n; }
+Int RowLength( Int i, Int numPerRow ) { return 1 + (i*7) % (2*numPerRow); }
+
+template<typename T>
+void CheckProduct
+( Orientation orientation,
+  const Matrix<T>& ADense, const Matrix<T>& X, const Matrix<T>& Y0,
+  T alpha, T beta, const Matrix<T>& Y, const string& msg )
+{
+    typedef Base<T> Real;
+    Matrix<T> YRef( Y0 );
+    Gemm( orientation, NORMAL, alpha, ADense, X, beta, YRef );
+    const Real refNorm = FrobeniusNorm( YRef );
+    YRef -= Y;
+    const Real relError = FrobeniusNorm( YRef ) / refNorm;
+    Output("  ",msg,": || Y - Y_ref ||_F / || Y_ref ||_F = ",relError);
+    if( relError > 100*limits::Epsilon<Real>() )
+        LogicError(msg,": the sparse product was inaccurate");
+}
+
+template<typename T>
+void TestMultiply( Int m, Int n, Int numPerRow, Int numRHS )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+
+    SparseMatrix<T> A( m, n );
+    Graph graph( m, n );
+    Matrix<T> ADense, GDense;
+    Zeros( ADense, m, n );
+    Zeros( GDense, m, n );
+    A.Reserve( 2*m*numPerRow );
+    graph.Reserve( 2*m*numPerRow );
+    for( Int i=0; i<m; ++i )
+    {
+        for( Int t=0; t<RowLength(i,numPerRow); ++t )
+        {
+            const Int j = NonzeroColumn( i, t, n );
+            if( GDense(i,j) != T(0) )
+                continue;
+            const T value = SampleUniform( T(0), T(1) );
+            A.QueueUpdate( i, j, value );
+            graph.QueueConnection( i, j );
+            ADense(i,j) = value;
+            GDense(i,j) = T(1);
+        }
+    }
+    A.ProcessQueues();
+    graph.ProcessQueues();
+    Output("A has ",A.NumEntries()," nonzeros");
+    if( A.NumEntries() < 10000 )
+        LogicError("Too few nonzeros for the threaded kernels");
+
+    const T alpha = SampleUniform( T(0), T(1) );
+    const T beta = SampleUniform( T(0), T(1) );
+    for( const Orientation orientation : { NORMAL, TRANSPOSE, ADJOINT } )
+    {
+        const Int xHeight = ( orientation == NORMAL ? n : m );
+        const Int yHeight = ( orientation == NORMAL ? m : n );
+        const string label =
+          ( orientation == NORMAL ? "A" :
+           (orientation == TRANSPOSE ? "A^T" : "A^H") );
+
+        // Test both a single right-hand side and several, which exercise the
+        // unrolled and the leftover columns
+        for( const Int k : { Int(1), numRHS } )
+        {
+            Matrix<T> X, Y0;
+            Uniform( X, xHeight, k );
+            Uniform( Y0, yHeight, k );
+
+            Matrix<T> Y( Y0 );
+            Multiply( orientation, alpha, A, X, beta, Y );
+            CheckProduct
+            ( orientation, ADense, X, Y0, alpha, beta, Y,
+              label+" X with "+BuildString(k)+" columns" );
+
+            Y = Y0;
+            Multiply( orientation, alpha, graph, X, beta, Y );
+            CheckProduct
+            ( orientation, GDense, X, Y0, alpha, beta, Y,
+              "Graph "+label+" X with "+BuildString(k)+" columns" );
+        }
+
+        // A beta of one must leave the rows of Y outside of A's range intact
+        Matrix<T> X, Y0;
+        Uniform( X, xHeight, numRHS );
+        Uniform( Y0, yHeight, numRHS );
+        Matrix<T> Y( Y0 );
+        Multiply( orientation, alpha, A, X, T(1), Y );
+        CheckProduct
+        ( orientation, ADense, X, Y0, alpha, T(1), Y,
+          label+" X with a unit beta" );
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",2000);
+        const Int n = Input("--n","width of A",1500);
+        const Int numPerRow =
+          Input("--numPerRow","average nonzeros per row of A",8);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",6);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestMultiply<double>( m, n, numPerRow, numRHS );
+            TestMultiply<Complex<double>>( m, n, numPerRow, numRHS );
+        }
+        OutputFromRoot(comm,"Test passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
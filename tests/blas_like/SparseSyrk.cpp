@@ -0,0 +1,328 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A deterministic value for entry (i,j) so that the sequential and
+// distributed matrices agree
+template<typename T>
+T Value( Int i, Int j, Int seed )
+{
+    typedef Base<T> Real;
+    T value = Real((i*31+j*17+seed*7) % 11) - Real(5);
+    if( IsComplex<T>::value )
+        SetImagPart( value, Real((i*13+j*29+seed*3) % 7) - Real(3) );
+    return value;
+}
+
+// Every row has 'numPerRow' (possibly repeated) entries
+template<typename T>
+void RandomPattern( SparseMatrix<T>& A, Int m, Int n, Int numPerRow, Int seed )
+{
+    Zeros( A, m, n );
+    A.Reserve( m*numPerRow );
+    for( Int i=0; i<m; ++i )
+        for( Int t=0; t<numPerRow; ++t )
+        {
+            const Int j = (i*7 + t*(13+seed)) % n;
+            A.QueueUpdate( i, j, Value<T>(i,j,seed) );
+        }
+    A.ProcessQueues();
+}
+
+template<typename T>
+void RandomPattern
+( DistSparseMatrix<T>& A, Int m, Int n, Int numPerRow, Int seed )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( localHeight*numPerRow );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int t=0; t<numPerRow; ++t )
+        {
+            const Int j = (i*7 + t*(13+seed)) % n;
+            A.QueueLocalUpdate( iLoc, j, Value<T>(i,j,seed) );
+        }
+    }
+    A.ProcessLocalQueues();
+}
+
+// The original implementation, which queues every term of A^T A (or A^H A)
+template<typename T>
+void QueuedSyrk
+( UpperOrLower uplo, T alpha, const SparseMatrix<T>& A, SparseMatrix<T>& C,
+  bool conjugate )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( C, n, n );
+    for( Int k=0; k<m; ++k )
+    {
+        const Int offset = A.RowOffset(k);
+        const Int numConn = A.NumConnections(k);
+        for( Int iConn=0; iConn<numConn; ++iConn )
+        {
+            const Int i = A.Col(offset+iConn);
+            const T A_ki = A.Value(offset+iConn);
+            for( Int jConn=0; jConn<numConn; ++jConn )
+            {
+                const Int j = A.Col(offset+jConn);
+                if( (uplo == LOWER && i >= j) || (uplo == UPPER && i <= j) )
+                {
+                    const T A_kj = A.Value(offset+jConn);
+                    if( conjugate )
+                        C.QueueUpdate( i, j, alpha*Conj(A_ki)*A_kj );
+                    else
+                        C.QueueUpdate( i, j, alpha*A_ki*A_kj );
+                }
+            }
+        }
+    }
+    C.ProcessQueues();
+}
+
+template<typename T>
+void QueuedSyrk
+( UpperOrLower uplo, T alpha, const DistSparseMatrix<T>& A,
+  DistSparseMatrix<T>& C, bool conjugate )
+{
+    const Int n = A.Width();
+    Zeros( C, n, n );
+    const Int localHeightA = A.LocalHeight();
+    for( Int kLoc=0; kLoc<localHeightA; ++kLoc )
+    {
+        const Int offset = A.RowOffset(kLoc);
+        const Int numConn = A.NumConnections(kLoc);
+        for( Int iConn=0; iConn<numConn; ++iConn )
+        {
+            const Int i = A.Col(offset+iConn);
+            const T A_ki = A.Value(offset+iConn);
+            for( Int jConn=0; jConn<numConn; ++jConn )
+            {
+                const Int j = A.Col(offset+jConn);
+                if( (uplo==LOWER && i>=j) || (uplo==UPPER && i<=j) )
+                {
+                    const T A_kj = A.Value(offset+jConn);
+                    if( conjugate )
+                        C.QueueUpdate( i, j, alpha*Conj(A_ki)*A_kj );
+                    else
+                        C.QueueUpdate( i, j, alpha*A_ki*A_kj );
+                }
+            }
+        }
+    }
+    C.ProcessQueues();
+}
+
+template<typename T>
+void CheckDiagonal( const SparseMatrix<T>& C, const string& msg )
+{
+    const Int* offsets = C.LockedOffsetBuffer();
+    const Int* targets = C.LockedTargetBuffer();
+    for( Int i=0; i<C.Height(); ++i )
+        if( !std::binary_search( &targets[offsets[i]], &targets[offsets[i+1]],
+                                 i ) )
+            LogicError(msg,": diagonal entry ",i," was not stored");
+}
+
+template<typename T>
+void CheckDiagonal( const DistSparseMatrix<T>& C, const string& msg )
+{
+    const Int* offsets = C.LockedOffsetBuffer();
+    const Int* targets = C.LockedTargetBuffer();
+    for( Int iLoc=0; iLoc<C.LocalHeight(); ++iLoc )
+    {
+        const Int i = C.GlobalRow(iLoc);
+        if( !std::binary_search
+            ( &targets[offsets[iLoc]], &targets[offsets[iLoc+1]], i ) )
+            LogicError(msg,": diagonal entry ",i," was not stored");
+    }
+}
+
+template<typename T>
+void CheckEqual
+( const SparseMatrix<T>& C, const SparseMatrix<T>& CRef, const string& msg )
+{
+    typedef Base<T> Real;
+    Matrix<T> CDense, CRefDense;
+    Copy( C, CDense );
+    Copy( CRef, CRefDense );
+    const Real refNorm = FrobeniusNorm( CRefDense );
+    CDense -= CRefDense;
+    const Real errorNorm = FrobeniusNorm( CDense );
+    if( errorNorm > 100*limits::Epsilon<Real>()*Max(refNorm,Real(1)) )
+        LogicError(msg,": || C - CRef ||_F = ",errorNorm);
+}
+
+template<typename T>
+void CheckEqual
+( const DistSparseMatrix<T>& C, const DistSparseMatrix<T>& CRef,
+  const string& msg )
+{
+    typedef Base<T> Real;
+    DistMatrix<T> CDense(C.Grid()), CRefDense(C.Grid());
+    Copy( C, CDense );
+    Copy( CRef, CRefDense );
+    const Real refNorm = FrobeniusNorm( CRefDense );
+    CDense -= CRefDense;
+    const Real errorNorm = FrobeniusNorm( CDense );
+    if( errorNorm > 100*limits::Epsilon<Real>()*Max(refNorm,Real(1)) )
+        LogicError(msg,": || C - CRef ||_F = ",errorNorm);
+}
+
+template<typename T>
+void TestSequential( Int m, Int n, Int numPerRow )
+{
+    SparseMatrix<T> A, C, CRef;
+    RandomPattern( A, m, n, numPerRow, 0 );
+    const T alpha = T(2);
+    for( const UpperOrLower uplo : {LOWER,UPPER} )
+    {
+        for( const bool conjugate : {false,true} )
+        {
+            const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+            const string msg =
+              string("Sequential ")+(uplo==LOWER?"LOWER":"UPPER")+
+              (conjugate?" ADJOINT":" TRANSPOSE");
+            Syrk( uplo, orientation, alpha, A, C, conjugate );
+            QueuedSyrk( uplo, alpha, A, CRef, conjugate );
+            CheckEqual( C, CRef, msg );
+            CheckDiagonal( C, msg );
+
+            // A A^T (or A A^H) through the NORMAL orientation
+            SparseMatrix<T> B;
+            Transpose( A, B, conjugate );
+            Syrk( uplo, NORMAL, alpha, B, C, conjugate );
+            CheckEqual( C, CRef, msg+" (NORMAL)" );
+        }
+    }
+
+    // Refill a product with new values upon the same pattern
+    SparseMatrix<T> B;
+    Transpose( A, B );
+    SparseProduct<T> product;
+    product.InitializeSyrk( LOWER, B, C );
+    Matrix<T> d;
+    Ones( d, m, 1 );
+    product.Syrk( alpha, B, d, C );
+    QueuedSyrk( LOWER, alpha, A, CRef, false );
+    CheckEqual( C, CRef, "Sequential product" );
+    SparseMatrix<T> A2;
+    RandomPattern( A2, m, n, numPerRow, 0 );
+    A2 *= T(3);
+    Transpose( A2, B );
+    product.Syrk( alpha, B, d, C );
+    QueuedSyrk( LOWER, alpha, A2, CRef, false );
+    CheckEqual( C, CRef, "Sequential refilled product" );
+
+    // A changed pattern must be detected
+    SparseMatrix<T> A3;
+    RandomPattern( A3, m, n, numPerRow, 1 );
+    Transpose( A3, B );
+    bool caught = false;
+    try { product.Syrk( alpha, B, d, C ); }
+    catch( std::exception& ) { caught = true; }
+    if( !caught )
+        LogicError("A changed sparsity pattern was not detected");
+
+    // General products against dense Gemm
+    SparseMatrix<T> E, F;
+    RandomPattern( E, m, n, numPerRow, 2 );
+    RandomPattern( F, n, m, numPerRow, 3 );
+    SparseProduct<T> gemm;
+    gemm.Initialize( E, F, C );
+    gemm.Multiply( alpha, E, F, C );
+    Matrix<T> EDense, FDense, CDense, CProd;
+    Copy( E, EDense );
+    Copy( F, FDense );
+    Gemm( NORMAL, NORMAL, alpha, EDense, FDense, CDense );
+    Copy( C, CProd );
+    CProd -= CDense;
+    if( FrobeniusNorm(CProd) >
+        100*limits::Epsilon<Base<T>>()*FrobeniusNorm(CDense) )
+        LogicError("Sequential sparse product did not match Gemm");
+}
+
+template<typename T>
+void TestDistributed( const Grid& grid, Int m, Int n, Int numPerRow )
+{
+    DistSparseMatrix<T> A(grid), C(grid), CRef(grid), B(grid);
+    RandomPattern( A, m, n, numPerRow, 0 );
+    const T alpha = T(2);
+    for( const UpperOrLower uplo : {LOWER,UPPER} )
+    {
+        for( const bool conjugate : {false,true} )
+        {
+            const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+            const string msg =
+              string("Distributed ")+(uplo==LOWER?"LOWER":"UPPER")+
+              (conjugate?" ADJOINT":" TRANSPOSE");
+            Syrk( uplo, orientation, alpha, A, C, conjugate );
+            QueuedSyrk( uplo, alpha, A, CRef, conjugate );
+            CheckEqual( C, CRef, msg );
+            CheckDiagonal( C, msg );
+
+            Transpose( A, B, conjugate );
+            Syrk( uplo, NORMAL, alpha, B, C, conjugate );
+            CheckEqual( C, CRef, msg+" (NORMAL)" );
+        }
+    }
+
+    // Refill a product with new values upon the same pattern
+    Transpose( A, B );
+    DistSparseProduct<T> product;
+    product.InitializeSyrk( LOWER, B, C );
+    DistMultiVec<T> d(grid);
+    Ones( d, m, 1 );
+    product.Syrk( alpha, B, d, C );
+    QueuedSyrk( LOWER, alpha, A, CRef, false );
+    CheckEqual( C, CRef, "Distributed product" );
+    A *= T(3);
+    Transpose( A, B );
+    product.Syrk( alpha, B, d, C );
+    QueuedSyrk( LOWER, alpha, A, CRef, false );
+    CheckEqual( C, CRef, "Distributed refilled product" );
+}
+
+template<typename T>
+void TestSyrk( const Grid& grid, Int m, Int n, Int numPerRow )
+{
+    if( grid.Rank() == 0 )
+        TestSequential<T>( m, n, numPerRow );
+    TestDistributed<T>( grid, m, n, numPerRow );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",120);
+        const Int n = Input("--n","width of A",90);
+        const Int numPerRow = Input("--numPerRow","entries per row of A",4);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        OutputFromRoot(comm,"Testing with doubles:");
+        TestSyrk<double>( grid, m, n, numPerRow );
+        OutputFromRoot(comm,"Testing with double-precision complex:");
+        TestSyrk<Complex<double>>( grid, m, n, numPerRow );
+
+        OutputFromRoot(comm,"Test passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
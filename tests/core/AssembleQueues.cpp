@@ -0,0 +1,213 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <map>
+using namespace El;
+
+typedef pair<Int,Int> Key;
+
+// A pseudo-random, unordered queue with roughly numEntries/numSources
+// entries per source drawn from 64 targets each, so that there are many
+// duplicates
+Key QueueEntry( Int e, Int numSources )
+{
+    const Int source = (e*7919+13) % numSources;
+    const Int target = (source+5*((e*31) % 64)) % numSources;
+    return Key(source,target);
+}
+
+// Integer-valued so that duplicates are summed exactly in any order
+double EntryValue( Int e ) { return double(e%7) - 3; }
+
+void CheckOffsets
+( const Int* offsets, Int numSources, Int numEdges, const string& msg )
+{
+    if( offsets[0] != 0 || offsets[numSources] != numEdges )
+        LogicError(msg,": the offsets did not span the edges");
+    for( Int s=0; s<numSources; ++s )
+        if( offsets[s+1] < offsets[s] )
+            LogicError(msg,": the offsets were not monotone");
+}
+
+void CheckGraph
+( const Graph& graph, const std::map<Key,double>& reference,
+  const string& msg )
+{
+    const Int numEdges = graph.NumEdges();
+    if( numEdges != Int(reference.size()) )
+        LogicError
+        (msg,": there were ",numEdges," edges rather than ",reference.size());
+    Int e = 0;
+    for( const auto& entry : reference )
+    {
+        if( graph.Source(e) != entry.first.first ||
+            graph.Target(e) != entry.first.second )
+            LogicError
+            (msg,": edge ",e," was (",graph.Source(e),",",graph.Target(e),
+             ") rather than (",entry.first.first,",",entry.first.second,")");
+        ++e;
+    }
+    CheckOffsets
+    ( graph.LockedOffsetBuffer(), graph.NumSources(), numEdges, msg );
+    for( Int s=0; s<graph.NumSources(); ++s )
+        for( Int f=graph.SourceOffset(s); f<graph.SourceOffset(s+1); ++f )
+            if( graph.Source(f) != s )
+                LogicError(msg,": the offset of source ",s," was wrong");
+}
+
+void CheckMatrix
+( const SparseMatrix<double>& A, const std::map<Key,double>& reference,
+  const string& msg )
+{
+    const Int numEntries = A.NumEntries();
+    if( numEntries != Int(reference.size()) )
+        LogicError
+        (msg,": there were ",numEntries," entries rather than ",
+         reference.size());
+    Int e = 0;
+    for( const auto& entry : reference )
+    {
+        if( A.Row(e) != entry.first.first || A.Col(e) != entry.first.second ||
+            A.Value(e) != entry.second )
+            LogicError
+            (msg,": entry ",e," was (",A.Row(e),",",A.Col(e),",",A.Value(e),
+             ") rather than (",entry.first.first,",",entry.first.second,",",
+             entry.second,")");
+        ++e;
+    }
+    CheckOffsets( A.LockedOffsetBuffer(), A.Height(), numEntries, msg );
+}
+
+void TestGraph( Int numSources, Int numEntries )
+{
+    Output("Testing Graph");
+    Graph graph( numSources );
+    std::map<Key,double> reference;
+
+    // An unordered queue with duplicates
+    graph.Reserve( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Key key = QueueEntry( e, numSources );
+        graph.QueueConnection( key.first, key.second );
+        reference[key] = 0;
+    }
+    graph.ProcessQueues();
+    CheckGraph( graph, reference, "Unordered queue" );
+
+    // Drop every third edge while queueing new (unordered) connections
+    vector<Key> removals;
+    Int e = 0;
+    for( const auto& entry : reference )
+        if( e++ % 3 == 0 )
+            removals.push_back( entry.first );
+    graph.Reserve( graph.NumEdges()+numEntries/2 );
+    for( Int f=0; f<numEntries/2; ++f )
+    {
+        const Key key = QueueEntry( numEntries+f, numSources );
+        graph.QueueConnection( key.first, key.second );
+        reference[key] = 0;
+    }
+    for( const Key& key : removals )
+    {
+        graph.QueueDisconnection( key.first, key.second );
+        reference.erase( key );
+    }
+    graph.ProcessQueues();
+    CheckGraph( graph, reference, "Removals" );
+
+    // An in-order queue (with duplicates) takes the fast path
+    Graph orderedGraph( numSources );
+    orderedGraph.Reserve( 2*reference.size() );
+    for( const auto& entry : reference )
+    {
+        orderedGraph.QueueConnection( entry.first.first, entry.first.second );
+        orderedGraph.QueueConnection( entry.first.first, entry.first.second );
+    }
+    orderedGraph.ProcessQueues();
+    CheckGraph( orderedGraph, reference, "Ordered queue" );
+}
+
+void TestSparseMatrix( Int numSources, Int numEntries )
+{
+    Output("Testing SparseMatrix");
+    SparseMatrix<double> A( numSources, numSources );
+    std::map<Key,double> reference;
+
+    // An unordered queue whose duplicates are summed
+    A.Reserve( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Key key = QueueEntry( e, numSources );
+        A.QueueUpdate( key.first, key.second, EntryValue(e) );
+        reference[key] += EntryValue(e);
+    }
+    A.ProcessQueues();
+    CheckMatrix( A, reference, "Unordered queue" );
+
+    // Zero every third entry while queueing new (unordered) updates, some of
+    // which add to existing entries
+    vector<Key> removals;
+    Int e = 0;
+    for( const auto& entry : reference )
+        if( e++ % 3 == 0 )
+            removals.push_back( entry.first );
+    A.Reserve( A.NumEntries()+numEntries/2 );
+    for( Int f=0; f<numEntries/2; ++f )
+    {
+        const Key key = QueueEntry( numEntries+f, numSources );
+        A.QueueUpdate( key.first, key.second, EntryValue(f) );
+        reference[key] += EntryValue(f);
+    }
+    for( const Key& key : removals )
+    {
+        A.QueueZero( key.first, key.second );
+        reference.erase( key );
+    }
+    A.ProcessQueues();
+    CheckMatrix( A, reference, "Removals" );
+
+    // An in-order queue (with duplicates) takes the fast path
+    SparseMatrix<double> B( numSources, numSources );
+    B.Reserve( 2*reference.size() );
+    for( const auto& entry : reference )
+    {
+        B.QueueUpdate( entry.first.first, entry.first.second, 1 );
+        B.QueueUpdate
+        ( entry.first.first, entry.first.second, entry.second-1 );
+    }
+    B.ProcessQueues();
+    CheckMatrix( B, reference, "Ordered queue" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int numSources = Input("--numSources","number of sources",500);
+        const Int numEntries =
+          Input("--numEntries","number of queued entries",20000);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestGraph( numSources, numEntries );
+            TestSparseMatrix( numSources, numEntries );
+        }
+        OutputFromRoot(comm,"Test passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
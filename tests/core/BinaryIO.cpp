@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Every entry of the matrix is distinct so that misplaced entries are caught
+template<typename T>
+T UniqueEntry( Int i, Int j, Int height )
+{ return T(i+j*height) + T(1)/T(7); }
+
+template<typename T>
+void Fill( AbstractDistMatrix<T>& A )
+{
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc,
+              UniqueEntry<T>(A.GlobalRow(iLoc),A.GlobalCol(jLoc),A.Height()) );
+}
+
+template<typename T>
+void Check
+( const AbstractDistMatrix<T>& A, Int height, Int width, const string& msg )
+{
+    if( A.Height() != height || A.Width() != width )
+        LogicError
+        (msg,": read a ",A.Height()," x ",A.Width()," matrix rather than a ",
+         height," x ",width," matrix");
+    Int numWrong = 0;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) !=
+                UniqueEntry<T>(A.GlobalRow(iLoc),A.GlobalCol(jLoc),height) )
+                ++numWrong;
+    numWrong = mpi::AllReduce( numWrong, A.Grid().Comm() );
+    if( numWrong != 0 )
+        LogicError(msg,": ",numWrong," entries were wrong");
+}
+
+// Write A in the given format and read it back into each of the tested
+// distributions, some of them with nontrivial alignments
+template<typename T>
+void TestRoundTrip
+( const AbstractDistMatrix<T>& A, FileFormat format, const string& msg )
+{
+    const Grid& grid = A.Grid();
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const string basename = "BinaryIO-"+msg;
+    const string filename = basename+"."+FileExtension(format);
+    Write( A, basename, format );
+    mpi::Barrier( grid.Comm() );
+
+    DistMatrix<T> B( grid );
+    DistMatrix<T,VC,STAR> BVC( grid );
+    DistMatrix<T,STAR,STAR> BStar( grid );
+    B.Align( 1 % grid.Height(), 1 % grid.Width() );
+    BVC.Align( 1 % grid.Size(), 0 );
+    if( format == BINARY_FLAT )
+    {
+        // The dimensions of flat files are not stored
+        B.Resize( height, width );
+        BVC.Resize( height, width );
+        BStar.Resize( height, width );
+    }
+    Read( B, filename, format );
+    Check( B, height, width, msg+" read as [MC,MR]" );
+    Read( BVC, filename, format );
+    Check( BVC, height, width, msg+" read as [VC,STAR]" );
+    Read( BStar, filename, format );
+    Check( BStar, height, width, msg+" read as [STAR,STAR]" );
+
+    mpi::Barrier( grid.Comm() );
+    if( grid.Rank() == 0 )
+        std::remove( filename.c_str() );
+}
+
+template<typename T>
+void TestDistributions( const Grid& grid, Int height, Int width )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    DistMatrix<T> A( grid );
+    DistMatrix<T,VC,STAR> AVC( grid );
+    DistMatrix<T,STAR,STAR> AStar( grid );
+    A.Align( grid.Height()-1, grid.Width()-1 );
+    A.Resize( height, width );
+    AVC.Resize( height, width );
+    AStar.Resize( height, width );
+    Fill( A );
+    Fill( AVC );
+    Fill( AStar );
+
+    for( const FileFormat format : { BINARY, BINARY_FLAT } )
+    {
+        const string formatName = ( format == BINARY ? "binary" : "flat" );
+        OutputFromRoot(grid.Comm(),"Round trips of ",formatName," files");
+        TestRoundTrip( A, format, "MC_MR-"+formatName );
+        TestRoundTrip( AVC, format, "VC_STAR-"+formatName );
+        TestRoundTrip( AStar, format, "STAR_STAR-"+formatName );
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        // Default to the smallest nontrivial grid height which does not
+        // result in a square grid
+        int defaultGridHeight = 1;
+        for( int r=2; r<=commSize; ++r )
+        {
+            if( commSize % r == 0 && r*r != commSize )
+            {
+                defaultGridHeight = r;
+                break;
+            }
+        }
+        const int gridHeight =
+          Input("--gridHeight","height of process grid",defaultGridHeight);
+        const Int height = Input("--height","height of matrix",37);
+        const Int width = Input("--width","width of matrix",23);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm, gridHeight );
+        OutputFromRoot
+        (comm,"Using a ",grid.Height()," x ",grid.Width()," process grid");
+        TestDistributions<double>( grid, height, width );
+        TestDistributions<Complex<double>>( grid, height, width );
+        OutputFromRoot(comm,"Test passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Write a general sparse matrix with its nonzeros out of order, a repeated
+// nonzero (which should be summed), and interspersed comments and blank lines
+void WriteTestMatrix( const string& filename, Int n, Int numPerRow )
+{
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "%%MatrixMarket matrix coordinate real general\n"
+         << "% A comment in the header\n"
+         << n << " " << n << " " << n*numPerRow+1 << "\n";
+    file.precision( 17 );
+    for( Int k=n*numPerRow-1; k>=0; --k )
+    {
+        const Int i = (k*7) % n;
+        const Int j = (i + k*13) % n;
+        file << i+1 << " " << j+1 << "   " << double(k)/3 - 5 << "\n";
+        if( k % 97 == 0 )
+            file << "% A comment between the nonzeros\n\n";
+    }
+    file << "1 1 2.5\n";
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","height of matrix",500);
+        const Int numPerRow = Input("--numPerRow","nonzeros per row",7);
+        const string filename =
+          Input("--filename","name of the temporary file","mm-test.mtx");
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+            WriteTestMatrix( filename, n, numPerRow );
+        mpi::Barrier( comm );
+
+        SparseMatrix<double> ASeq;
+        Read( ASeq, filename, MATRIX_MARKET );
+
+        const Grid grid( comm );
+        DistSparseMatrix<double> A( grid );
+        Read( A, filename, MATRIX_MARKET );
+        if( A.Height() != n || A.Width() != n )
+            LogicError("Read a ",A.Height()," x ",A.Width()," matrix");
+
+        const Int numLocalEntries = A.NumLocalEntries();
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            if( A.Row(e) < A.FirstLocalRow() ||
+                A.Row(e) >= A.FirstLocalRow()+A.LocalHeight() )
+                LogicError("Row ",A.Row(e)," is not local");
+            const double expected = ASeq.Get( A.Row(e), A.Col(e) );
+            if( Abs(A.Value(e)-expected) > 1e-12*Max(Abs(expected),1.) )
+                LogicError
+                ("Entry (",A.Row(e),",",A.Col(e),") was ",A.Value(e),
+                 " instead of ",expected);
+        }
+        const Int numEntries = mpi::AllReduce( numLocalEntries, comm );
+        if( numEntries != ASeq.NumEntries() )
+            LogicError
+            ("Read ",numEntries," entries instead of ",ASeq.NumEntries());
+
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+        {
+            std::remove( filename.c_str() );
+            Output("Test passed");
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
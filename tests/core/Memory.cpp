@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void Check( bool condition, const string& msg )
+{
+    if( !condition )
+        LogicError(msg);
+}
+
+void TestPool( size_t size )
+{
+    const size_t numBytes = size*sizeof(double);
+    MemoryCtrl ctrl;
+    ctrl.pool = true;
+    ctrl.maxPooledBytes = 4*numBytes;
+    SetMemoryCtrl( ctrl );
+    ReleasePooledMemory();
+    const MemoryStats start = GetMemoryStats();
+    Check( start.bytesPooled == 0, "Released pool was not empty" );
+
+    // A buffer counts as in use until it is freed, after which it is kept
+    const double* firstBuffer;
+    {
+        Memory<double> mem( size );
+        firstBuffer = mem.Buffer();
+        Check( size_t(firstBuffer) % memoryAlignment == 0,
+               "Buffer was not aligned" );
+        const MemoryStats stats = GetMemoryStats();
+        Check( stats.bytesInUse >= start.bytesInUse+numBytes,
+               "Allocation was not counted as in use" );
+        Check( stats.peakBytesInUse >= stats.bytesInUse,
+               "Peak usage was below the current usage" );
+        Check( stats.numAllocations == start.numAllocations+1,
+               "Allocation was not counted" );
+    }
+    MemoryStats stats = GetMemoryStats();
+    Check( stats.bytesInUse == start.bytesInUse,
+           "Freed buffer was still counted as in use" );
+    Check( stats.bytesPooled >= numBytes, "Freed buffer was not pooled" );
+
+    // An allocation of the same size class reuses the buffer
+    {
+        Memory<double> mem( size );
+        Check( mem.Buffer() == firstBuffer, "Pooled buffer was not reused" );
+        const MemoryStats reuseStats = GetMemoryStats();
+        Check( reuseStats.numPoolHits == stats.numPoolHits+1,
+               "Reuse was not counted as a pool hit" );
+        Check( reuseStats.bytesPooled == 0,
+               "Reused buffer was still counted as pooled" );
+    }
+
+    // Releasing the pool returns every cached buffer to the system
+    ReleasePooledMemory();
+    stats = GetMemoryStats();
+    Check( stats.bytesPooled == 0, "Released pool was not empty" );
+    {
+        Memory<double> mem( size );
+        Check( GetMemoryStats().numPoolHits == stats.numPoolHits,
+               "Allocation after a release hit the pool" );
+    }
+
+    // Buffers beyond the cap are returned to the system
+    ReleasePooledMemory();
+    {
+        Memory<double> mem( 8*size );
+    }
+    Check( GetMemoryStats().bytesPooled == 0,
+           "Buffer larger than the cap was pooled" );
+
+    // Disabling the pool releases it, and freed buffers are no longer kept
+    ctrl.pool = false;
+    SetMemoryCtrl( ctrl );
+    Check( GetMemoryStats().bytesPooled == 0,
+           "Disabling the pool did not release it" );
+    {
+        Memory<double> mem( size );
+    }
+    Check( GetMemoryStats().bytesPooled == 0,
+           "Freed buffer was pooled with pooling disabled" );
+
+    ResetPeakMemoryUsage();
+    stats = GetMemoryStats();
+    Check( stats.peakBytesInUse == stats.bytesInUse,
+           "Resetting the peak usage failed" );
+    SetMemoryCtrl( MemoryCtrl() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int size = Input("--size","number of doubles per buffer",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        TestPool( size );
+        OutputFromRoot(comm,"Test passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
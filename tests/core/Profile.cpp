@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",100);
+        const string basename =
+          Input("--basename","basename of the trace files","profile-test");
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        DistMatrix<double> A(grid), B(grid), C(grid);
+        Uniform( A, n, n );
+        Uniform( B, n, n );
+        Zeros( C, n, n );
+
+        profile::Reset();
+        profile::Enable();
+        {
+            profile::Region region("ProfileTest");
+            Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+        }
+        profile::Disable();
+
+        profile::WriteTrace( basename );
+        std::ifstream trace( BuildString(basename,"-",commRank,".json") );
+        string firstLine;
+        if( !std::getline( trace, firstLine ) ||
+            firstLine.find("traceEvents") == string::npos )
+            LogicError("Trace was not written");
+
+        ostringstream summary;
+        profile::PrintSummary( comm, summary );
+        if( commRank == 0 )
+        {
+            Output( summary.str() );
+            std::istringstream stream( summary.str() );
+            string line;
+            bool found = false;
+            while( std::getline( stream, line ) )
+            {
+                std::istringstream fields( line );
+                string name;
+                Int calls;
+                double maxTime, avgTime, maxSelf, gflops, megabytes, messages;
+                fields >> name >> calls >> maxTime >> avgTime >> maxSelf
+                       >> gflops >> megabytes >> messages;
+                if( name != "ProfileTest" )
+                    continue;
+                found = true;
+                if( calls != commSize )
+                    LogicError("Expected ",commSize," calls, not ",calls);
+                if( gflops <= 0 )
+                    LogicError("The flops of the Gemm were not recorded");
+                if( commSize > 1 && messages <= 0 )
+                    LogicError("The messages of the Gemm were not recorded");
+            }
+            if( !found )
+                LogicError("The summary did not contain the region");
+            Output("Test passed");
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
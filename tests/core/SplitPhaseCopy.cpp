@@ -0,0 +1,178 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B, const string& msg )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.ColAlign() != B.ColAlign() || A.RowAlign() != B.RowAlign() )
+        LogicError(msg,": the metadata did not match");
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) != B.GetLocal(iLoc,jLoc) )
+                LogicError
+                (msg,": local entry (",iLoc,",",jLoc,") did not match");
+}
+
+template<typename T>
+void TestCollectives( mpi::Comm comm, Int count )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    OutputFromRoot(comm,"Testing non-blocking and persistent collectives");
+
+    vector<T> sendBuf(commSize*count), recvBuf(commSize*count), result(count);
+    auto entry = [&]( int q, Int i, int round )
+      { return T(q+1) + T(i) + T(round); };
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<count; ++i )
+            sendBuf[q*count+i] = entry( commRank, q*count+i, 0 );
+
+    mpi::Request<T> request;
+    mpi::IAllToAll
+    ( sendBuf.data(), count, recvBuf.data(), count, comm, request );
+    mpi::Wait( request );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<count; ++i )
+            if( recvBuf[q*count+i] != entry( q, commRank*count+i, 0 ) )
+                LogicError("IAllToAll was incorrect");
+
+    mpi::IReduceScatter( sendBuf.data(), result.data(), count, comm, request );
+    mpi::Wait( request );
+    for( Int i=0; i<count; ++i )
+    {
+        T expected = 0;
+        for( int q=0; q<commSize; ++q )
+            expected += entry( q, commRank*count+i, 0 );
+        if( result[i] != expected )
+            LogicError("IReduceScatter was incorrect");
+    }
+
+    // Restart a persistent AllReduce after changing its input each time
+    mpi::Request<T> persistent;
+    mpi::AllReduceInit
+    ( sendBuf.data(), recvBuf.data(), count, mpi::SUM, comm, persistent );
+    for( int round=0; round<3; ++round )
+    {
+        for( Int i=0; i<count; ++i )
+            sendBuf[i] = entry( commRank, i, round );
+        mpi::Start( persistent );
+        mpi::Wait( persistent );
+        for( Int i=0; i<count; ++i )
+        {
+            T expected = 0;
+            for( int q=0; q<commSize; ++q )
+                expected += entry( q, i, round );
+            if( recvBuf[i] != expected )
+                LogicError("Persistent AllReduce was incorrect");
+        }
+    }
+    mpi::Free( persistent );
+}
+
+template<typename T>
+void TestSplitPhaseCopies( const Grid& grid, Int m, Int n, bool print )
+{
+    OutputFromRoot(grid.Comm(),"Testing split-phase redistributions");
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+    if( print )
+        Print( A, "A" );
+
+    // Vary the alignments so that both the overlapped and the fallback
+    // paths are exercised
+    const Int numAligns = Max(grid.Height(),grid.Width())+1;
+    for( Int align=0; align<numAligns; ++align )
+    {
+        PendingCopy<T> pending;
+
+        DistMatrix<T,STAR,MR> A_STAR_MR(grid), B_STAR_MR(grid);
+        A_STAR_MR = A;
+        StartCopy( A, B_STAR_MR, pending );
+        FinishCopy( pending );
+        CheckEqual( A_STAR_MR, B_STAR_MR, "[MC,MR] -> [* ,MR]" );
+
+        DistMatrix<T> B(grid);
+        B.AlignCols( Mod(align,grid.Height()) );
+        StartCopy( A_STAR_MR, B, pending );
+        FinishCopy( pending );
+        DistMatrix<T> C(grid);
+        C.AlignCols( Mod(align,grid.Height()) );
+        C = A_STAR_MR;
+        CheckEqual( C, B, "[* ,MR] -> [MC,MR]" );
+
+        DistMatrix<T,VC,STAR> A_VC_STAR(grid), B_VC_STAR(grid);
+        A_VC_STAR.AlignCols( Mod(align,grid.Size()) );
+        B_VC_STAR.AlignCols( Mod(align,grid.Size()) );
+        A_VC_STAR = A;
+        StartCopy( A, B_VC_STAR, pending );
+        // The source may be overwritten once the copy has started
+        DistMatrix<T> ACopy( A );
+        Zero( A );
+        FinishCopy( pending );
+        A = ACopy;
+        CheckEqual( A_VC_STAR, B_VC_STAR, "[MC,MR] -> [VC,* ]" );
+
+        B.Empty();
+        B.AlignCols( Mod(align,grid.Height()) );
+        C.Empty();
+        C.AlignCols( Mod(align,grid.Height()) );
+        StartCopy( A_VC_STAR, B, pending );
+        FinishCopy( pending );
+        C = A_VC_STAR;
+        CheckEqual( C, B, "[VC,* ] -> [MC,MR]" );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",101);
+        const Int n = Input("--n","width of matrix",53);
+        const Int count = Input("--count","entries per process",17);
+        const Int gridHeight = Input("--gridHeight","process grid height",0);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( !EL_HAVE_NONBLOCKING )
+        {
+            OutputFromRoot
+            (comm,"Non-blocking collectives are unavailable; "
+             "only testing the blocking fallbacks");
+        }
+        else
+        {
+            TestCollectives<double>( comm, count );
+            TestCollectives<Complex<double>>( comm, count );
+        }
+
+        const int height =
+          ( gridHeight==0 ? Grid::DefaultHeight(mpi::Size(comm)) :
+                            gridHeight );
+        const Grid grid( comm, height );
+        TestSplitPhaseCopies<double>( grid, m, n, print );
+        TestSplitPhaseCopies<Complex<double>>( grid, m, n, print );
+
+        OutputFromRoot(comm,"Test passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
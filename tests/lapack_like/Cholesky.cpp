@@ -139,7 +139,8 @@ void TestCholesky
   bool print,
   bool printDiag,
   bool correctness,
-  bool scalapack )
+  bool scalapack,
+  bool lookahead )
 {
     OutputFromRoot(g.Comm(),"Testing distributed Cholesky with ",TypeName<F>());
     PushIndent();
@@ -148,43 +149,54 @@ void TestCholesky
 
     SetLocalTrrkBlocksize<F>( nbLocal );
 
-    HermitianUniformSpectrum( A, m, 1e-9, 10 );
-    if( correctness )
-        AOrig = A;
+    HermitianUniformSpectrum( AOrig, m, 1e-9, 10 );
     if( print )
-        Print( A, "A" );
+        Print( AOrig, "A" );
 
-    if( scalapack && !pivot )
-        OutputFromRoot
-        (g.Comm(),"ScaLAPACK Cholesky (including round-trip conversion)...");
-    else
-        OutputFromRoot(g.Comm(),"Elemental Cholesky...");
-    mpi::Barrier( g.Comm() );
-    Timer timer;
-    timer.Start();
-    if( pivot )
-        Cholesky( uplo, A, p );
-    else
-        Cholesky( uplo, A, scalapack );
-    mpi::Barrier( g.Comm() );
-    const double runTime = timer.Stop();
-    const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
-    const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
-    OutputFromRoot(g.Comm(),runTime," seconds (",gFlops," GFlop/s)");
-    if( print )
+    // The pipelined variant is only run on top of the standard one
+    const Int numVariants = ( lookahead && !pivot && !scalapack ? 2 : 1 );
+    for( Int variant=0; variant<numVariants; ++variant )
     {
-        Print( A, "A after factorization" );
+        A = AOrig;
+        CholeskyCtrl ctrl;
+        ctrl.scalapack = scalapack;
+        ctrl.lookahead = ( variant == 1 );
+        if( scalapack && !pivot )
+            OutputFromRoot
+            (g.Comm(),
+             "ScaLAPACK Cholesky (including round-trip conversion)...");
+        else if( ctrl.lookahead )
+            OutputFromRoot(g.Comm(),"Elemental Cholesky with lookahead...");
+        else
+            OutputFromRoot(g.Comm(),"Elemental Cholesky...");
+        mpi::Barrier( g.Comm() );
+        Timer timer;
+        timer.Start();
         if( pivot )
+            Cholesky( uplo, A, p );
+        else
+            Cholesky( uplo, A, ctrl );
+        mpi::Barrier( g.Comm() );
+        const double runTime = timer.Stop();
+        const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
+        const double gFlops =
+          ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
+        OutputFromRoot(g.Comm(),runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
         {
-            DistMatrix<Int,VC,STAR> P(g);
-            p.ExplicitMatrix( P );
-            Print( P, "P" );
+            Print( A, "A after factorization" );
+            if( pivot )
+            {
+                DistMatrix<Int,VC,STAR> P(g);
+                p.ExplicitMatrix( P );
+                Print( P, "P" );
+            }
         }
+        if( printDiag )
+            Print( GetRealPartOfDiagonal(A), "diag(A)" );
+        if( correctness )
+            TestCorrectness( pivot, uplo, A, p, AOrig );
     }
-    if( printDiag )
-        Print( GetRealPartOfDiagonal(A), "diag(A)" );
-    if( correctness )
-        TestCorrectness( pivot, uplo, A, p, AOrig );
     PopIndent();
 }
 
@@ -208,6 +220,8 @@ main( int argc, char* argv[] )
         const bool print = Input("--print","print matrices?",false);
         const bool printDiag = Input("--printDiag","print diag of fact?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool lookahead =
+          Input("--lookahead","also test the pipelined variant?",true);
 #ifdef EL_HAVE_SCALAPACK
         const bool scalapack = Input("--scalapack","test ScaLAPACK?",false);
 #else
@@ -272,49 +286,49 @@ main( int argc, char* argv[] )
 
         TestCholesky<float>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
         TestCholesky<Complex<float>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
         TestCholesky<double>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
         TestCholesky<Complex<double>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
 
 #ifdef EL_HAVE_QD
         TestCholesky<DoubleDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
         TestCholesky<QuadDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
 
         TestCholesky<Complex<DoubleDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
         TestCholesky<Complex<QuadDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestCholesky<Quad>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
         TestCholesky<Complex<Quad>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestCholesky<BigFloat>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
         TestCholesky<Complex<BigFloat>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
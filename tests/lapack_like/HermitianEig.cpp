@@ -229,6 +229,14 @@ void TestSuite
     {
         TestHermitianEigSequential<F>
         ( m, uplo, onlyEigvals, clustered, correctness, print, ctrl );
+
+        Output("Two-stage tridiagonalization:");
+        auto twoStageCtrl = ctrl;
+        twoStageCtrl.tridiagCtrl.twoStage = true;
+        twoStageCtrl.tridiagCtrl.bandwidth = ctrlDbl.tridiagCtrl.bandwidth;
+        TestHermitianEigSequential<F>
+        ( m, uplo, onlyEigvals, clustered, correctness, print,
+          twoStageCtrl );
     }
     if( distributed )
     {
@@ -285,6 +293,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int bandwidth =
+          Input("--bandwidth","bandwidth for two-stage tridiag",8);
         const bool avoidTrmv =
           Input("--avoidTrmv","avoid Trmv based Symv",true);
         const bool useScaLAPACK =
@@ -340,6 +350,7 @@ main( int argc, char* argv[] )
         ctrl.useScaLAPACK = useScaLAPACK;
         ctrl.tridiagCtrl.symvCtrl.bsize = nbLocal;
         ctrl.tridiagCtrl.symvCtrl.avoidTrmvBasedLocalSymv = avoidTrmv;
+        ctrl.tridiagCtrl.bandwidth = bandwidth;
         ctrl.tridiagEigCtrl.sort = sort;
         ctrl.tridiagEigCtrl.alg = alg;
         ctrl.tridiagEigCtrl.subset = subset;
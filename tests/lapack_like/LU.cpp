@@ -181,7 +181,8 @@ void TestLU
   Int pivoting,
   bool correctness,
   bool forceGrowth,
-  bool print )
+  bool print,
+  bool lookahead )
 {
     OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
     PushIndent();
@@ -189,62 +190,45 @@ void TestLU
     DistPermutation P(grid), Q(grid);
 
     if( forceGrowth )
-        GEPPGrowth( A, m );
+        GEPPGrowth( AOrig, m );
     else
-        Uniform( A, m, m );
-
-    if( correctness )
-        AOrig = A;
+        Uniform( AOrig, m, m );
     if( print )
-        Print( A, "A" );
+        Print( AOrig, "A" );
 
-    OutputFromRoot(grid.Comm(),"Starting LU factorization...");
-    mpi::Barrier( grid.Comm() );
-    Timer timer;
-    timer.Start();
-    if( pivoting == 0 )
-        LU( A );
-    else if( pivoting == 1 )
-        LU( A, P );
-    else if( pivoting == 2 )
-        LU( A, P, Q );
-    mpi::Barrier( grid.Comm() );
-    const double runTime = timer.Stop();
-    const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
-    const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
-    OutputFromRoot(grid.Comm(),runTime," seconds (",gFlops," GFlop/s)");
-    if( print )
+    // The pipelined variant is only run on top of the standard one
+    const bool singlePerm = ( pivoting == 1 || pivoting == 3 );
+    const Int numVariants = ( lookahead && singlePerm ? 2 : 1 );
+    for( Int variant=0; variant<numVariants; ++variant )
     {
-        Print( A, "A after factorization" );
-        if( pivoting >= 1 )
-        {
-            // This needs to be rewritten in light of DistPermutation
-            /*
-            DistMatrix<Int> P(grid);
-            DistMatrix<Int,STAR,STAR> p(grid);
-            Print( P, "rowPiv after factorization" );
-            PivotsToPermutation( rowPiv, p );
-            Print( p, "p after factorization");
-            ExplicitPermutation( p, P );
-            Print( P, "P" );
-            */
-        }
-        if( pivoting == 2 )
-        {
-            // This needs to be rewritten in light of DistPermutation
-            /*
-            DistMatrix<Int> Q(grid);
-            DistMatrix<Int,STAR,STAR> q(grid);
-            Print( colPiv, "colPiv after factorization" );
-            PivotsToPermutation( colPiv, q );
-            Print( q, "q after factorization");
-            ExplicitPermutation( q, Q );
-            Print( Q, "Q" );
-            */
-        }
+        A = AOrig;
+        LUCtrl ctrl;
+        ctrl.pivotType = ( pivoting == 3 ? LU_TOURNAMENT : LU_PARTIAL );
+        ctrl.lookahead = ( variant == 1 );
+        OutputFromRoot
+        (grid.Comm(),"Starting ",(ctrl.lookahead ? "lookahead " : ""),
+         "LU factorization...");
+        mpi::Barrier( grid.Comm() );
+        Timer timer;
+        timer.Start();
+        if( pivoting == 0 )
+            LU( A );
+        else if( pivoting == 2 )
+            LU( A, P, Q );
+        else
+            LU( A, P, ctrl );
+        mpi::Barrier( grid.Comm() );
+        const double runTime = timer.Stop();
+        const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
+        const double gFlops =
+          IsComplex<Field>::value ? 4*realGFlops : realGFlops;
+        OutputFromRoot(grid.Comm(),runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+            Print( A, "A after factorization" );
+        if( correctness )
+            TestCorrectness
+            ( AOrig, A, P, Q, ( pivoting==3 ? 1 : pivoting ), print );
     }
-    if( correctness )
-        TestCorrectness( AOrig, A, P, Q, pivoting, print );
     PopIndent();
 }
 
@@ -260,10 +244,13 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
-        const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const Int pivot =
+          Input("--pivot","0: none, 1: partial, 2: full, 3: tournament",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool lookahead =
+          Input("--lookahead","also test the pipelined variant?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -272,7 +259,7 @@ main( int argc, char* argv[] )
 #endif
         ProcessInput();
         PrintInputReport();
-        if( pivot < 0 || pivot > 2 )
+        if( pivot < 0 || pivot > 3 )
             LogicError("Invalid pivot value");
 
 #ifdef EL_HAVE_MPC
@@ -291,81 +278,96 @@ main( int argc, char* argv[] )
             OutputFromRoot(grid.Comm(),"Testing LU with partial pivoting");
         else if( pivot == 2 )
             OutputFromRoot(grid.Comm(),"Testing LU with full pivoting");
+        else if( pivot == 3 )
+            OutputFromRoot
+            (grid.Comm(),"Testing LU with tournament pivoting");
 
+        // A tournament over a single process is simply partial pivoting
+        const Int seqPivot = ( pivot==3 ? 1 : pivot );
         if( sequential && mpi::Rank() == 0 )
         {
             TestLU<float>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
             TestLU<Complex<float>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
 
             TestLU<double>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
             TestLU<Complex<double>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
 
 #ifdef EL_HAVE_QD
             TestLU<DoubleDouble>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
             TestLU<QuadDouble>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
 
             TestLU<Complex<DoubleDouble>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
             TestLU<Complex<QuadDouble>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestLU<Quad>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
             TestLU<Complex<Quad>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestLU<BigFloat>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
             TestLU<Complex<BigFloat>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, seqPivot, correctness, forceGrowth, print );
 #endif
         }
 
         TestLU<float>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
         TestLU<Complex<float>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
 
         TestLU<double>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
         TestLU<Complex<double>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
 
 #ifdef EL_HAVE_QD
         TestLU<DoubleDouble>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
         TestLU<QuadDouble>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
 
         TestLU<Complex<DoubleDouble>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
         TestLU<Complex<QuadDouble>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestLU<Quad>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
         TestLU<Complex<Quad>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestLU<BigFloat>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
         TestLU<Complex<BigFloat>>
-        ( grid, m, pivot, correctness, forceGrowth, print );
+        ( grid, m, pivot, correctness, forceGrowth, print, lookahead );
 #endif
+
+        if( pivot == 1 )
+        {
+            OutputFromRoot
+            (grid.Comm(),"Testing LU with tournament pivoting");
+            TestLU<double>
+            ( grid, m, 3, correctness, forceGrowth, print, lookahead );
+            TestLU<Complex<double>>
+            ( grid, m, 3, correctness, forceGrowth, print, lookahead );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
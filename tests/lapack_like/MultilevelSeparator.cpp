@@ -0,0 +1,142 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Append the neighbors of vertex i of the n x n x n 7-point stencil (in
+// natural ordering) to the adjacency list
+void AppendNeighbors( Int i, Int n, vector<Int>& targets )
+{
+    const Int x = i % n;
+    const Int y = (i/n) % n;
+    const Int z = i/(n*n);
+    if( x != 0 )   targets.push_back( i-1 );
+    if( x != n-1 ) targets.push_back( i+1 );
+    if( y != 0 )   targets.push_back( i-n );
+    if( y != n-1 ) targets.push_back( i+n );
+    if( z != 0 )   targets.push_back( i-n*n );
+    if( z != n-1 ) targets.push_back( i+n*n );
+}
+
+// Ensure that no edge joins the two halves, that the halves are balanced,
+// and that the separator is not much larger than a plane of the grid
+void CheckSeparator
+( Int n, const vector<Int>& part, const BisectCtrl& ctrl, const string& msg )
+{
+    const Int numVertices = n*n*n;
+    Int sizes[3] = { 0, 0, 0 };
+    vector<Int> targets;
+    for( Int i=0; i<numVertices; ++i )
+    {
+        if( part[i] < 0 || part[i] > 2 )
+            LogicError(msg,": vertex ",i," had part ",part[i]);
+        ++sizes[part[i]];
+        if( part[i] == 2 )
+            continue;
+        targets.resize( 0 );
+        AppendNeighbors( i, n, targets );
+        for( const Int j : targets )
+            if( part[j] == 1-part[i] )
+                LogicError
+                (msg,": vertices ",i," and ",j," joined the two halves");
+    }
+    Output
+    ("  ",msg,": halves of size ",sizes[0]," and ",sizes[1],
+     " with a separator of size ",sizes[2]);
+    if( Max(sizes[0],sizes[1]) > ctrl.maxImbalance*(sizes[0]+sizes[1])/2 )
+        LogicError(msg,": the halves were not balanced");
+    if( Min(sizes[0],sizes[1]) == 0 )
+        LogicError(msg,": one of the halves was empty");
+    if( sizes[2] > 3*n*n )
+        LogicError(msg,": the separator was too large");
+}
+
+void TestSequential( Int n, const BisectCtrl& ctrl )
+{
+    Output("Testing the sequential engine");
+    const Int numVertices = n*n*n;
+    vector<Int> offsets( numVertices+1 ), targets;
+    for( Int i=0; i<numVertices; ++i )
+    {
+        offsets[i] = targets.size();
+        AppendNeighbors( i, n, targets );
+    }
+    offsets[numVertices] = targets.size();
+
+    vector<Int> part;
+    MultilevelSeparator( offsets, targets, part, ctrl );
+    CheckSeparator( n, part, ctrl, "Sequential" );
+}
+
+void TestDistributed( Int n, const BisectCtrl& ctrl, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing the distributed engine");
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int numVertices = n*n*n;
+    const Int blocksize = numVertices / commSize;
+    const Int firstLocal = commRank*blocksize;
+    const Int numLocal =
+      ( commRank == commSize-1 ? numVertices-firstLocal : blocksize );
+
+    vector<Int> offsets( numLocal+1 ), targets;
+    for( Int iLocal=0; iLocal<numLocal; ++iLocal )
+    {
+        offsets[iLocal] = targets.size();
+        AppendNeighbors( firstLocal+iLocal, n, targets );
+    }
+    offsets[numLocal] = targets.size();
+
+    vector<Int> localPart;
+    MultilevelSeparator
+    ( offsets, targets, firstLocal, numVertices, localPart, comm, ctrl );
+    if( Int(localPart.size()) != numLocal )
+        LogicError("The local part had the wrong length");
+
+    vector<int> sizes( commSize ), offs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        offs[q] = q*blocksize;
+        sizes[q] = ( q == commSize-1 ? numVertices-offs[q] : blocksize );
+    }
+    vector<Int> part( numVertices );
+    mpi::AllGather
+    ( localPart.data(), numLocal, part.data(), sizes.data(), offs.data(),
+      comm );
+    if( commRank == 0 )
+        CheckSeparator( n, part, ctrl, "Distributed" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of n x n x n grid",20);
+        const Int numSeqSeps =
+          Input("--numSeqSeps","number of sequential separators to try",1);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.useMETIS = false;
+        ctrl.numSeqSeps = numSeqSeps;
+
+        if( mpi::Rank(comm) == 0 )
+            TestSequential( n, ctrl );
+        TestDistributed( n, ctrl, comm );
+        OutputFromRoot(comm,"Test passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
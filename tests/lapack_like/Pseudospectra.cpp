@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A non-normal upper-triangular matrix with its eigenvalues on a circle
+template<typename Real>
+void Triangle( Matrix<Complex<Real>>& U, Int n )
+{
+    Zeros( U, n, n );
+    for( Int j=0; j<n; ++j )
+    {
+        const Real theta = 2*Pi<Real>()*j/n;
+        U(j,j) = Complex<Real>( Cos(theta), Sin(theta) );
+        for( Int i=0; i<j; ++i )
+            U(i,j) = Complex<Real>( Real(1)/(j-i+1), Real(i%3)/(j+1) );
+    }
+}
+
+template<typename Real>
+void Shifts( Matrix<Complex<Real>>& shifts, Int numReal, Int numImag )
+{
+    shifts.Resize( numReal*numImag, 1 );
+    for( Int j=0; j<numImag; ++j )
+        for( Int i=0; i<numReal; ++i )
+            shifts(i+j*numReal) =
+              Complex<Real>
+              ( Real(-1.7) + Real(3.4)*i/(numReal-1),
+                Real(-1.65) + Real(3.3)*j/(numImag-1) );
+}
+
+template<typename Real>
+void CheckInvNorms
+( const Matrix<Complex<Real>>& U,
+  const Matrix<Complex<Real>>& shifts,
+  const Matrix<Real>& invNorms,
+  Real tol )
+{
+    const Int n = U.Height();
+    const Int numShifts = shifts.Height();
+    if( invNorms.Height() != numShifts )
+        LogicError("Expected ",numShifts," estimates, not ",invNorms.Height());
+    Matrix<Complex<Real>> UShift;
+    Matrix<Real> s;
+    Real maxRelError = 0;
+    for( Int k=0; k<numShifts; ++k )
+    {
+        UShift = U;
+        ShiftDiagonal( UShift, -shifts(k) );
+        SVD( UShift, s );
+        const Real invNorm = 1/s(n-1);
+        maxRelError =
+          Max( maxRelError, Abs(invNorms(k)-invNorm)/invNorm );
+    }
+    Output("max relative error of the estimates: ",maxRelError);
+    if( maxRelError > tol )
+        LogicError("Estimates were not accurate");
+}
+
+template<typename Real>
+void TestSequential
+( const Matrix<Complex<Real>>& U,
+  const Matrix<Complex<Real>>& shifts,
+  const PseudospecCtrl<Real>& psCtrl,
+  Int chunkSize,
+  Real tol )
+{
+    const Int numShifts = shifts.Height();
+    Matrix<Real> invNorms;
+
+    Output("Lock-step shifts");
+    TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
+    CheckInvNorms( U, shifts, invNorms, tol );
+
+    Output("Chunks of ",chunkSize," shifts");
+    PseudospecCtrl<Real> chunkCtrl( psCtrl );
+    chunkCtrl.shiftChunkSize = chunkSize;
+    vector<Int> visits( numShifts, 0 );
+    chunkCtrl.chunkCallback =
+      [&]( Int first, const Matrix<Real>& chunkInvNorms,
+           const Matrix<Int>& chunkItCounts )
+      {
+          for( Int k=0; k<chunkInvNorms.Height(); ++k )
+              ++visits[first+k];
+      };
+    TriangularSpectralCloud( U, shifts, invNorms, chunkCtrl );
+    CheckInvNorms( U, shifts, invNorms, tol );
+    for( Int k=0; k<numShifts; ++k )
+        if( visits[k] != 1 )
+            LogicError("Shift ",k," was reported ",visits[k]," times");
+}
+
+template<typename Real>
+void TestDistributed
+( const Grid& grid,
+  const Matrix<Complex<Real>>& U,
+  const Matrix<Complex<Real>>& shifts,
+  const PseudospecCtrl<Real>& psCtrl,
+  Int numTeams,
+  Real tol )
+{
+    DistMatrix<Complex<Real>> UDist( grid );
+    DistMatrix<Complex<Real>,VR,STAR> shiftsDist( grid );
+    DistMatrix<Real,VR,STAR> invNorms( grid );
+    UDist.Resize( U.Height(), U.Width() );
+    shiftsDist.Resize( shifts.Height(), 1 );
+    for( Int jLoc=0; jLoc<UDist.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<UDist.LocalHeight(); ++iLoc )
+            UDist.SetLocal
+            ( iLoc, jLoc, U(UDist.GlobalRow(iLoc),UDist.GlobalCol(jLoc)) );
+    for( Int iLoc=0; iLoc<shiftsDist.LocalHeight(); ++iLoc )
+        shiftsDist.SetLocal( iLoc, 0, shifts(shiftsDist.GlobalRow(iLoc)) );
+
+    OutputFromRoot(grid.Comm(),numTeams," teams of processes");
+    PseudospecCtrl<Real> teamCtrl( psCtrl );
+    teamCtrl.numShiftTeams = numTeams;
+    TriangularSpectralCloud( UDist, shiftsDist, invNorms, teamCtrl );
+
+    DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( invNorms );
+    if( grid.Rank() == 0 )
+        CheckInvNorms( U, shifts, invNorms_STAR_STAR.LockedMatrix(), tol );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of triangular matrix",30);
+        const Int numReal = Input("--numReal","number of real shifts",6);
+        const Int numImag = Input("--numImag","number of imaginary shifts",6);
+        const Int chunkSize = Input("--chunkSize","shifts per chunk",5);
+        const Int numTeams = Input("--numTeams","number of teams",2);
+        const double tol = Input("--tol","relative tolerance",1e-2);
+        ProcessInput();
+        PrintInputReport();
+
+        Matrix<Complex<double>> U, shifts;
+        Triangle( U, n );
+        Shifts( shifts, numReal, numImag );
+
+        PseudospecCtrl<double> psCtrl;
+        psCtrl.tol = 1e-10;
+        psCtrl.maxIts = 200;
+
+        if( mpi::Rank(comm) == 0 )
+            TestSequential( U, shifts, psCtrl, chunkSize, tol );
+
+        const Grid grid( comm );
+        TestDistributed( grid, U, shifts, psCtrl, Int(1), tol );
+        if( commSize > 1 )
+            TestDistributed( grid, U, shifts, psCtrl, numTeams, tol );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
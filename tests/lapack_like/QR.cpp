@@ -178,32 +178,45 @@ void TestQR
     DistMatrix<Field,MD,STAR> householderScalars(grid);
     DistMatrix<Base<Field>,MD,STAR> signature(grid);
 
-    Uniform( A, m, n );
-    if( correctness )
-        AOrig = A;
+    Uniform( AOrig, m, n );
     if( print )
-        Print( A, "A" );
+        Print( AOrig, "A" );
     const double mD = double(m);
     const double nD = double(n);
 
-    OutputFromRoot(grid.Comm(),"Starting QR factorization...");
-    mpi::Barrier( grid.Comm() );
-    const double startTime = mpi::Time();
-    QR( A, householderScalars, signature );
-    mpi::Barrier( grid.Comm() );
-    const double runTime = mpi::Time() - startTime;
-    const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
-    const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
-    OutputFromRoot
-    (grid.Comm(),"Elemental: ",runTime," seconds. GFlops = ",gFlops);
-    if( print )
+    // Test the standard, communication-avoiding, and pipelined algorithms
+    for( Int variant=0; variant<3; ++variant )
     {
-        Print( A, "A after factorization" );
-        Print( householderScalars, "householderScalars" );
-        Print( signature, "signature" );
+        A = AOrig;
+        QRCtrl<Base<Field>> ctrl;
+        ctrl.caqr = ( variant == 1 );
+        ctrl.lookahead = ( variant == 2 );
+        const string name =
+          ( variant == 0 ? "QR" : variant == 1 ? "CAQR" : "lookahead QR" );
+        OutputFromRoot(grid.Comm(),"Starting ",name," factorization...");
+        mpi::Barrier( grid.Comm() );
+        const double startTime = mpi::Time();
+        QR( A, householderScalars, signature, ctrl );
+        mpi::Barrier( grid.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        const double realGFlops =
+          (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
+        const double gFlops =
+          IsComplex<Field>::value ? 4*realGFlops : realGFlops;
+        OutputFromRoot
+        (grid.Comm(),"Elemental: ",runTime," seconds. GFlops = ",gFlops);
+        if( print )
+        {
+            Print( A, "A after factorization" );
+            Print( householderScalars, "householderScalars" );
+            Print( signature, "signature" );
+        }
+        if( correctness )
+        {
+            auto ACopy( AOrig );
+            TestCorrectness( A, householderScalars, signature, ACopy );
+        }
     }
-    if( correctness )
-        TestCorrectness( A, householderScalars, signature, AOrig );
     PopIndent();
 }
 
@@ -59,6 +59,7 @@ void TestQR
 ( const Grid& g,
   Int m,
   Int n,
+  Int flatWidth,
   bool correctness,
   bool print )
 {
@@ -75,10 +76,12 @@ void TestQR
 
     Timer timer;
 
-    OutputFromRoot(g.Comm(),"Starting TSQR factorization...");
+    OutputFromRoot
+    (g.Comm(),"Starting TSQR factorization with flat width ",flatWidth,
+     "...");
     mpi::Barrier( g.Comm() );
     timer.Start();
-    qr::ExplicitTS( AFact, R );
+    qr::ExplicitTS( AFact, R, flatWidth );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double mD = double(m);
@@ -108,6 +111,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int flatWidth =
+          Input("--flatWidth","processes per flat tree (0 for a node)",0);
         const bool correctness =
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -128,39 +133,39 @@ main( int argc, char* argv[] )
         OutputFromRoot(comm,"Will test TSQR");
 
         TestQR<float>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
         TestQR<Complex<float>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
 
         TestQR<double>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
         TestQR<Complex<double>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
 
 #ifdef EL_HAVE_QD
         TestQR<DoubleDouble>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
         TestQR<QuadDouble>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
 
         TestQR<Complex<DoubleDouble>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
         TestQR<Complex<QuadDouble>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestQR<Quad>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
         TestQR<Complex<Quad>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestQR<BigFloat>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
         TestQR<Complex<BigFloat>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, flatWidth, correctness, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The eigenvalues of the dense matrix in the order of preference of the target
+template<typename Real>
+vector<Real> ReferenceEigenvalues
+( const Matrix<Real>& wAll, LanczosTarget target, Real shift )
+{
+    const Int n = wAll.Height();
+    vector<Real> wRef( n );
+    for( Int j=0; j<n; ++j )
+        wRef[j] = wAll(j);
+    if( target == LANCZOS_SMALLEST )
+        std::sort( wRef.begin(), wRef.end() );
+    else if( target == LANCZOS_LARGEST )
+        std::sort( wRef.begin(), wRef.end(), std::greater<Real>() );
+    else
+        std::sort
+        ( wRef.begin(), wRef.end(),
+          [&]( const Real& alpha, const Real& beta )
+          { return Abs(alpha-shift) < Abs(beta-shift); } );
+    return wRef;
+}
+
+template<typename Real>
+void CheckEigenvalues
+( const Matrix<Real>& w, const vector<Real>& wRef, Int numConverged,
+  Real ANorm, Real tol, const string& msg )
+{
+    const Int numEigs = w.Height();
+    if( numConverged != numEigs )
+        LogicError
+        (msg,": only ",numConverged," of ",numEigs," eigenpairs converged");
+    for( Int j=0; j<numEigs; ++j )
+        if( Abs(w(j)-wRef[j]) > tol*ANorm )
+            LogicError
+            (msg,": eigenvalue ",j," was ",w(j)," instead of ",wRef[j]);
+}
+
+template<typename F>
+void TestLanczos
+( const Grid& grid, Int n, Int numEigs, Int blockSize, LanczosTarget target,
+  const string& targetName, bool print )
+{
+    typedef Base<F> Real;
+    const int commRank = mpi::Rank( grid.Comm() );
+    OutputFromRoot(grid.Comm(),"Testing ",targetName);
+
+    SparseMatrix<F> A;
+    Laplacian( A, n );
+    Matrix<F> ADense;
+    Copy( A, ADense );
+    Matrix<Real> wAll;
+    HermitianEig( LOWER, ADense, wAll );
+    Real ANorm = 0;
+    for( Int j=0; j<n; ++j )
+        ANorm = Max( ANorm, Abs(wAll(j)) );
+
+    // Place the shift between two eigenvalues in the interior of the
+    // spectrum, closer to one of them
+    Sort( wAll );
+    const Real shift = (3*wAll(n/2)+7*wAll(n/2+1))/10;
+    const vector<Real> wRef = ReferenceEigenvalues( wAll, target, shift );
+
+    ThickRestartLanczosCtrl<Real> ctrl;
+    ctrl.numEigs = numEigs;
+    ctrl.blockSize = blockSize;
+    ctrl.target = target;
+    ctrl.shift = shift;
+    const Real tol = 10*ctrl.tol;
+
+    Matrix<Real> w;
+    Matrix<F> X;
+    Int numConverged = ThickRestartLanczos( A, w, X, ctrl );
+    if( print && commRank == 0 )
+        Print( w, "w (sequential)" );
+    CheckEigenvalues( w, wRef, numConverged, ANorm, tol, "Sequential" );
+
+    DistSparseMatrix<F> ADist(grid);
+    Laplacian( ADist, n );
+    DistMultiVec<F> XDist(grid);
+    numConverged = ThickRestartLanczos( ADist, w, XDist, ctrl );
+    if( print && commRank == 0 )
+        Print( w, "w (distributed)" );
+    CheckEigenvalues( w, wRef, numConverged, ANorm, tol, "Distributed" );
+}
+
+template<typename F>
+void TestTargets
+( const Grid& grid, Int n, Int numEigs, Int blockSize, bool print )
+{
+    TestLanczos<F>
+    ( grid, n, numEigs, blockSize, LANCZOS_SMALLEST, "smallest", print );
+    TestLanczos<F>
+    ( grid, n, numEigs, blockSize, LANCZOS_LARGEST, "largest", print );
+    TestLanczos<F>
+    ( grid, n, numEigs, blockSize, LANCZOS_NEAREST_SHIFT, "nearest shift",
+      print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of the 1D Laplacian",50);
+        const Int numEigs = Input("--numEigs","number of eigenpairs",4);
+        const Int blockSize = Input("--blockSize","Lanczos block size",1);
+        const bool print = Input("--print","print eigenvalues?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        OutputFromRoot(comm,"Testing with doubles:");
+        TestTargets<double>( grid, n, numEigs, blockSize, print );
+        OutputFromRoot(comm,"Testing with double-precision complex:");
+        TestTargets<Complex<double>>( grid, n, numEigs, blockSize, print );
+
+        OutputFromRoot(comm,"Test passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
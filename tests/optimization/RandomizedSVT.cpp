@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A rank-'rank' matrix with singular values well above one plus a
+// perturbation far below the soft-threshold parameter
+template<typename F>
+void LowRankPlusNoise
+( DistMatrix<F>& A, Int m, Int n, Int rank, Base<F> noise )
+{
+    const Grid& grid = A.Grid();
+    DistMatrix<F> U(grid), V(grid), E(grid);
+    Gaussian( U, m, rank );
+    Gaussian( V, n, rank );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, A );
+    Gaussian( E, m, n );
+    Axpy( noise, E, A );
+}
+
+template<typename F>
+void CheckAgainstSVT
+( const DistMatrix<F>& A, const DistMatrix<F>& B, Int rank, Int expectedRank,
+  Base<F> tau, Base<F> tol, const string& msg )
+{
+    DistMatrix<F> BNormal( A );
+    svt::Normal( BNormal, tau );
+    BNormal -= B;
+    const Base<F> BFrob = FrobeniusNorm( B );
+    const Base<F> errorFrob = FrobeniusNorm( BNormal );
+    OutputFromRoot
+    (A.Grid().Comm(),"  ",msg,": rank=",rank,", || E ||_F / || B ||_F = ",
+     errorFrob/BFrob);
+    if( rank != expectedRank )
+        LogicError(msg,": rank was ",rank," rather than ",expectedRank);
+    if( errorFrob > tol*BFrob )
+        LogicError(msg,": the error relative to svt::Normal was too high");
+}
+
+template<typename F>
+void TestRandomizedSVT
+( const Grid& grid, Int m, Int n, Int rank, Base<F> tau, Base<F> noise,
+  bool print )
+{
+    typedef Base<F> Real;
+    // The randomized approximation is only accurate to the level of the
+    // discarded perturbation
+    const Real tol = 1000*noise*Max(m,n);
+
+    DistMatrix<F> A(grid), B(grid), Q(grid);
+    LowRankPlusNoise( A, m, n, rank, noise );
+    if( print )
+        Print( A, "A" );
+
+    // A cold start from a sketch narrower than the rank, which must grow
+    svt::RandomizedCtrl ctrl;
+    ctrl.initialRank = 1;
+    ctrl.oversample = 1;
+    B = A;
+    Int rankB = svt::Randomized( B, tau, Q, ctrl );
+    CheckAgainstSVT( A, B, rankB, rank, tau, tol, "Cold start" );
+    if( Q.Height() != m || Q.Width() != rankB )
+        LogicError("The returned basis was ",Q.Height()," x ",Q.Width());
+
+    // Warm start on a slightly perturbed matrix, as in successive RPCA steps
+    DistMatrix<F> E(grid);
+    Gaussian( E, m, n );
+    Axpy( noise, E, A );
+    B = A;
+    rankB = svt::Randomized( B, tau, Q, ctrl );
+    CheckAgainstSVT( A, B, rankB, rank, tau, tol, "Warm start" );
+
+    // The sequential implementation on the root's copy
+    DistMatrix<F,CIRC,CIRC> A_CIRC_CIRC( A );
+    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+    {
+        Matrix<F> BSeq( A_CIRC_CIRC.Matrix() ), QSeq;
+        rankB = svt::Randomized( BSeq, tau, QSeq, ctrl );
+        Matrix<F> BNormal( A_CIRC_CIRC.Matrix() );
+        svt::Normal( BNormal, tau );
+        BNormal -= BSeq;
+        if( rankB != rank )
+            LogicError("Sequential: rank was ",rankB," rather than ",rank);
+        if( FrobeniusNorm(BNormal) > tol*FrobeniusNorm(BSeq) )
+            LogicError("Sequential: the error relative to svt::Normal was "
+                       "too high");
+    }
+
+    // A threshold above every singular value zeroes the matrix
+    B = A;
+    rankB = svt::Randomized( B, 2*TwoNorm(A), Q, ctrl );
+    if( rankB != 0 || FrobeniusNorm(B) != Real(0) || Q.Width() != 0 )
+        LogicError("Thresholding every singular value did not yield zero");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",60);
+        const Int n = Input("--width","width of matrix",40);
+        const Int rank = Input("--rank","rank of the unperturbed matrix",7);
+        const double tau = Input("--tau","soft-threshold parameter",0.5);
+        const double noise =
+          Input("--noise","magnitude of the perturbation",1.e-10);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        OutputFromRoot(comm,"Testing with doubles:");
+        TestRandomizedSVT<double>( g, m, n, rank, tau, noise, print );
+        OutputFromRoot(comm,"Testing with double-precision complex:");
+        TestRandomizedSVT<Complex<double>>( g, m, n, rank, tau, noise, print );
+
+        OutputFromRoot(comm,"Test passed");
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
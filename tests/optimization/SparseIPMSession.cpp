@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A sparse, full-row-rank m x n constraint matrix (with m <= n) with a
+// dominant diagonal and a few pseudo-random off-diagonal entries per row
+template<typename Real>
+void ConstraintMatrix( SparseMatrix<Real>& A, Int m, Int n, Int numPerRow )
+{
+    Zeros( A, m, n );
+    A.Reserve( m*(numPerRow+1) );
+    for( Int i=0; i<m; ++i )
+    {
+        A.QueueUpdate( i, i, Real(numPerRow+1) );
+        for( Int t=1; t<=numPerRow; ++t )
+        {
+            const Int j = (i+7*t+(i*t)%5) % n;
+            if( j != i )
+                A.QueueUpdate( i, j, SampleUniform<Real>(Real(-1),Real(1)) );
+        }
+    }
+    A.ProcessQueues();
+}
+
+// Build b = A xFeas and c = A^T yFeas + zFeas with xFeas, zFeas > 0 so that
+// both the primal and the dual problems are feasible
+template<typename Real>
+void FeasibleData
+( const SparseMatrix<Real>& A, Matrix<Real>& b, Matrix<Real>& c )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Matrix<Real> xFeas, yFeas, zFeas;
+    Uniform( xFeas, n, 1, Real(1), Real(1)/2 );
+    Uniform( yFeas, m, 1 );
+    Uniform( zFeas, n, 1, Real(1), Real(1)/2 );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xFeas, Real(0), b );
+    c = zFeas;
+    Multiply( TRANSPOSE, Real(1), A, yFeas, Real(1), c );
+}
+
+template<typename Real>
+void CheckSession
+( const SparseIPMSession<Real>& session, Int numSolves, Int numColdIts,
+  const Matrix<Real>& xCold, const Matrix<Real>& xWarm, Real tol,
+  const string& msg )
+{
+    Matrix<Real> error( xWarm );
+    error -= xCold;
+    const Real relError = FrobeniusNorm(error) / FrobeniusNorm(xCold);
+    Output
+    ("  ",msg,": ",numColdIts," cold and ",session.numIterations,
+     " warm iterations, || x_warm - x_cold ||_2 / || x_cold ||_2 = ",
+     relError);
+    if( relError > tol )
+        LogicError(msg,": the warm-started solution differed");
+    if( session.numIterations >= numColdIts )
+        LogicError(msg,": the warm start did not reduce the iterations");
+    if( session.numSolves != numSolves ||
+        session.numWarmStarts != numSolves-1 )
+        LogicError(msg,": the solves were not all warm-started");
+    if( session.numAnalyses != 1 ||
+        session.numAnalysisReuses < numSolves-1 )
+        LogicError(msg,": the KKT analysis was not reused");
+    if( session.numEquilibrations != 1 ||
+        session.numEquilibrationReuses != numSolves-1 )
+        LogicError(msg,": the equilibration was not reused");
+}
+
+template<typename Real>
+void TestLP( Int m, Int n, Int numPerRow, bool print )
+{
+    Output("Testing LP with ",TypeName<Real>());
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+
+    DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> problem;
+    ConstraintMatrix( problem.A, m, n, numPerRow );
+    FeasibleData( problem.A, problem.b, problem.c );
+
+    lp::direct::Ctrl<Real> ctrl(true);
+    ctrl.mehrotraCtrl.print = print;
+    SparseIPMSession<Real> session;
+
+    DirectLPSolution<Matrix<Real>> coldSolution, warmSolution;
+    LP( problem, coldSolution, session, ctrl );
+    const Int numColdIts = session.numIterations;
+
+    // Solving the same problem again must reproduce the solution from the
+    // warm start in fewer iterations
+    LP( problem, warmSolution, session, ctrl );
+    CheckSession
+    ( session, 2, numColdIts, coldSolution.x, warmSolution.x, tol,
+      "Repeated LP" );
+
+    // The session-less interface must agree
+    DirectLPSolution<Matrix<Real>> solution;
+    LP( problem, solution, ctrl );
+    Matrix<Real> error( solution.x );
+    error -= coldSolution.x;
+    if( FrobeniusNorm(error) > tol*FrobeniusNorm(solution.x) )
+        LogicError("The session and session-less LP solutions differed");
+}
+
+template<typename Real>
+void TestQP( Int m, Int n, Int numPerRow, bool print )
+{
+    Output("Testing QP with ",TypeName<Real>());
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+
+    SparseMatrix<Real> Q, A;
+    Matrix<Real> b, c;
+    ConstraintMatrix( A, m, n, numPerRow );
+    FeasibleData( A, b, c );
+    Zeros( Q, n, n );
+    Q.Reserve( n );
+    for( Int j=0; j<n; ++j )
+        Q.QueueUpdate( j, j, SampleUniform<Real>(Real(0),Real(1)) );
+    Q.ProcessQueues();
+
+    qp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print;
+    SparseIPMSession<Real> session;
+
+    Matrix<Real> xCold, xWarm, y, z;
+    QP( Q, A, b, c, xCold, y, z, session, ctrl );
+    const Int numColdIts = session.numIterations;
+
+    QP( Q, A, b, c, xWarm, y, z, session, ctrl );
+    CheckSession
+    ( session, 2, numColdIts, xCold, xWarm, tol, "Repeated QP" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of A",100);
+        const Int n = Input("--n","width of A",200);
+        const Int numPerRow =
+          Input("--numPerRow","off-diagonal entries per row of A",4);
+        const bool print = Input("--print","print IPM progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // The sessions are sequential, so only the root process runs them
+        if( mpi::Rank() == 0 )
+        {
+            TestLP<double>( m, n, numPerRow, print );
+            TestQP<double>( m, n, numPerRow, print );
+        }
+        OutputFromRoot(mpi::COMM_WORLD,"Test passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}